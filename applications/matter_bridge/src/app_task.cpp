@@ -108,6 +108,7 @@ CHIP_ERROR AppTask::RestoreBridgedDevices()
 	uint8_t count;
 	uint8_t indexes[Nrf::BridgeManager::kMaxBridgedDevices] = { 0 };
 	size_t indexesCount = 0;
+	int64_t startTime = k_uptime_get();
 
 	if (!Nrf::BridgeStorageManager::Instance().LoadBridgedDevicesCount(count)) {
 		LOG_INF("No bridged devices to load from the storage.");
@@ -143,6 +144,9 @@ CHIP_ERROR AppTask::RestoreBridgedDevices()
 							    chip::Optional<uint16_t>(device.mEndpointId));
 #endif
 	}
+
+	LOG_INF("Restored %zu bridged devices from the storage in %lld ms", indexesCount, k_uptime_get() - startTime);
+
 	return CHIP_NO_ERROR;
 }
 #ifdef CONFIG_BRIDGE_SMART_PLUG_SUPPORT
@@ -78,7 +78,7 @@ CHIP_ERROR StoreDevice(MatterBridgedDevice *device, BridgedDeviceDataProvider *p
 	BridgeStorageManager::BridgedDevice bridgedDevice;
 
 	/* Check if a device is already present in the storage. */
-	if (BridgeStorageManager::Instance().LoadBridgedDevice(bridgedDevice, index)) {
+	if (BridgeStorageManager::Instance().IsBridgedDeviceStored(index)) {
 		deviceRefresh = true;
 	}
 
@@ -114,11 +114,6 @@ CHIP_ERROR StoreDevice(MatterBridgedDevice *device, BridgedDeviceDataProvider *p
 			LOG_ERR("Failed to store bridged devices indexes.");
 			return CHIP_ERROR_INTERNAL;
 		}
-
-		if (!BridgeStorageManager::Instance().StoreBridgedDevicesCount(count)) {
-			LOG_ERR("Failed to store bridged devices count.");
-			return CHIP_ERROR_INTERNAL;
-		}
 	}
 
 	return CHIP_NO_ERROR;
@@ -464,11 +459,6 @@ CHIP_ERROR BleBridgedDeviceFactory::RemoveDevice(int endpointId)
 		return CHIP_ERROR_INTERNAL;
 	}
 
-	if (!BridgeStorageManager::Instance().StoreBridgedDevicesCount(count)) {
-		LOG_ERR("Failed to store bridged devices count.");
-		return CHIP_ERROR_INTERNAL;
-	}
-
 	if (!BridgeStorageManager::Instance().RemoveBridgedDevice(index)) {
 		LOG_ERR("Failed to remove bridged device from the storage.");
 		return CHIP_ERROR_INTERNAL;
@@ -5,6 +5,7 @@
  */
 
 #include "bridge_manager.h"
+#include "bridge_storage_manager.h"
 #include "platform/ConfigurationManager.h"
 
 #ifdef CONFIG_BRIDGED_DEVICE_BT
@@ -14,6 +15,10 @@
 #include "simulated_bridged_device_factory.h"
 #endif /* CONFIG_BRIDGED_DEVICE_BT */
 
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+#include "attribute_report_coalescer.h"
+#endif
+
 #include <zephyr/shell/shell.h>
 
 #if defined(CONFIG_BRIDGED_DEVICE_BT) && defined(CONFIG_BT_SMP)
@@ -189,6 +194,168 @@ static int SimulatedBridgedDeviceOnOffLightSwitchWriteHandler(const struct shell
 }
 #endif
 
+#if defined(CONFIG_BRIDGED_DEVICE_SIMULATED) && defined(CONFIG_BRIDGE_REPORT_COALESCING)
+static int SimulatedBridgedDeviceStressHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	using DeviceType = Nrf::MatterBridgedDevice::DeviceType;
+	uint32_t rounds = strtoul(argv[1], nullptr, 0);
+	uint8_t indexes[Nrf::BridgeManager::kMaxBridgedDevices];
+	uint8_t count = 0;
+	uint32_t sensors = 0;
+
+	auto &coalescer = Nrf::AttributeReportCoalescer::Instance();
+
+	chip::DeviceLayer::PlatformMgr().LockChipStack();
+
+	Nrf::BridgeManager::Instance().GetDevicesIndexes(indexes, sizeof(indexes), count);
+	coalescer.ResetStats();
+
+	uint32_t start = k_cycle_get_32();
+
+	/* Emulate bursts of measurements coming from all bridged sensors at once. */
+	for (uint32_t round = 0; round < rounds; round++) {
+		for (uint8_t i = 0; i < count; i++) {
+			uint16_t deviceType{};
+			auto *provider = Nrf::BridgeManager::Instance().GetProviderByIndex(indexes[i], deviceType);
+			int16_t value = static_cast<int16_t>(round % 100);
+
+			if (!provider) {
+				continue;
+			}
+
+			if (deviceType == DeviceType::TemperatureSensor) {
+				provider->NotifyUpdateState(
+					chip::app::Clusters::TemperatureMeasurement::Id,
+					chip::app::Clusters::TemperatureMeasurement::Attributes::MeasuredValue::Id,
+					&value, sizeof(value));
+			} else if (deviceType == DeviceType::HumiditySensor) {
+				provider->NotifyUpdateState(
+					chip::app::Clusters::RelativeHumidityMeasurement::Id,
+					chip::app::Clusters::RelativeHumidityMeasurement::Attributes::MeasuredValue::Id,
+					&value, sizeof(value));
+			} else {
+				continue;
+			}
+
+			if (round == 0) {
+				sensors++;
+			}
+		}
+	}
+
+	uint32_t cycles = k_cycle_get_32() - start;
+	Nrf::AttributeReportCoalescer::Stats stats = coalescer.GetStats();
+
+	chip::DeviceLayer::PlatformMgr().UnlockChipStack();
+
+	shell_fprintf(shell, SHELL_INFO, "Sensors: %u, rounds: %u, time: %u us\n", sensors, rounds,
+		      k_cyc_to_us_floor32(cycles));
+	shell_fprintf(shell, SHELL_INFO, "Updates: %u, merged: %u, reports: %u, flushes: %u\n", stats.mUpdates,
+		      stats.mMerged, stats.mReports, stats.mFlushes);
+
+	return 0;
+}
+#endif
+
+static int StorageStatsHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	Nrf::BridgeStorageManager::Stats stats = Nrf::BridgeStorageManager::Instance().GetStats();
+
+	shell_fprintf(shell, SHELL_INFO, "Record writes: %u, record removals: %u, indexes writes: %u, commits: %u\n",
+		      stats.mRecordWrites, stats.mRecordRemovals, stats.mIndexesWrites, stats.mCommits);
+
+	return 0;
+}
+
+#ifdef CONFIG_BRIDGE_MIGRATE_VERSION_2
+template <typename T> static void AppendToRecord(uint8_t *record, size_t &size, const T *data, size_t length)
+{
+	memcpy(record + size, data, length);
+	size += length;
+}
+
+static int StorageMigrationTestHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	using Storage = Nrf::BridgeStorageManager;
+
+	Storage &storage = Storage::Instance();
+	const uint16_t endpointId = 1000;
+	const uint16_t deviceType = 0x0100;
+	const char uniqueId[] = "MIGRATIONTEST";
+	const char nodeLabel[] = "Migrated";
+	const uint8_t index = 0;
+	const uint8_t version = 2;
+	uint8_t indexes[Storage::kMaxBridgedDevices];
+	size_t count = 0;
+
+	/* Migration applies to all stored records, so it can be tested only without any bridged device stored. */
+	storage.LoadBridgedDevicesIndexes(indexes, Storage::kMaxBridgedDevices, count);
+	if (count > 0) {
+		shell_fprintf(shell, SHELL_ERROR, "Remove all bridged devices before running the test.\n");
+		return -EBUSY;
+	}
+
+	/* Version 2 record of a bridged device without user data. */
+	uint8_t record[Storage::kMaxRecordSize];
+	size_t recordSize = 0;
+	size_t uniqueIdLength = strlen(uniqueId);
+	size_t nodeLabelLength = strlen(nodeLabel);
+
+	AppendToRecord(record, recordSize, &endpointId, sizeof(endpointId));
+	AppendToRecord(record, recordSize, &deviceType, sizeof(deviceType));
+	AppendToRecord(record, recordSize, &uniqueIdLength, sizeof(uniqueIdLength));
+	AppendToRecord(record, recordSize, uniqueId, uniqueIdLength);
+	AppendToRecord(record, recordSize, &nodeLabelLength, sizeof(nodeLabelLength));
+	AppendToRecord(record, recordSize, nodeLabel, nodeLabelLength);
+
+	char indexKey[Storage::kMaxIndexLength + 1] = { 0 };
+	snprintf(indexKey, sizeof(indexKey), "%d", index);
+
+	Nrf::PersistentStorageNode rootNode(Storage::kBridgePrefix, strlen(Storage::kBridgePrefix));
+	Nrf::PersistentStorageNode devicesNode(Storage::kBridgedDevicePrefix, strlen(Storage::kBridgedDevicePrefix),
+					       &rootNode);
+	Nrf::PersistentStorageNode recordNode(indexKey, strlen(indexKey), &devicesNode);
+	Nrf::PersistentStorageNode versionNode(Storage::kVersionPrefix, strlen(Storage::kVersionPrefix), &rootNode);
+
+	indexes[0] = index;
+	if (!storage.StoreBridgedDevicesIndexes(indexes, 1) || !storage.Commit() ||
+	    Nrf::GetPersistentStorage().NonSecureStore(&recordNode, record, recordSize) != Nrf::PSErrorCode::Success ||
+	    Nrf::GetPersistentStorage().NonSecureStore(&versionNode, &version, sizeof(version)) !=
+		    Nrf::PSErrorCode::Success) {
+		shell_fprintf(shell, SHELL_ERROR, "Failed to store the version 2 record.\n");
+		return -EIO;
+	}
+
+	/* The initialization migrates the stored data to the current version. */
+	const bool migrated = storage.Init();
+
+	Storage::BridgedDevice device;
+	uint8_t userData[Storage::kMaxUserDataSize];
+
+	device.mUserData = userData;
+	device.mUserDataSize = sizeof(userData);
+
+	const bool passed = migrated && storage.LoadBridgedDevice(device, index) && device.mEndpointId == endpointId &&
+			    device.mDeviceType == deviceType && device.mUniqueIDLength == uniqueIdLength &&
+			    memcmp(device.mUniqueID, uniqueId, uniqueIdLength) == 0 &&
+			    device.mNodeLabelLength == nodeLabelLength &&
+			    memcmp(device.mNodeLabel, nodeLabel, nodeLabelLength) == 0 && device.mUserDataSize == 0;
+
+	storage.RemoveBridgedDevice(index);
+	storage.StoreBridgedDevicesIndexes(indexes, 0);
+	storage.Commit();
+
+	if (!passed) {
+		shell_fprintf(shell, SHELL_ERROR, "Version 2 record migration failed.\n");
+		return -EIO;
+	}
+
+	shell_fprintf(shell, SHELL_INFO, "Version 2 record migrated successfully.\n");
+
+	return 0;
+}
+#endif /* CONFIG_BRIDGE_MIGRATE_VERSION_2 */
+
 #ifdef CONFIG_BRIDGED_DEVICE_BT
 static void BluetoothScanResult(Nrf::BLEConnectivityManager::ScanResult &result, void *context)
 {
@@ -282,6 +449,25 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		"* new_state - new state of the simulated onoff light switch device\n"
 		"* bridged_device_endpoint_id - the bridged device's endpoint on which it was previously created\n",
 		SimulatedBridgedDeviceOnOffLightSwitchWriteHandler, 3, 0),
+#endif
+	SHELL_CMD_ARG(storage_stats, NULL,
+		      "Prints the number of bridged device storage operations since the boot. \n"
+		      "Usage: storage_stats\n",
+		      StorageStatsHandler, 1, 0),
+#ifdef CONFIG_BRIDGE_MIGRATE_VERSION_2
+	SHELL_CMD_ARG(storage_migration_test, NULL,
+		      "Stores a version 2 bridged device record without user data and checks its migration. \n"
+		      "Requires no bridged devices to be added.\n"
+		      "Usage: storage_migration_test\n",
+		      StorageMigrationTestHandler, 1, 0),
+#endif
+#if defined(CONFIG_BRIDGED_DEVICE_SIMULATED) && defined(CONFIG_BRIDGE_REPORT_COALESCING)
+	SHELL_CMD_ARG(
+		stress, NULL,
+		"Emulates bursts of measurements from all simulated temperature and humidity sensors. \n"
+		"Usage: stress <rounds>\n"
+		"* rounds - number of measurements reported by every sensor\n",
+		SimulatedBridgedDeviceStressHandler, 2, 0),
 #endif
 #ifdef CONFIG_BRIDGED_DEVICE_BT
 	SHELL_CMD_ARG(scan, NULL,
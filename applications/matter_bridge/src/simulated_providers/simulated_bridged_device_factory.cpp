@@ -22,7 +22,7 @@ CHIP_ERROR StoreDevice(Nrf::MatterBridgedDevice *device, Nrf::BridgedDeviceDataP
 	Nrf::BridgeStorageManager::BridgedDevice bridgedDevice;
 
 	/* Check if a device is already present in the storage. */
-	if (Nrf::BridgeStorageManager::Instance().LoadBridgedDevice(bridgedDevice, index)) {
+	if (Nrf::BridgeStorageManager::Instance().IsBridgedDeviceStored(index)) {
 		deviceRefresh = true;
 	}
 
@@ -51,11 +51,6 @@ CHIP_ERROR StoreDevice(Nrf::MatterBridgedDevice *device, Nrf::BridgedDeviceDataP
 			LOG_ERR("Failed to store bridged devices indexes.");
 			return CHIP_ERROR_INTERNAL;
 		}
-
-		if (!Nrf::BridgeStorageManager::Instance().StoreBridgedDevicesCount(count)) {
-			LOG_ERR("Failed to store bridged devices count.");
-			return CHIP_ERROR_INTERNAL;
-		}
 	}
 
 	return CHIP_NO_ERROR;
@@ -246,11 +241,6 @@ CHIP_ERROR SimulatedBridgedDeviceFactory::RemoveDevice(int endpointId)
 		return CHIP_ERROR_INTERNAL;
 	}
 
-	if (!Nrf::BridgeStorageManager::Instance().StoreBridgedDevicesCount(count)) {
-		LOG_ERR("Failed to store bridged devices count.");
-		return CHIP_ERROR_INTERNAL;
-	}
-
 	if (!Nrf::BridgeStorageManager::Instance().RemoveBridgedDevice(index)) {
 		LOG_ERR("Failed to remove bridged device from the storage.");
 		return CHIP_ERROR_INTERNAL;
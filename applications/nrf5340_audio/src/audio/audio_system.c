@@ -45,6 +45,14 @@ static struct k_poll_signal encoder_sig;
 static struct k_poll_event encoder_evt =
 	K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &encoder_sig);
 
+/* Incremented every time fifo_rx is emptied, which returns all its blocks to the slab */
+static atomic_t fifo_rx_gen;
+
+/* Held by the encoder while it owns blocks of fifo_rx, so that they are not returned to the
+ * slab by audio_system_stop() while they are encoded.
+ */
+static K_MUTEX_DEFINE(encoder_mtx);
+
 static struct sw_codec_config sw_codec_cfg;
 /* Buffer which can hold max 1 period test tone at 1000 Hz */
 static int16_t test_tone_buf[CONFIG_AUDIO_SAMPLE_RATE_HZ / 1000];
@@ -108,6 +116,44 @@ static void audio_headset_configure(void)
 	}
 }
 
+#if (CONFIG_AUDIO_ENCODER_TIMING)
+struct encoder_timing {
+	uint32_t frames;
+	uint32_t encode_sum_cyc;
+	uint32_t encode_max_cyc;
+	uint32_t send_sum_cyc;
+	uint32_t send_max_cyc;
+};
+
+/**
+ * @brief	Add the timing of one frame and log the statistics every DEBUG_INTERVAL_NUM frames.
+ *
+ * @param[in,out]	timing		Timing statistics.
+ * @param[in]		encode_cyc	Cycles spent on preparing and encoding the frame.
+ * @param[in]		send_cyc	Cycles spent on sending the frame.
+ */
+static void encoder_timing_add(struct encoder_timing *timing, uint32_t encode_cyc,
+			       uint32_t send_cyc)
+{
+	timing->encode_sum_cyc += encode_cyc;
+	timing->encode_max_cyc = MAX(timing->encode_max_cyc, encode_cyc);
+	timing->send_sum_cyc += send_cyc;
+	timing->send_max_cyc = MAX(timing->send_max_cyc, send_cyc);
+
+	if (++timing->frames < DEBUG_INTERVAL_NUM) {
+		return;
+	}
+
+	LOG_INF("Frame encode avg: %u us, max: %u us, send avg: %u us, max: %u us",
+		k_cyc_to_us_floor32(timing->encode_sum_cyc / timing->frames),
+		k_cyc_to_us_floor32(timing->encode_max_cyc),
+		k_cyc_to_us_floor32(timing->send_sum_cyc / timing->frames),
+		k_cyc_to_us_floor32(timing->send_max_cyc));
+
+	*timing = (struct encoder_timing){0};
+}
+#endif /* (CONFIG_AUDIO_ENCODER_TIMING) */
+
 static void encoder_thread(void *arg1, void *arg2, void *arg3)
 {
 	int ret;
@@ -117,13 +163,20 @@ static void encoder_thread(void *arg1, void *arg2, void *arg3)
 	int debug_trans_count = 0;
 	size_t encoded_data_size = 0;
 
-	void *tmp_pcm_raw_data[CONFIG_FIFO_FRAME_SPLIT_NUM];
-	char pcm_raw_data[FRAME_SIZE_BYTES];
+	void *pcm_blocks[CONFIG_FIFO_FRAME_SPLIT_NUM];
+	int pcm_blocks_num;
+	atomic_val_t frame_fifo_rx_gen;
 
 	static uint8_t *encoded_data;
 	static size_t pcm_block_size;
 	static uint32_t test_tone_finite_pos;
 
+#if (CONFIG_AUDIO_ENCODER_TIMING)
+	static struct encoder_timing timing;
+	uint32_t frame_start_cyc;
+	uint32_t frame_encoded_cyc;
+#endif /* (CONFIG_AUDIO_ENCODER_TIMING) */
+
 	while (1) {
 		/* Don't start encoding until the stream needing it has started */
 		ret = k_poll(&encoder_evt, 1, K_FOREVER);
@@ -131,19 +184,44 @@ static void encoder_thread(void *arg1, void *arg2, void *arg3)
 		/* Get PCM data from I2S */
 		/* Since one audio frame is divided into a number of
 		 * blocks, we need to fetch the pointers to all of these
-		 * blocks before copying it to a continuous area of memory
-		 * before sending it to the encoder
+		 * blocks. The blocks are passed to the encoder in place
+		 * and kept until the frame is encoded.
 		 */
-		for (int i = 0; i < CONFIG_FIFO_FRAME_SPLIT_NUM; i++) {
-			ret = data_fifo_pointer_last_filled_get(&fifo_rx, &tmp_pcm_raw_data[i],
-								&pcm_block_size, K_FOREVER);
+		pcm_blocks_num = 0;
+		frame_fifo_rx_gen = atomic_get(&fifo_rx_gen);
+
+		while (pcm_blocks_num < CONFIG_FIFO_FRAME_SPLIT_NUM) {
+			void **block = &pcm_blocks[pcm_blocks_num];
+
+			ret = data_fifo_pointer_last_filled_get(&fifo_rx, block, &pcm_block_size,
+								K_FOREVER);
 			ERR_CHK(ret);
-			memcpy(pcm_raw_data + (i * BLOCK_SIZE_BYTES), tmp_pcm_raw_data[i],
-			       pcm_block_size);
 
-			data_fifo_block_free(&fifo_rx, tmp_pcm_raw_data[i]);
+			if (atomic_get(&fifo_rx_gen) != frame_fifo_rx_gen) {
+				/* FIFO was emptied, possibly after the block was fetched, so none
+				 * of the fetched blocks is owned by the encoder anymore. Start a
+				 * new frame from an empty set.
+				 */
+				frame_fifo_rx_gen = atomic_get(&fifo_rx_gen);
+				pcm_blocks_num = 0;
+				continue;
+			}
+
+			pcm_blocks_num++;
+		}
+
+		k_mutex_lock(&encoder_mtx, K_FOREVER);
+
+		if (atomic_get(&fifo_rx_gen) != frame_fifo_rx_gen) {
+			/* FIFO was emptied after the last block was fetched, drop the frame */
+			k_mutex_unlock(&encoder_mtx);
+			continue;
 		}
 
+#if (CONFIG_AUDIO_ENCODER_TIMING)
+		frame_start_cyc = k_cycle_get_32();
+#endif /* (CONFIG_AUDIO_ENCODER_TIMING) */
+
 		if (sw_codec_cfg.encoder.enabled) {
 			if (test_tone_size) {
 				/* Test tone takes over audio stream */
@@ -154,18 +232,32 @@ static void encoder_thread(void *arg1, void *arg2, void *arg3)
 							  test_tone_size, &test_tone_finite_pos);
 				ERR_CHK(ret);
 
-				ret = pscm_copy_pad(tmp, FRAME_SIZE_BYTES / 2,
-						    CONFIG_AUDIO_BIT_DEPTH_BITS, pcm_raw_data,
-						    &num_bytes);
-				ERR_CHK(ret);
+				for (int i = 0; i < CONFIG_FIFO_FRAME_SPLIT_NUM; i++) {
+					char *tone = &tmp[i * (BLOCK_SIZE_BYTES / 2)];
+
+					ret = pscm_copy_pad(tone, BLOCK_SIZE_BYTES / 2,
+							    CONFIG_AUDIO_BIT_DEPTH_BITS,
+							    pcm_blocks[i], &num_bytes);
+					ERR_CHK(ret);
+				}
 			}
 
-			ret = sw_codec_encode(pcm_raw_data, FRAME_SIZE_BYTES, &encoded_data,
-					      &encoded_data_size);
+			ret = sw_codec_encode(pcm_blocks, CONFIG_FIFO_FRAME_SPLIT_NUM,
+					      BLOCK_SIZE_BYTES, &encoded_data, &encoded_data_size);
 
 			ERR_CHK_MSG(ret, "Encode failed");
 		}
 
+		for (int i = 0; i < CONFIG_FIFO_FRAME_SPLIT_NUM; i++) {
+			data_fifo_block_free(&fifo_rx, pcm_blocks[i]);
+		}
+
+		k_mutex_unlock(&encoder_mtx);
+
+#if (CONFIG_AUDIO_ENCODER_TIMING)
+		frame_encoded_cyc = k_cycle_get_32();
+#endif /* (CONFIG_AUDIO_ENCODER_TIMING) */
+
 		/* Print block usage */
 		if (debug_trans_count == DEBUG_INTERVAL_NUM) {
 			ret = data_fifo_num_used_get(&fifo_rx, &blocks_alloced_num,
@@ -182,6 +274,12 @@ static void encoder_thread(void *arg1, void *arg2, void *arg3)
 			streamctrl_send(encoded_data, encoded_data_size,
 					sw_codec_cfg.encoder.num_ch);
 		}
+
+#if (CONFIG_AUDIO_ENCODER_TIMING)
+		encoder_timing_add(&timing, frame_encoded_cyc - frame_start_cyc,
+				   k_cycle_get_32() - frame_encoded_cyc);
+#endif /* (CONFIG_AUDIO_ENCODER_TIMING) */
+
 		STACK_USAGE_PRINT("encoder_thread", &encoder_thread_data);
 	}
 }
@@ -437,12 +535,18 @@ void audio_system_stop(void)
 	ERR_CHK(ret);
 #endif /* ((CONFIG_AUDIO_DEV == GATEWAY) && CONFIG_AUDIO_SOURCE_USB) */
 
+	/* Wait for the encoder to finish the frame it is working on */
+	k_mutex_lock(&encoder_mtx, K_FOREVER);
+
 	ret = sw_codec_uninit(sw_codec_cfg);
 	ERR_CHK_MSG(ret, "Failed to uninit codec");
 	sw_codec_cfg.initialized = false;
 
+	atomic_inc(&fifo_rx_gen);
 	data_fifo_empty(&fifo_rx);
 	data_fifo_empty(&fifo_tx);
+
+	k_mutex_unlock(&encoder_mtx);
 }
 
 int audio_system_fifo_rx_block_drop(void)
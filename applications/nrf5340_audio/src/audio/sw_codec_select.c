@@ -83,18 +83,19 @@ bool sw_codec_is_initialized(void)
 	return m_config.initialized;
 }
 
-int sw_codec_encode(void *pcm_data, size_t pcm_size, uint8_t **encoded_data, size_t *encoded_size)
+int sw_codec_encode(void *const pcm_blocks[], uint8_t num_blocks, size_t block_size,
+		    uint8_t **encoded_data, size_t *encoded_size)
 {
 	int ret;
 
 	/* Temp storage for split stereo PCM signal */
-	char pcm_data_mono_system_sample_rate[AUDIO_CH_NUM][PCM_NUM_BYTES_MONO] = {0};
+	char pcm_data_mono_system_sample_rate[AUDIO_CH_NUM][PCM_NUM_BYTES_MONO];
 	/* Make sure we have enough space for two frames (stereo) */
 	static uint8_t m_encoded_data[ENC_MAX_FRAME_SIZE * AUDIO_CH_NUM];
 
 	char pcm_data_mono_converted_buf[AUDIO_CH_NUM][PCM_NUM_BYTES_MONO] = {0};
 
-	size_t pcm_block_size_mono_system_sample_rate;
+	size_t pcm_block_size_mono_system_sample_rate = 0;
 	size_t pcm_block_size_mono;
 
 	if (!m_config.encoder.enabled) {
@@ -102,6 +103,11 @@ int sw_codec_encode(void *pcm_data, size_t pcm_size, uint8_t **encoded_data, siz
 		return -ENXIO;
 	}
 
+	if ((num_blocks * (block_size / 2)) > PCM_NUM_BYTES_MONO) {
+		LOG_ERR("PCM data too large: %d blocks of %zu bytes", num_blocks, block_size);
+		return -EINVAL;
+	}
+
 	switch (m_config.sw_codec) {
 	case SW_CODEC_LC3: {
 #if (CONFIG_SW_CODEC_LC3)
@@ -109,14 +115,23 @@ int sw_codec_encode(void *pcm_data, size_t pcm_size, uint8_t **encoded_data, siz
 		char *pcm_data_mono_ptrs[m_config.encoder.channel_mode];
 
 		/* Since LC3 is a single channel codec, we must split the
-		 * stereo PCM stream
+		 * stereo PCM stream. The split reads the blocks in place,
+		 * so they do not need to be copied into a frame first.
 		 */
-		ret = pscm_two_channel_split(pcm_data, pcm_size, CONFIG_AUDIO_BIT_DEPTH_BITS,
-					     pcm_data_mono_system_sample_rate[AUDIO_CH_L],
-					     pcm_data_mono_system_sample_rate[AUDIO_CH_R],
-					     &pcm_block_size_mono_system_sample_rate);
-		if (ret) {
-			return ret;
+		for (int i = 0; i < num_blocks; i++) {
+			size_t offset = pcm_block_size_mono_system_sample_rate;
+			char *out_left = &pcm_data_mono_system_sample_rate[AUDIO_CH_L][offset];
+			char *out_right = &pcm_data_mono_system_sample_rate[AUDIO_CH_R][offset];
+			size_t split_size;
+
+			ret = pscm_two_channel_split(pcm_blocks[i], block_size,
+						     CONFIG_AUDIO_BIT_DEPTH_BITS, out_left,
+						     out_right, &split_size);
+			if (ret) {
+				return ret;
+			}
+
+			pcm_block_size_mono_system_sample_rate += split_size;
 		}
 
 		for (int i = 0; i < m_config.encoder.channel_mode; ++i) {
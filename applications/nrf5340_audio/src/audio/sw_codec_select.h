@@ -82,15 +82,19 @@ bool sw_codec_is_initialized(void);
  *
  * @note	Takes in stereo PCM stream, will encode either one or two
  *		channels, based on channel_mode set during init.
+ *		The stream is given as a number of equally sized blocks that are
+ *		read in place, so the blocks do not need to be contiguous in memory.
  *
- * @param[in]	pcm_data	Pointer to PCM data.
- * @param[in]	pcm_size	Size of PCM data.
+ * @param[in]	pcm_blocks	Array of pointers to the blocks of PCM data.
+ * @param[in]	num_blocks	Number of blocks in @p pcm_blocks.
+ * @param[in]	block_size	Size of each PCM block.
  * @param[out]	encoded_data	Pointer to buffer to store encoded data.
  * @param[out]	encoded_size	Size of encoded data.
  *
  * @return	0 if success, error codes depends on sw_codec selected.
  */
-int sw_codec_encode(void *pcm_data, size_t pcm_size, uint8_t **encoded_data, size_t *encoded_size);
+int sw_codec_encode(void *const pcm_blocks[], uint8_t num_blocks, size_t block_size,
+		    uint8_t **encoded_data, size_t *encoded_size);
 
 /**
  * @brief	Decode encoded data and output PCM data.
@@ -4,9 +4,11 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <zephyr/kernel.h>
 #include <zephyr/drivers/flash.h>
 #include <zephyr/logging/log.h>
 #include <drivers/flash/flash_rpc.h>
+#include <string.h>
 
 #include <nrf_rpc/nrf_rpc_ipc.h>
 #include <nrf_rpc_cbor.h>
@@ -57,6 +59,110 @@ static void flash_rpc_get_rsp(const struct nrf_rpc_group *group, struct nrf_rpc_
 	}
 }
 
+static int write_sync(off_t offset, const void *data, size_t len);
+
+#ifdef CONFIG_FLASH_RPC_WRITE_BEHIND
+/* Write queued to be sent to the host by the write-behind work queue. Slots are
+ * used and released in order, so the slot following the last used one is
+ * always the one to be released first.
+ */
+struct write_behind_slot {
+	struct k_work work;
+	off_t offset;
+	size_t len;
+	uint8_t buf[CONFIG_FLASH_RPC_WRITE_BEHIND_BUF_SIZE] __aligned(4);
+};
+
+static struct write_behind_slot write_behind_slots[CONFIG_FLASH_RPC_WRITE_BEHIND_SLOTS];
+static size_t write_behind_next;
+static atomic_t write_behind_error;
+static K_SEM_DEFINE(write_behind_free, CONFIG_FLASH_RPC_WRITE_BEHIND_SLOTS,
+		    CONFIG_FLASH_RPC_WRITE_BEHIND_SLOTS);
+static K_MUTEX_DEFINE(write_behind_lock);
+static K_KERNEL_STACK_DEFINE(write_behind_stack, CONFIG_FLASH_RPC_WRITE_BEHIND_STACK_SIZE);
+static struct k_work_q write_behind_queue;
+
+static void write_behind_handler(struct k_work *work)
+{
+	struct write_behind_slot *slot = CONTAINER_OF(work, struct write_behind_slot, work);
+	int err;
+
+	err = write_sync(slot->offset, slot->buf, slot->len);
+	if (err) {
+		LOG_ERR("Queued write at 0x%"PRIx32" failed: %d", (uint32_t)slot->offset, err);
+		(void)atomic_cas(&write_behind_error, 0, err);
+	}
+
+	k_sem_give(&write_behind_free);
+}
+
+static void write_behind_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(write_behind_slots); i++) {
+		k_work_init(&write_behind_slots[i].work, write_behind_handler);
+	}
+
+	k_work_queue_start(&write_behind_queue, write_behind_stack,
+			   K_KERNEL_STACK_SIZEOF(write_behind_stack),
+			   CONFIG_SYSTEM_WORKQUEUE_PRIORITY, NULL);
+	k_thread_name_set(&write_behind_queue.thread, "flash_rpc_wb");
+}
+
+/* Wait until all queued writes are completed and return the first error, if any. */
+static int write_behind_flush(void)
+{
+	/* Concurrent flushes taking a part of the slots each would wait for each other */
+	k_mutex_lock(&write_behind_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(write_behind_slots); i++) {
+		k_sem_take(&write_behind_free, K_FOREVER);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(write_behind_slots); i++) {
+		k_sem_give(&write_behind_free);
+	}
+
+	k_mutex_unlock(&write_behind_lock);
+
+	return (int)atomic_set(&write_behind_error, 0);
+}
+
+static int write_behind_queue_add(off_t offset, const void *data, size_t len)
+{
+	struct write_behind_slot *slot;
+	int err;
+
+	/* Reject what the host would reject, as the result of a queued write is only
+	 * known later.
+	 */
+	if ((offset % FLASH_RPC_PROG_UNIT) || (len % FLASH_RPC_PROG_UNIT) ||
+	    offset < 0 || offset + len > FLASH_RPC_FLASH_SIZE) {
+		return -EINVAL;
+	}
+
+	/* Report a failure of an earlier queued write instead of queueing more data */
+	err = (int)atomic_set(&write_behind_error, 0);
+	if (err) {
+		return err;
+	}
+
+	k_mutex_lock(&write_behind_lock, K_FOREVER);
+	k_sem_take(&write_behind_free, K_FOREVER);
+
+	slot = &write_behind_slots[write_behind_next];
+	write_behind_next = (write_behind_next + 1) % ARRAY_SIZE(write_behind_slots);
+
+	slot->offset = offset;
+	slot->len = len;
+	memcpy(slot->buf, data, len);
+
+	(void)k_work_submit_to_queue(&write_behind_queue, &slot->work);
+	k_mutex_unlock(&write_behind_lock);
+
+	return 0;
+}
+#endif /* CONFIG_FLASH_RPC_WRITE_BEHIND */
+
 static bool encode_flash_msg(struct nrf_rpc_cbor_ctx *ctx, off_t *offset, void *ptr, size_t *len)
 {
 	NRF_RPC_CBOR_ALLOC(&flash_rpc_api, *ctx, CBOR_BUF_FLASH_MSG_SIZE);
@@ -92,6 +198,11 @@ int flash_rpc_init(const struct device *dev)
 
 	ARG_UNUSED(dev_config);
 
+#ifdef CONFIG_FLASH_RPC_WRITE_BEHIND
+	/* The queue must be running before the first write, whatever the host reports */
+	write_behind_init();
+#endif
+
 #ifndef CONFIG_FLASH_RPC_SYS_INIT
 	err = nrf_rpc_init(err_handler);
 	if (err) {
@@ -127,6 +238,14 @@ int flash_rpc_read(const struct device *dev, off_t offset, void *buffer, size_t
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_FLASH_RPC_WRITE_BEHIND
+	/* Read back the data of queued writes */
+	err = write_behind_flush();
+	if (err) {
+		return err;
+	}
+#endif
+
 	if (!encode_flash_msg(&ctx, &offset, buffer, &len)) {
 		LOG_ERR("Could not encode flash_rpc message");
 		return -EMSGSIZE;
@@ -144,21 +263,12 @@ int flash_rpc_read(const struct device *dev, off_t offset, void *buffer, size_t
 	return result;
 }
 
-int flash_rpc_write(const struct device *dev, off_t offset, const void *data, size_t len)
+static int write_sync(off_t offset, const void *data, size_t len)
 {
-	ARG_UNUSED(dev);
 	int err;
 	int result;
 	struct nrf_rpc_cbor_ctx ctx;
 
-	if (len == 0) {
-		return 0;
-	}
-
-	if (data == NULL) {
-		return -EINVAL;
-	}
-
 	if (!encode_flash_msg(&ctx, &offset, (void *)data, &len)) {
 		return -EMSGSIZE;
 	}
@@ -175,6 +285,39 @@ int flash_rpc_write(const struct device *dev, off_t offset, const void *data, si
 	return result;
 }
 
+int flash_rpc_write(const struct device *dev, off_t offset, const void *data, size_t len)
+{
+	ARG_UNUSED(dev);
+
+	if (len == 0) {
+		return 0;
+	}
+
+	if (data == NULL) {
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_FLASH_RPC_WRITE_BEHIND
+	int err;
+
+	/* Small writes are copied and queued, so that the caller can prepare the next
+	 * data while the host programs the flash. 0 is returned before the data reaches
+	 * the flash. Large writes are passed to the host directly from the caller's buffer
+	 * after the queued ones are completed.
+	 */
+	if (len <= CONFIG_FLASH_RPC_WRITE_BEHIND_BUF_SIZE) {
+		return write_behind_queue_add(offset, data, len);
+	}
+
+	err = write_behind_flush();
+	if (err) {
+		return err;
+	}
+#endif
+
+	return write_sync(offset, data, len);
+}
+
 int flash_rpc_erase(const struct device *dev, off_t offset, size_t size)
 {
 	ARG_UNUSED(dev);
@@ -183,6 +326,13 @@ int flash_rpc_erase(const struct device *dev, off_t offset, size_t size)
 
 	struct nrf_rpc_cbor_ctx ctx;
 
+#ifdef CONFIG_FLASH_RPC_WRITE_BEHIND
+	err = write_behind_flush();
+	if (err) {
+		return err;
+	}
+#endif
+
 	if (!encode_flash_msg(&ctx, &offset, NULL, &size)) {
 		return -EMSGSIZE;
 	}
@@ -55,6 +55,14 @@ enum app_event_type_flags {
 	 */
 	APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE =
 		APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START,
+	/** replaces an event of this type that is still waiting in the queue
+	 *  with a newly submitted one instead of queuing both.
+	 *  Submit hooks are not called for the coalesced event, as it is
+	 *  freed without being queued.
+	 *  Requires @kconfig{CONFIG_APP_EVENT_MANAGER_COALESCE}.
+	 *  Flag set by user.
+	 */
+	APP_EVENT_TYPE_FLAGS_COALESCE,
 	/** shows number of predefined flags.*/
 	APP_EVENT_TYPE_FLAGS_COUNT,
 	/** marks beginning of user-specific flags.*/
@@ -178,6 +186,37 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 	_APP_EVENT_TYPE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags)
 
 
+/** @brief Define a coalescing event type with a merge function.
+ *
+ * This macro defines an event type in the same way as @ref APP_EVENT_TYPE_DEFINE and sets
+ * the @ref APP_EVENT_TYPE_FLAGS_COALESCE flag. When an event of this type is submitted while
+ * another one is still waiting in the queue, @p merge_fn is called to merge the new event
+ * into the queued one, and the new event is freed. Submit hooks are not called for the
+ * freed event.
+ *
+ * The merge function has a form
+ * `void merge_fn(struct app_event_header *queued, const struct app_event_header *aeh)`.
+ * It is called under the spinlock protecting the event queue, so it must be short and
+ * it must not submit events.
+ *
+ * @note
+ * For this macro to be available the @kconfig{CONFIG_APP_EVENT_MANAGER_COALESCE} option
+ * needs to be enabled.
+ *
+ * @param ename     	   Name of the event.
+ * @param log_fn  	   Function to stringify an event of this type.
+ * @param ev_info_struct   Data structure describing the event type.
+ * @param app_event_type_flags Event type flags.
+ *                         You should use APP_EVENT_FLAGS_CREATE to define them.
+ * @param merge_fn         Function merging a new event into the queued one.
+ */
+#define APP_EVENT_TYPE_COALESCE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags,	\
+				       merge_fn)						\
+	_APP_EVENT_TYPE_DEFINE_EXT(ename, log_fn, ev_info_struct,				\
+				   (app_event_type_flags) | BIT(APP_EVENT_TYPE_FLAGS_COALESCE),	\
+				   merge_fn)
+
+
 /** @brief Verify if an event ID is valid.
  *
  * The pointer to an event type structure is used as its ID. This macro
@@ -392,6 +431,22 @@ int app_event_manager_init(void);
 void *app_event_manager_alloc(size_t size);
 
 
+/** @brief Get the number of coalesced events of a given type.
+ *
+ * An event is counted when it is merged into an event of the same type that is still waiting
+ * in the queue, and the event itself is not processed.
+ *
+ * @note
+ * For this function to be available the @kconfig{CONFIG_APP_EVENT_MANAGER_COALESCE} option
+ * needs to be enabled.
+ *
+ * @param et  Pointer to the event type.
+ *
+ * @return Number of coalesced events.
+ */
+uint32_t app_event_manager_coalesced_cnt_get(const struct event_type *et);
+
+
 /** @brief Free memory occupied by the event.
  *
  * The behavior of this function depends on the actual implementation.
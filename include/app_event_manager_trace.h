@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file
+ * @brief Application Event Manager trace recorder and replayer header.
+ */
+
+#ifndef _APP_EVENT_MANAGER_TRACE_H_
+#define _APP_EVENT_MANAGER_TRACE_H_
+
+/**
+ * @defgroup app_event_manager_trace Application Event Manager trace
+ * @brief Recording and replaying of Application Event Manager events
+ *
+ * The trace is a byte stream that starts with @ref app_event_trace_header and continues with
+ * records. Every record starts with a byte holding @ref app_event_trace_record_type.
+ *
+ * An @ref APP_EVENT_TRACE_RECORD_TYPE record assigns an index to an event type:
+ * - event type index (1 byte),
+ * - name length (1 byte),
+ * - event type name, without the NULL terminator.
+ *
+ * An @ref APP_EVENT_TRACE_RECORD_EVENT record holds a processed event:
+ * - event type index (1 byte),
+ * - time since the previous event in microseconds (variable-length integer),
+ * - event data length (variable-length integer),
+ * - event data, that is the event structure without @ref app_event_header.
+ *
+ * Variable-length integers are encoded as little-endian groups of 7 bits. The most
+ * significant bit of every byte is set if more bytes follow.
+ *
+ * The event data is copied as is, so the replayed events must have the same layout
+ * on the recording and the replaying target. Events that contain pointers cannot be replayed.
+ *
+ * @{
+ */
+
+#include <app_event_manager.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Value of @ref app_event_trace_header.magic. */
+#define APP_EVENT_TRACE_MAGIC 0x544d4541
+
+/** Version of the trace format. */
+#define APP_EVENT_TRACE_VERSION 1
+
+/** @brief Trace header. */
+struct app_event_trace_header {
+	/** Always set to @ref APP_EVENT_TRACE_MAGIC. */
+	uint32_t magic;
+
+	/** Version of the trace format. */
+	uint8_t version;
+
+	/** Reserved for future use. */
+	uint8_t reserved[3];
+};
+
+/** @brief Trace record types. */
+enum app_event_trace_record_type {
+	/** Event type definition. */
+	APP_EVENT_TRACE_RECORD_TYPE,
+
+	/** Processed event. */
+	APP_EVENT_TRACE_RECORD_EVENT,
+};
+
+/** @brief Processing time statistics. */
+struct app_event_trace_stats {
+	/** Number of measurements. */
+	uint32_t count;
+
+	/** The longest measured time in cycles. */
+	uint32_t max_cycles;
+
+	/** Sum of the measured times in cycles. */
+	uint64_t total_cycles;
+};
+
+/** @brief Replay parameters. */
+struct app_event_trace_replay_param {
+	/** Replay speed relative to the recorded timing.
+	 *  For example, 1 replays the events with the recorded timing and 10 replays them ten
+	 *  times faster. 0 submits the events without any delay.
+	 */
+	uint32_t speed;
+
+	/** Function selecting the event types to be replayed.
+	 *  The function returns true if events of the given type are to be replayed.
+	 *  If NULL, events of all types are replayed.
+	 *
+	 *  The events that are submitted by the application modules in reaction to other
+	 *  events should be filtered out, because they are submitted again during the replay.
+	 */
+	bool (*filter)(const struct event_type *et);
+};
+
+/** @brief Start recording events.
+ *
+ * The data recorded before is dropped and the trace header is written.
+ * The events are recorded after they are processed.
+ */
+void app_event_trace_recorder_start(void);
+
+/** @brief Stop recording events.
+ *
+ * The recorded data can still be read.
+ */
+void app_event_trace_recorder_stop(void);
+
+/** @brief Read the recorded data.
+ *
+ * The events that do not fit in the recorder buffer are dropped, so the data should be read
+ * often enough.
+ *
+ * @param buf  Buffer for the data.
+ * @param size Size of the buffer.
+ *
+ * @return Number of bytes read.
+ */
+size_t app_event_trace_recorder_read(uint8_t *buf, size_t size);
+
+/** @brief Get the number of events dropped since the recording was started.
+ *
+ * @return Number of dropped events.
+ */
+uint32_t app_event_trace_recorder_dropped_get(void);
+
+/** @brief Replay the recorded events.
+ *
+ * The events are allocated with @ref app_event_manager_alloc and submitted from the calling
+ * thread. The function returns after the last event is submitted.
+ * Events of types that are not defined in the application are skipped.
+ *
+ * @param trace Recorded data, starting with the trace header.
+ * @param len   Length of the recorded data.
+ * @param param Replay parameters.
+ *
+ * @retval Number of submitted events if the operation was successful.
+ * @retval -EINVAL if the recorded data is malformed.
+ * @retval -ENOTSUP if the trace format version is not supported.
+ * @retval -ENOMEM if an event could not be allocated.
+ */
+int app_event_trace_replay(const uint8_t *trace, size_t len,
+			   const struct app_event_trace_replay_param *param);
+
+/** @brief Get the processing time statistics of an event type.
+ *
+ * The processing time includes the time spent by all listeners notified about the event.
+ *
+ * @param et    Event type.
+ * @param stats Statistics.
+ */
+void app_event_trace_type_stats_get(const struct event_type *et,
+				    struct app_event_trace_stats *stats);
+
+/** @brief Get the processing time statistics of a listener.
+ *
+ * @param el    Event listener.
+ * @param stats Statistics.
+ */
+void app_event_trace_listener_stats_get(const struct event_listener *el,
+					struct app_event_trace_stats *stats);
+
+/** @brief Reset the processing time statistics. */
+void app_event_trace_stats_reset(void);
+
+/** @brief Log the processing time statistics of all event types and listeners. */
+void app_event_trace_stats_log(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _APP_EVENT_MANAGER_TRACE_H_ */
@@ -58,6 +58,53 @@ int bt_rpc_gatt_subscribe_flag_clear(struct bt_gatt_subscribe_params *params, ui
  */
 int bt_rpc_gatt_subscribe_flag_get(struct bt_gatt_subscribe_params *params, uint32_t flags_bit);
 
+/** @brief Asynchronous notification completion callback.
+ *
+ * @param conn      Connection object.
+ * @param err       0 if the notification was sent, negative value if the host
+ *                  failed to send it.
+ * @param user_data User data passed to bt_rpc_gatt_notify_async().
+ */
+typedef void (*bt_rpc_gatt_notify_done_t)(struct bt_conn *conn, int err, void *user_data);
+
+/** @brief Queue a notification without waiting for the host.
+ *
+ * Unlike bt_gatt_notify_cb(), which waits for the host to handle each notification,
+ * this function copies the notification data to a batch buffer and returns. The
+ * batch is sent to the host in a single event when it is full, when
+ * @kconfig{CONFIG_BT_RPC_GATT_NOTIFY_ASYNC_MAX_COUNT} notifications are queued,
+ * after @kconfig{CONFIG_BT_RPC_GATT_NOTIFY_ASYNC_LATENCY_MS}, or when
+ * bt_rpc_gatt_notify_flush() is called. Notifications are sent in the queued order.
+ *
+ * Completion callbacks are reported by the host in batches as well. They are
+ * called from the nRF RPC thread once the notification is sent, or with an error
+ * if the host failed to send it. If a batch cannot be sent to the host, the
+ * callbacks of its notifications are called with the error from the thread that
+ * sent the batch. A reference to the connection is held until the notification
+ * is completed.
+ *
+ * @param conn      Connection object.
+ * @param attr      Characteristic value attribute.
+ * @param data      Notification data.
+ * @param len       Notification data length.
+ * @param done      Completion callback, can be NULL.
+ * @param user_data User data passed to the completion callback.
+ *
+ * @retval 0 if the notification was queued.
+ * @retval -EINVAL if the connection or attribute is invalid.
+ * @retval -EMSGSIZE if the notification does not fit into the batch buffer.
+ * @return Other negative value if sending a full batch to the host failed.
+ */
+int bt_rpc_gatt_notify_async(struct bt_conn *conn, const struct bt_gatt_attr *attr,
+			     const void *data, uint16_t len, bt_rpc_gatt_notify_done_t done,
+			     void *user_data);
+
+/** @brief Send all queued asynchronous notifications to the host.
+ *
+ * @return 0 in case of success or negative value in case of error.
+ */
+int bt_rpc_gatt_notify_flush(void);
+
 #ifdef __cplusplus
 }
 #endif
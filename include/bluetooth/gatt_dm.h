@@ -317,6 +317,21 @@ int bt_gatt_dm_continue(struct bt_gatt_dm *dm, void *context);
  */
 int bt_gatt_dm_data_release(struct bt_gatt_dm *dm);
 
+/** @brief Clear the discovery cache.
+ *
+ * Removes the services cached for the given peer, for example when its bond
+ * is removed.
+ *
+ * Requires @kconfig{CONFIG_BT_GATT_DM_CACHE}.
+ *
+ * @param[in] peer Address of the peer, or NULL to clear the cache of all
+ *                 peers.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int bt_gatt_dm_cache_clear(const bt_addr_le_t *peer);
+
 /** @brief Print service discovery data.
  *
  * This function prints GATT attributes that belong to the discovered service.
@@ -625,6 +625,24 @@ struct bt_mesh_sensor {
 
 		/** Flag indicating whether the sensor cadence state has been configured. */
 		uint8_t configured : 1;
+
+		/** Flag indicating whether the sensor value did not fit into the
+		 *  previous periodic publication, and must be included in the next.
+		 */
+		uint8_t deferred : 1;
+
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_VALUE_CACHE)
+		/** Flag indicating whether the cache holds a value. */
+		bool cached;
+
+		/** Flag indicating whether the cached value has changed since it
+		 *  was last evaluated for publication.
+		 */
+		bool dirty;
+
+		/** The latest sensor value pushed by the application. */
+		struct bt_mesh_sensor_value cache[CONFIG_BT_MESH_SENSOR_CHANNELS_MAX];
+#endif
 	} state;
 };
 
@@ -155,6 +155,30 @@ int bt_mesh_sensor_srv_pub(struct bt_mesh_sensor_srv *srv,
 int bt_mesh_sensor_srv_sample(struct bt_mesh_sensor_srv *srv,
 			      struct bt_mesh_sensor *sensor);
 
+/** @brief Push a new sensor value to the server's value cache.
+ *
+ *  Stores the value as the sensor's current value. From then on, the server
+ *  uses the cached value in responses and periodic publications instead of
+ *  calling the sensor's get callback. The value is only evaluated against the
+ *  sensor's delta thresholds in the next periodic publication if it differs
+ *  from the previously pushed value.
+ *
+ *  Requires @kconfig{CONFIG_BT_MESH_SENSOR_SRV_VALUE_CACHE}.
+ *
+ *  @param[in] srv    Sensor server instance.
+ *  @param[in] sensor Sensor instance to update.
+ *  @param[in] value  Sensor value, interpreted as an array of sensor channel
+ *                    values matching the sensor channels specified by the
+ *                    sensor type.
+ *
+ *  @retval 0        The value was stored.
+ *  @retval -EINVAL  The value formats do not match the sensor channels.
+ *  @retval -ENOTSUP The value cache is not enabled.
+ */
+int bt_mesh_sensor_srv_value_update(struct bt_mesh_sensor_srv *srv,
+				    struct bt_mesh_sensor *sensor,
+				    const struct bt_mesh_sensor_value *value);
+
 /** @cond INTERNAL_HIDDEN */
 extern const struct bt_mesh_model_cb _bt_mesh_sensor_srv_cb;
 extern const struct bt_mesh_model_op _bt_mesh_sensor_srv_op[];
@@ -562,6 +562,55 @@ int bt_scan_blocklist_device_add(const bt_addr_le_t *addr);
  */
 void bt_scan_blocklist_clear(void);
 
+/** @brief Scanning statistics. */
+struct bt_scan_stats {
+	/** Number of advertising reports processed. */
+	uint32_t reports;
+
+	/** Number of reports that matched the filters. */
+	uint32_t filter_matches;
+
+	/** Number of reports that did not match the filters. */
+	uint32_t filter_no_matches;
+
+	/** Number of reports that matched the address filter. */
+	uint32_t addr_matches;
+
+	/** Number of reports that matched the name filter. */
+	uint32_t name_matches;
+
+	/** Number of reports that matched the short name filter. */
+	uint32_t short_name_matches;
+
+	/** Number of reports that matched the UUID filter. */
+	uint32_t uuid_matches;
+
+	/** Number of reports that matched the appearance filter. */
+	uint32_t appearance_matches;
+
+	/** Number of reports that matched the manufacturer data filter. */
+	uint32_t manufacturer_data_matches;
+};
+
+/**@brief Function for getting the scanning statistics.
+ *
+ * @details Requires the @kconfig{CONFIG_BT_SCAN_STATS} option.
+ *          Reports of the blocklist devices are not counted
+ *          as filter matches or filter no matches.
+ *
+ * @param[out] stats Pointer to the statistics structure.
+ *
+ * @return 0 If the operation was successful. Otherwise, a (negative) error
+ *	     code is returned.
+ */
+int bt_scan_stats_get(struct bt_scan_stats *stats);
+
+/**@brief Function for resetting the scanning statistics.
+ *
+ * @details Requires the @kconfig{CONFIG_BT_SCAN_STATS} option.
+ */
+void bt_scan_stats_reset(void);
+
 /**@brief Function to update the autoconnect flag after a filter match.
  *
  * @note The function should not be used when scanning is active.
@@ -31,17 +31,35 @@ struct data_fifo_msgq {
 	size_t size;
 };
 
+/* Ring indices used by a single-producer/single-consumer data_fifo.
+ * The producer owns alloc_idx and lock_idx, the consumer owns get_idx and free_idx.
+ * The *_waiting flags are only set while a thread is blocked on the matching semaphore.
+ */
+struct data_fifo_spsc {
+	atomic_t alloc_idx;
+	atomic_t lock_idx;
+	atomic_t get_idx;
+	atomic_t free_idx;
+	atomic_t vacant_waiting;
+	atomic_t filled_waiting;
+	struct k_sem vacant_sem;
+	struct k_sem filled_sem;
+};
+
 struct data_fifo {
 	char *msgq_buffer;
 	char *slab_buffer;
 	struct k_mem_slab mem_slab;
 	struct k_msgq msgq;
+	struct k_spinlock lock;
+	struct data_fifo_spsc spsc;
 	uint32_t elements_max;
 	size_t block_size_max;
+	bool single_producer_consumer;
 	bool initialized;
 };
 
-#define DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in)                                 \
+#define _DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in, spsc_in)                       \
 	char __aligned(WB_UP(                                                                      \
 		1)) _msgq_buffer_##name[(elements_max_in) * sizeof(struct data_fifo_msgq)] = {0};  \
 	char __aligned(WB_UP(1)) _slab_buffer_##name[(elements_max_in) * (block_size_max_in)] = {  \
@@ -50,8 +68,35 @@ struct data_fifo {
 				 .slab_buffer = _slab_buffer_##name,                               \
 				 .block_size_max = block_size_max_in,                              \
 				 .elements_max = elements_max_in,                                  \
+				 .single_producer_consumer = spsc_in,                              \
 				 .initialized = false}
 
+#define DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in)                                 \
+	_DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in, false)
+
+/**
+ * @brief Define a single-producer/single-consumer data_fifo.
+ *
+ * The FIFO has the same API as one defined with DATA_FIFO_DEFINE, but the blocks are handed
+ * out from a lock-free ring instead of a memory slab and a message queue. This is intended for
+ * the common case where one context (for example an ISR) fills blocks and one thread consumes
+ * them.
+ *
+ * The following restrictions apply:
+ * - Only one context may call data_fifo_pointer_first_vacant_get() and data_fifo_block_lock(),
+ *   and only one context may call data_fifo_pointer_last_filled_get() and
+ *   data_fifo_block_free().
+ * - Blocks must be locked in the order they were allocated, and freed in the order they were
+ *   retrieved.
+ * - data_fifo_empty() must not run concurrently with the producer or the consumer.
+ *
+ * @param name Name of the data_fifo structure.
+ * @param elements_max_in Number of blocks in the FIFO.
+ * @param block_size_max_in Size of each block in bytes.
+ */
+#define DATA_FIFO_SPSC_DEFINE(name, elements_max_in, block_size_max_in)                            \
+	_DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in, true)
+
 /**
  * @brief Get pointer to the first vacant block in slab.
  *
@@ -111,6 +156,8 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size);
  *	or K_FOREVER to wait as long as necessary.
  *
  * @retval 0		Memory pointer retrieved.
+ * @retval -ENOMSG	No filled block available and K_NO_WAIT was given.
+ * @retval -EAGAIN	No filled block available within the timeout.
  * @retval value	Return values from k_msgq_get.
  */
 int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
@@ -33,7 +33,9 @@
  *    writers have been registered will be ignored.
  * 3. Pass subsequent downloaded chunks of the package to @c dfu_multi_image_write
  *    function. The chunks must be provided in order. Note that if the function returns
- *    an error, no more chunks shall be provided.
+ *    an error, no more chunks shall be provided. As soon as the header is parsed, the
+ *    @c prepare function of each writer is called, so that all target areas can be
+ *    prepared before the first image data arrives.
  * 4. Call @c dfu_multi_image_done function to release open resources and verify that all
  *    data declared in the header have been written properly.
  *
@@ -51,6 +53,7 @@ extern "C" {
 typedef int (*dfu_image_open_t)(int image_id, size_t image_size);
 typedef int (*dfu_image_write_t)(const uint8_t *chunk, size_t chunk_size);
 typedef int (*dfu_image_close_t)(bool success);
+typedef int (*dfu_image_prepare_t)(int image_id, size_t image_size);
 
 /**
  * @brief User-provided functions for writing a single image from DFU Multi Image package.
@@ -93,6 +96,45 @@ struct dfu_image_writer {
 	 * @return 0        On success.
 	 */
 	dfu_image_close_t close;
+
+	/**
+	 * @brief Optional function called when the package header has been parsed.
+	 *
+	 * The function is called for all images with a registered writer, in the package
+	 * order, before the first byte of any image is written. It allows the writer to
+	 * start erasing its target area ahead of the data, for example from a work queue,
+	 * so that the erase of the second image overlaps with writing the first one.
+	 * If the preparation runs in the background, the @c open function shall wait
+	 * for it to complete.
+	 *
+	 * The function is indirectly called by @c dfu_multi_image_write and in the case
+	 * of failure the error code is propagated and returned from the latter function.
+	 *
+	 * @return negative On failure.
+	 * @return 0        On success.
+	 */
+	dfu_image_prepare_t prepare;
+};
+
+/**
+ * @brief Write statistics of a single image from DFU Multi Image package.
+ *
+ * The write and elapsed times allow to compute the throughput of the image writer
+ * and the effective throughput of the whole update path, respectively.
+ */
+struct dfu_image_stats {
+	/** Identifier of the image. */
+	int image_id;
+	/** Size of the image declared in the package header. */
+	size_t image_size;
+	/** Number of image bytes written so far. */
+	size_t bytes_written;
+	/** Time spent in the @c prepare function of the writer. */
+	uint32_t prepare_time_us;
+	/** Time spent in the @c open, @c write and @c close functions of the writer. */
+	uint32_t write_time_us;
+	/** Time from opening the image until it was closed, or until now if not closed. */
+	uint32_t elapsed_time_us;
 };
 
 /**
@@ -178,6 +220,22 @@ size_t dfu_multi_image_offset(void);
  */
 int dfu_multi_image_done(bool success);
 
+/**
+ * @brief Get write statistics of an image from DFU Multi Image package.
+ *
+ * Requires the @c CONFIG_DFU_MULTI_IMAGE_STATS Kconfig option. The statistics are
+ * reset by @c dfu_multi_image_init.
+ *
+ * @param[in] image_no Index of the image in the package header.
+ * @param[out] stats Statistics of the image.
+ *
+ * @return -ENOTSUP If collecting the statistics is disabled.
+ * @return -ENOENT  If the package header has not been parsed or there is no such image.
+ * @return -EINVAL  If @c stats is NULL.
+ * @return 0        On success.
+ */
+int dfu_multi_image_stats_get(size_t image_no, struct dfu_image_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -38,14 +38,19 @@ enum dfu_target_image_type {
 	DFU_TARGET_IMAGE_TYPE_SMP = 8,
 	/** SUIT Envelope */
 	DFU_TARGET_IMAGE_TYPE_SUIT = 16,
+	/** Delta patch against the running application in MCUBoot format.
+	 *  Supported only if CONFIG_DFU_TARGET_MCUBOOT_DELTA is enabled.
+	 */
+	DFU_TARGET_IMAGE_TYPE_MCUBOOT_DELTA = 32,
 	/** Any application image type */
-	DFU_TARGET_IMAGE_TYPE_ANY_APPLICATION = DFU_TARGET_IMAGE_TYPE_MCUBOOT,
+	DFU_TARGET_IMAGE_TYPE_ANY_APPLICATION =
+		(DFU_TARGET_IMAGE_TYPE_MCUBOOT | DFU_TARGET_IMAGE_TYPE_MCUBOOT_DELTA),
 	/** Any modem image */
 	DFU_TARGET_IMAGE_TYPE_ANY_MODEM =
 		(DFU_TARGET_IMAGE_TYPE_MODEM_DELTA | DFU_TARGET_IMAGE_TYPE_FULL_MODEM),
 	/** Any DFU image type */
 	DFU_TARGET_IMAGE_TYPE_ANY =
-		(DFU_TARGET_IMAGE_TYPE_MCUBOOT | DFU_TARGET_IMAGE_TYPE_MODEM_DELTA |
+		(DFU_TARGET_IMAGE_TYPE_ANY_APPLICATION | DFU_TARGET_IMAGE_TYPE_MODEM_DELTA |
 		 DFU_TARGET_IMAGE_TYPE_FULL_MODEM),
 };
 
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file dfu_target_mcuboot_delta.h
+ *
+ * @defgroup dfu_target_mcuboot_delta MCUBoot delta DFU Target
+ * @{
+ * @brief DFU Target for MCUBoot upgrades received as a delta patch.
+ *
+ * The patch is applied against the application image in the primary slot
+ * while it is received, and the resulting image is written to the secondary
+ * slot through the MCUBoot DFU target.
+ */
+
+#ifndef DFU_TARGET_MCUBOOT_DELTA_H__
+#define DFU_TARGET_MCUBOOT_DELTA_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+#include <dfu/dfu_target.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Magic word at the start of a delta patch, "DLTA" in ASCII. */
+#define DFU_TARGET_MCUBOOT_DELTA_MAGIC 0x41544c44
+
+/** Version of the delta patch format. */
+#define DFU_TARGET_MCUBOOT_DELTA_VERSION 1
+
+/** Compression of the delta patch payload. */
+enum dfu_target_mcuboot_delta_compression {
+	/** Payload is not compressed. */
+	DFU_TARGET_MCUBOOT_DELTA_COMPRESSION_NONE = 0,
+	/** Payload is compressed with LZMA2. */
+	DFU_TARGET_MCUBOOT_DELTA_COMPRESSION_LZMA2 = 1,
+};
+
+/** @brief Delta patch header, all fields are little endian.
+ *
+ * The header is followed by the payload, which is a sequence of records.
+ * Each record consists of a 32-bit diff length followed by the diff bytes,
+ * which are added to the source image bytes at the source offset,
+ * a 32-bit extra length followed by bytes copied to the target as-is, and
+ * a signed 32-bit adjustment of the source offset.
+ */
+struct dfu_target_mcuboot_delta_header {
+	/** Must be @ref DFU_TARGET_MCUBOOT_DELTA_MAGIC. */
+	uint32_t magic;
+	/** Must be @ref DFU_TARGET_MCUBOOT_DELTA_VERSION. */
+	uint8_t version;
+	/** One of @ref dfu_target_mcuboot_delta_compression. */
+	uint8_t compression;
+	/** Reserved, must be 0. */
+	uint16_t reserved;
+	/** Size of the image the patch applies to. */
+	uint32_t source_size;
+	/** CRC32 (IEEE) of the image the patch applies to. */
+	uint32_t source_crc;
+	/** Size of the resulting image. */
+	uint32_t target_size;
+} __packed;
+
+/**
+ * @brief See if data in buf indicates a delta patch for MCUBoot.
+ *
+ * @retval true if data matches, false otherwise.
+ */
+bool dfu_target_mcuboot_delta_identify(const void *const buf);
+
+/**
+ * @brief Initialize dfu target, perform steps necessary to receive a patch.
+ *
+ * The MCUBoot DFU target buffer must be set with
+ * @ref dfu_target_mcuboot_set_buf before calling this function.
+ *
+ * @param[in] file_size Size of the patch being downloaded.
+ * @param[in] img_num Image pair index, only 0 is supported.
+ * @param[in] cb Callback for signaling events(unused).
+ *
+ * @retval 0 If successful, negative errno otherwise.
+ */
+int dfu_target_mcuboot_delta_init(size_t file_size, int img_num, dfu_target_callback_t cb);
+
+/**
+ * @brief Get offset of the patch.
+ *
+ * Interrupted downloads cannot be resumed. The offset is 0 after
+ * @ref dfu_target_mcuboot_delta_init, so the patch is always downloaded
+ * from the beginning.
+ *
+ * @param[out] offset Returns the number of patch bytes already processed.
+ *
+ * @return 0 if success, otherwise negative value if unable to get the offset
+ */
+int dfu_target_mcuboot_delta_offset_get(size_t *offset);
+
+/**
+ * @brief Write patch data.
+ *
+ * @param[in] buf Pointer to data that should be written.
+ * @param[in] len Length of data to write.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dfu_target_mcuboot_delta_write(const void *const buf, size_t len);
+
+/**
+ * @brief Deinitialize resources and finalize firmware upgrade if successful.
+ *
+ * @param[in] successful Indicate whether the patch was successfully received.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the patch did not produce a complete image.
+ * @return Other negative errno on failure to finalize the image.
+ */
+int dfu_target_mcuboot_delta_done(bool successful);
+
+/**
+ * @brief Schedule update of the image.
+ *
+ * @param[in] img_num Given image pair index or -1 for all
+ *		      of image pair indexes.
+ *
+ * @return 0 for a successful request or a negative error
+ *	   code identicating reason of failure.
+ **/
+int dfu_target_mcuboot_delta_schedule_update(int img_num);
+
+/**
+ * @brief Release resources and erase the download area.
+ *
+ * Cancels any ongoing updates.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dfu_target_mcuboot_delta_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DFU_TARGET_MCUBOOT_DELTA_H__ */
+
+/**@} */
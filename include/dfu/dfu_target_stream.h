@@ -22,6 +22,9 @@
 extern "C" {
 #endif
 
+/** Size of the digest returned by @ref dfu_target_stream_hash_get. */
+#define DFU_TARGET_STREAM_HASH_SIZE 32
+
 struct stream_flash_ctx *dfu_target_stream_get_stream(void);
 
 /** @brief DFU target stream initialization structure. */
@@ -108,6 +111,38 @@ int dfu_target_stream_done(bool successful);
  */
 int dfu_target_stream_reset(void);
 
+/**
+ * @brief Get the SHA-256 digest of the data written to the stream.
+ *
+ * The digest is computed while the data is written and covers everything
+ * passed to @ref dfu_target_stream_write since the start of the download,
+ * including data written before a resumed download. It is available after a
+ * successful call to @ref dfu_target_stream_done and remains valid until the
+ * stream is initialized or reset again.
+ * Requires `CONFIG_DFU_TARGET_STREAM_HASH`.
+ *
+ * @param[out] hash Buffer for the digest.
+ * @param[in] hash_len Length of @p hash, at least
+ *			@ref DFU_TARGET_STREAM_HASH_SIZE bytes.
+ *
+ * @retval 0 on success.
+ * @retval -ENOMEM if @p hash_len is too small.
+ * @retval -ENODATA if no digest is available.
+ * @retval -ENOTSUP if hashing is not enabled.
+ */
+int dfu_target_stream_hash_get(uint8_t *hash, size_t hash_len);
+
+/**
+ * @brief Get the number of flash pages left untouched during the download.
+ *
+ * Pages that were identical to the data already present in flash are
+ * neither erased nor written when `CONFIG_DFU_TARGET_STREAM_SKIP_UNCHANGED`
+ * is enabled. The counter is cleared when the stream is initialized.
+ *
+ * @return Number of skipped pages, always 0 if the option is disabled.
+ */
+size_t dfu_target_stream_skipped_pages_get(void);
+
 #ifdef __cplusplus
 }
 #endif
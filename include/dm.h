@@ -148,6 +148,30 @@ struct dm_request {
 	uint32_t extra_window_time_us;
 };
 
+/** @brief Ranging statistics of a peer. */
+struct dm_peer_stats {
+	/** Bluetooth LE device address. */
+	bt_addr_le_t bt_addr;
+
+	/** Number of timeslots scheduled for the peer. */
+	uint32_t scheduled;
+
+	/** Number of requests that could not be scheduled. */
+	uint32_t rejected;
+
+	/** Number of successful rangings. */
+	uint32_t completed;
+
+	/** Number of failed rangings. */
+	uint32_t failed;
+
+	/** Number of timeslots dropped because their start time had already passed. */
+	uint32_t missed;
+
+	/** Rate of successful rangings, in millihertz. */
+	uint32_t rate_mhz;
+};
+
 /** @brief Initialize the DM.
  *
  *  Initialize the DM by specifying a list of supported operations.
@@ -170,6 +194,20 @@ int dm_init(struct dm_init_param *init_param);
  */
 int dm_request_add(struct dm_request *req);
 
+/** @brief Get the ranging statistics of a peer.
+ *
+ *  The statistics are collected from the first request added for the peer.
+ *  The rate is measured between the first and the last successful ranging.
+ *
+ *  @param[in] bt_addr Bluetooth LE device address of the peer.
+ *  @param[out] stats Ranging statistics of the peer.
+ *
+ *  @retval 0 if the operation was successful.
+ *  @retval -EINVAL when a parameter is NULL.
+ *  @retval -ENOENT when no request was added for the peer.
+ */
+int dm_peer_stats_get(const bt_addr_le_t *bt_addr, struct dm_peer_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -118,6 +118,10 @@ int ei_wrapper_clear_data(bool *cancelled);
  * If there is not enough data in the input buffer, the prediction start is
  * delayed until the missing data is added.
  *
+ * If @kconfig{CONFIG_EI_WRAPPER_CONTINUOUS} is enabled and the input window is
+ * shifted by a multiple of the slice size, only the slices shifted into the
+ * input window are processed.
+ *
  * @param[in] window_shift  Number of windows the input window is shifted before
  *                          prediction.
  * @param[in] frame_shift   Number of frames the input window is shifted before
@@ -175,6 +179,9 @@ int ei_wrapper_get_anomaly(float *anomaly);
  * If calculating the anomaly value is not supported, anomaly_time is set to
  * the value of -1.
  *
+ * If @kconfig{CONFIG_EI_WRAPPER_CONTINUOUS} is enabled, the execution times
+ * are summed over all slices processed for the prediction.
+ *
  * @param[out] dsp_time            Pointer to the variable that is used to store
  *                                 the dsp time.
  * @param[out] classification_time Pointer to the variable that is used to store
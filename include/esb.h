@@ -417,6 +417,67 @@ int esb_write_payload(const struct esb_payload *payload);
  */
 int esb_read_rx_payload(struct esb_payload *payload);
 
+/** @brief Reserve a TX FIFO entry to be filled in place.
+ *
+ *  Use this function instead of @ref esb_write_payload to avoid copying the
+ *  payload. Fill the pipe, length, noack and data fields of the reserved
+ *  payload and pass it to @ref esb_tx_payload_commit to queue it for
+ *  transmission. Only one entry can be reserved at a time. Flushing the TX
+ *  FIFO cancels the reservation.
+ *
+ *  This function is available only in PTX mode.
+ *
+ *  @param[out] payload	Pointer to the reserved payload.
+ *
+ * @retval 0 If successful.
+ * @retval -EBUSY If an entry is already reserved.
+ * @retval -ENOMEM If the TX FIFO is full.
+ * @retval -ENOTSUP If the module is not in PTX mode.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_tx_payload_reserve(struct esb_payload **payload);
+
+/** @brief Queue the reserved TX FIFO entry for transmission.
+ *
+ *  The reservation is released also if the payload is invalid.
+ *
+ *  @param[in] payload	Payload obtained with @ref esb_tx_payload_reserve.
+ *
+ * @retval 0 If successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_tx_payload_commit(struct esb_payload *payload);
+
+/** @brief Get the number of payloads in the TX FIFO.
+ *
+ *  In PTX mode, payloads are removed from the TX FIFO in order, when they
+ *  are acknowledged, so the value can be used to track delivery.
+ *
+ *  @return Number of payloads in the TX FIFO.
+ */
+uint32_t esb_tx_fifo_count(void);
+
+/** @brief Get the oldest payload from the RX FIFO without copying it.
+ *
+ *  The payload stays valid and in the RX FIFO until
+ *  @ref esb_rx_payload_release is called.
+ *
+ *  @param[out] payload	Pointer to the received payload.
+ *
+ * @retval 0 If successful.
+ * @retval -ENODATA If the RX FIFO is empty.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_rx_payload_get(const struct esb_payload **payload);
+
+/** @brief Remove the oldest payload from the RX FIFO.
+ *
+ * @retval 0 If successful.
+ * @retval -ENODATA If the RX FIFO is empty.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_rx_payload_release(void);
+
 /** @brief Start transmitting data.
  *
  * @retval 0 If successful.
@@ -556,6 +617,19 @@ int esb_set_rf_channel(uint32_t channel);
  */
 int esb_get_rf_channel(uint32_t *channel);
 
+/** @brief Get the maximum length of a payload.
+ *
+ *  With the @ref ESB_PROTOCOL_ESB protocol, the length is limited by the
+ *  configured static payload length.
+ *
+ *  @param[out] length	Maximum payload length, in bytes.
+ *
+ * @retval 0 If successful.
+ * @retval -EACCES If the module is not initialized.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_get_max_payload_length(uint32_t *length);
+
 /** @brief Set the radio output power.
  *
  *  @param[in] tx_output_power	Output power in dBm. The @ref esb_tx_power values can be used
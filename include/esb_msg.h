@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef __ESB_MSG_H
+#define __ESB_MSG_H
+
+#include <stddef.h>
+#include <esb.h>
+
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup esb_msg Enhanced ShockBurst message transport
+ * @{
+ *
+ * @brief Transport of messages longer than a single Enhanced ShockBurst
+ *        payload.
+ *
+ * Messages are split into fragments, each sent in a separate payload, and
+ * reassembled on the receiving side. Every pipe can have one message being
+ * sent and one message being received at a time.
+ *
+ * Up to @kconfig{CONFIG_ESB_MSG_TX_WINDOW} fragments are queued in the TX
+ * FIFO at a time. When the transmission of a fragment fails, only the
+ * fragments that were not acknowledged are transmitted again.
+ *
+ * The message transport uses the TX and RX FIFOs of the module exclusively.
+ * The application must not write or read payloads directly while the
+ * message transport is used.
+ */
+
+/** @brief Size of the fragment header. */
+#define ESB_MSG_FRAG_HDR_LEN 5
+
+/** @brief Number of message bytes carried in a single fragment. */
+#define ESB_MSG_FRAG_DATA_LEN (CONFIG_ESB_MAX_PAYLOAD_LENGTH - ESB_MSG_FRAG_HDR_LEN)
+
+/** @brief Message transport callbacks.
+ *
+ * The callbacks are called from the Enhanced ShockBurst event handler
+ * context.
+ */
+struct esb_msg_cb {
+	/** @brief Message transmission finished.
+	 *
+	 * @param[in] pipe	Pipe used to send the message.
+	 * @param[in] err	0 if all fragments were acknowledged,
+	 *			negative error code otherwise.
+	 */
+	void (*sent)(uint8_t pipe, int err);
+
+	/** @brief Message received.
+	 *
+	 * @param[in] pipe	Pipe the message was received on.
+	 * @param[in] data	Message data, valid only in the callback.
+	 * @param[in] len	Message length.
+	 */
+	void (*received)(uint8_t pipe, const uint8_t *data, size_t len);
+};
+
+/** @brief Message transport statistics. */
+struct esb_msg_stats {
+	uint32_t tx_msgs;		/**< Messages sent successfully. */
+	uint32_t tx_failed;		/**< Messages that failed to be sent. */
+	uint32_t tx_frags;		/**< Fragments acknowledged. */
+	uint32_t tx_retransmits;	/**< Transmissions restarted after a failure. */
+	uint32_t rx_msgs;		/**< Messages received. */
+	uint32_t rx_frags;		/**< Fragments received, including duplicates. */
+	uint32_t rx_dropped;		/**< Incomplete messages dropped. */
+	uint32_t rx_invalid;		/**< Invalid payloads. */
+};
+
+/** @brief Initialize the message transport.
+ *
+ * The Enhanced ShockBurst module must be initialized before this function
+ * is called. Messages that are being sent or received are dropped.
+ *
+ * @param[in] cb	Callbacks.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL If the module is configured with a payload length shorter
+ *         than @kconfig{CONFIG_ESB_MAX_PAYLOAD_LENGTH}.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_msg_init(const struct esb_msg_cb *cb);
+
+/** @brief Send a message.
+ *
+ * The message data is not copied. It must stay valid until the
+ * @ref esb_msg_cb.sent callback is called. Messages can be sent only in PTX
+ * mode.
+ *
+ * @param[in] pipe	Pipe to send the message on.
+ * @param[in] data	Message data.
+ * @param[in] len	Message length, up to @kconfig{CONFIG_ESB_MSG_MAX_SIZE}
+ *			bytes.
+ *
+ * @retval 0 If successful.
+ * @retval -EBUSY If a message is already being sent on the pipe.
+ * @retval -EMSGSIZE If the message is too long.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_msg_send(uint8_t pipe, const uint8_t *data, size_t len);
+
+/** @brief Pass an Enhanced ShockBurst event to the message transport.
+ *
+ * Call this function from the event handler registered in @ref esb_init.
+ * The function empties the RX FIFO.
+ *
+ * @param[in] event	Enhanced ShockBurst event.
+ */
+void esb_msg_event_handle(const struct esb_evt *event);
+
+/** @brief Get the message transport statistics.
+ *
+ * @param[out] stats	Statistics.
+ */
+void esb_msg_stats_get(struct esb_msg_stats *stats);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ESB_MSG_H */
@@ -112,5 +112,47 @@ int event_manager_proxy_start(void);
  */
 int event_manager_proxy_wait_for_remotes(k_timeout_t timeout);
 
+/** @brief Event forwarding statistics of a remote. */
+struct event_manager_proxy_stats {
+	/** Number of events sent to the remote. */
+	uint32_t tx_events;
+	/** Number of frames sent to the remote. */
+	uint32_t tx_frames;
+	/** Number of bytes sent to the remote. */
+	uint32_t tx_bytes;
+	/** Number of events dropped because they could not be sent. */
+	uint32_t tx_dropped;
+	/** Number of events received from the remote. */
+	uint32_t rx_events;
+	/** Number of frames received from the remote. */
+	uint32_t rx_frames;
+};
+
+/**
+ * @brief Get event forwarding statistics of a remote.
+ *
+ * Requires @kconfig{CONFIG_EVENT_MANAGER_PROXY_STATS}.
+ *
+ * @param instance Remote IPC instance.
+ * @param stats    Statistics of the remote.
+ *
+ * @retval 0 On success.
+ * @retval -ENOENT The remote was not added.
+ */
+int event_manager_proxy_stats_get(const struct device *instance,
+				  struct event_manager_proxy_stats *stats);
+
+/**
+ * @brief Reset event forwarding statistics of a remote.
+ *
+ * Requires @kconfig{CONFIG_EVENT_MANAGER_PROXY_STATS}.
+ *
+ * @param instance Remote IPC instance.
+ *
+ * @retval 0 On success.
+ * @retval -ENOENT The remote was not added.
+ */
+int event_manager_proxy_stats_reset(const struct device *instance);
+
 /** @} */
 #endif /* _EVENT_MANAGER_PROXY_H_ */
@@ -14,6 +14,7 @@
 #include <modem/at_params.h>
 /* Include to use the __deprecated attribute */
 #include <zephyr/toolchain.h>
+#include <zephyr/sys/util.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -50,6 +51,9 @@ extern "C" {
 /** SNR offset value. */
 #define SNR_OFFSET_VAL 24
 
+/** IP address string in a snapshot can be up to 45 characters long. */
+#define MODEM_INFO_SNAPSHOT_IP_ADDR_SIZE 46
+
 /** @brief Converts RSRP index value returned by the modem to dBm.
  *
  * The index value of RSRP can be converted to dBm with the following formula:
@@ -216,6 +220,42 @@ struct modem_param_info {
 	struct device_param  device;/**< Device parameters. */
 };
 
+/**@brief Parameters of a modem information snapshot. */
+enum modem_info_snapshot_param {
+	MODEM_INFO_SNAPSHOT_RSRP	= BIT(0), /**< RSRP. */
+	MODEM_INFO_SNAPSHOT_SNR		= BIT(1), /**< Signal-to-noise ratio. */
+	MODEM_INFO_SNAPSHOT_BAND	= BIT(2), /**< Current band. */
+	MODEM_INFO_SNAPSHOT_OPERATOR	= BIT(3), /**< Operator name. */
+	MODEM_INFO_SNAPSHOT_TEMP	= BIT(4), /**< Internal temperature. */
+	MODEM_INFO_SNAPSHOT_BATTERY	= BIT(5), /**< Battery voltage. */
+	MODEM_INFO_SNAPSHOT_CONN_STATS	= BIT(6), /**< Connectivity statistics. */
+	MODEM_INFO_SNAPSHOT_IP_ADDRESS	= BIT(7), /**< IP address. */
+};
+
+/**@brief Modem information snapshot. */
+struct modem_info_snapshot {
+	/** Bitmask of the valid parameters, see @ref modem_info_snapshot_param. */
+	uint32_t valid;
+	/** RSRP, in dBm. */
+	int rsrp;
+	/** Signal-to-noise ratio, in dB. */
+	int snr;
+	/** Current band. */
+	uint8_t band;
+	/** Short operator name. */
+	char operator_name[MODEM_INFO_SHORT_OP_NAME_SIZE];
+	/** Internal temperature, in degrees Celsius. */
+	int temperature;
+	/** Battery voltage, in mV. */
+	int battery_voltage;
+	/** Number of kilobytes transmitted. */
+	int tx_kbytes;
+	/** Number of kilobytes received. */
+	int rx_kbytes;
+	/** IP address of the first PDN connection that has an address. */
+	char ip_address[MODEM_INFO_SNAPSHOT_IP_ADDR_SIZE];
+};
+
 /** @brief Initialize the modem information module.
  *
  * @retval 0 If the operation was successful.
@@ -482,6 +522,35 @@ int modem_info_get_operator(char *buf, size_t buf_size);
  */
 int modem_info_get_snr(int *val);
 
+/**
+ * @brief Obtain a snapshot of several modem parameters.
+ *
+ * The requested parameters are read with a single AT command line, which
+ * chains the required AT commands. The RSRP, SNR, band, and operator name are
+ * all read from the response of the AT%XMONITOR command.
+ *
+ * If @p allow_cached is set and @kconfig{CONFIG_MODEM_INFO_SNAPSHOT_CACHE} is
+ * enabled, parameters read less than
+ * @kconfig{CONFIG_MODEM_INFO_SNAPSHOT_CACHE_MAX_AGE} seconds ago are served
+ * from the cache. The cached RSRP is updated by %CESQ notifications, and the
+ * cached network parameters are dropped on +CEREG notifications.
+ *
+ * Parameters that are not available, for example because the device is not
+ * registered to a network or the modem rejected the command reading them, are
+ * not set in the valid mask of @p snapshot.
+ *
+ * @param params Bitmask of the requested parameters, see
+ *               @ref modem_info_snapshot_param.
+ * @param allow_cached Allow serving parameters from the cache.
+ * @param snapshot Pointer to the target snapshot.
+ *
+ * @retval 0 if the operation was successful.
+ * @retval -EINVAL if no parameters were requested or @p snapshot is NULL.
+ * @retval -EIO if the AT commands could not be sent.
+ */
+int modem_info_snapshot_get(uint32_t params, bool allow_cached,
+			    struct modem_info_snapshot *snapshot);
+
 /** @} */
 
 #ifdef __cplusplus
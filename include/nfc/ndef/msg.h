@@ -78,6 +78,71 @@ void nfc_ndef_msg_clear(struct nfc_ndef_msg_desc *msg);
 int nfc_ndef_msg_record_add(struct nfc_ndef_msg_desc *msg,
 			    struct nfc_ndef_record_desc const *record);
 
+/**
+ * @brief Incremental NDEF message encoder.
+ *
+ * Encodes records one by one directly into the message buffer, without
+ * keeping an array of record descriptors. Initialize it with
+ * @ref nfc_ndef_msg_encoder_init and do not modify its members directly.
+ */
+struct nfc_ndef_msg_encoder {
+	/** Message destination. */
+	uint8_t *buf;
+	/** Size of the message destination. */
+	uint32_t size;
+	/** Size of the message encoded so far. */
+	uint32_t len;
+	/** Offset of the last encoded record. */
+	uint32_t last_record;
+	/** Number of encoded records. */
+	uint32_t record_count;
+};
+
+/**
+ * @brief Initialize an incremental NDEF message encoder.
+ *
+ * To encode the message directly into an NDEF file of the Type 4 Tag, pass
+ * the NDEF message location returned by nfc_t4t_ndef_file_msg_get() and the
+ * size returned by nfc_t4t_ndef_file_msg_size_get().
+ *
+ * @param encoder Pointer to the encoder.
+ * @param msg_buffer Pointer to the message destination.
+ * @param msg_buffer_size Size of the available memory for the message.
+ */
+void nfc_ndef_msg_encoder_init(struct nfc_ndef_msg_encoder *encoder,
+			       uint8_t *msg_buffer,
+			       uint32_t msg_buffer_size);
+
+/**
+ * @brief Encode a record at the end of the message.
+ *
+ * The record is encoded immediately, so the record descriptor and its payload
+ * data do not need to outlive this call.
+ *
+ * @param encoder Pointer to the encoder.
+ * @param record Pointer to the record descriptor.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -ENOSR If the record does not fit into the message buffer.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int nfc_ndef_msg_encoder_record_add(struct nfc_ndef_msg_encoder *encoder,
+				    struct nfc_ndef_record_desc const *record);
+
+/**
+ * @brief Finish an incrementally encoded NDEF message.
+ *
+ * Marks the last added record as the last record of the message.
+ *
+ * @param encoder Pointer to the encoder.
+ * @param msg_len Size of the generated message as output.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -ENODATA If no record was added to the message.
+ */
+int nfc_ndef_msg_encoder_finish(struct nfc_ndef_msg_encoder *encoder,
+				uint32_t *msg_len);
+
 /**
  * @brief Macro for creating and initializing an NFC NDEF message descriptor.
  *
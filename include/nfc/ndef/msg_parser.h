@@ -15,6 +15,7 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <zephyr/types.h>
 #include <nfc/ndef/record_parser.h>
 #include <nfc/ndef/msg.h>
@@ -86,6 +87,55 @@ int nfc_ndef_msg_parse(uint8_t  *result_buf,
 		       const uint8_t *raw_data,
 		       uint32_t *raw_data_len);
 
+/** @brief NDEF message iterator.
+ *
+ *  Walks the records of a raw NDEF message in place. Initialize it with
+ *  @ref nfc_ndef_msg_iter_init and do not modify its members directly.
+ */
+struct nfc_ndef_msg_iter {
+	/** Raw NDEF message data. */
+	const uint8_t *data;
+	/** Size of the raw NDEF message data. */
+	uint32_t data_len;
+	/** Offset of the next record within the raw data. */
+	uint32_t offset;
+	/** Number of records returned so far. */
+	uint32_t record_count;
+	/** Set when the last record of the message has been returned. */
+	bool done;
+};
+
+/** @brief Initialize an NDEF message iterator.
+ *
+ *  @param[out] iter Pointer to the iterator.
+ *  @param[in] raw_data Pointer to the NDEF message to iterate over.
+ *  @param[in] raw_data_len Size of the NFC data in the @p raw_data buffer.
+ */
+void nfc_ndef_msg_iter_init(struct nfc_ndef_msg_iter *iter,
+			    const uint8_t *raw_data,
+			    uint32_t raw_data_len);
+
+/** @brief Get the next record of an NDEF message.
+ *
+ *  The record is not copied. The fields of @p record point into the raw data
+ *  passed to @ref nfc_ndef_msg_iter_init. No descriptor memory is needed, so
+ *  messages with any number of records can be processed.
+ *
+ *  After the last record has been returned, the @c offset member of
+ *  the iterator holds the size of the parsed message.
+ *
+ *  @param[in,out] iter Pointer to the iterator.
+ *  @param[out] record Pointer to the record view that will be filled.
+ *
+ *  @retval 0 If the record was parsed successfully.
+ *  @retval -ENOENT If the last record of the message was already returned.
+ *  @retval -EINVAL If the record does not fit into the NFC data.
+ *  @retval -EFAULT If the record location flags are invalid or the data ends
+ *                  before the last record of the message.
+ */
+int nfc_ndef_msg_iter_next(struct nfc_ndef_msg_iter *iter,
+			   struct nfc_ndef_record_view *record);
+
 /** @brief Print the parsed contents of an NDEF message.
  *
  *  @param[in] msg_desc Pointer to the descriptor of the message that should
@@ -21,6 +21,49 @@ extern "C" {
  *  @brief Parser for NFC NDEF records.
  */
 
+/** @brief View of an NDEF record.
+ *
+ *  All pointers reference the raw NFC data that was parsed. Nothing is copied,
+ *  so the view is only valid as long as the raw data is.
+ */
+struct nfc_ndef_record_view {
+	/** Type name format. */
+	enum nfc_ndef_record_tnf tnf;
+	/** Location of the record within the NDEF message. */
+	enum nfc_ndef_record_location location;
+	/** Length of the type field. */
+	uint8_t type_length;
+	/** Length of the ID field. */
+	uint8_t id_length;
+	/** Pointer to the type field, NULL if the type is empty. */
+	const uint8_t *type;
+	/** Pointer to the ID field, NULL if the record has no ID. */
+	const uint8_t *id;
+	/** Pointer to the payload, NULL if the payload is empty. */
+	const uint8_t *payload;
+	/** Length of the payload. */
+	uint32_t payload_length;
+};
+
+/** @brief Parse an NDEF record into a record view.
+ *
+ *  Unlike @ref nfc_ndef_record_parse, this function does not fill any
+ *  descriptors. The type, ID and payload fields of the view point into
+ *  @p nfc_data.
+ *
+ *  @param[out] view Pointer to the record view that will be filled.
+ *  @param[in] nfc_data Pointer to the raw data to be parsed.
+ *  @param[in,out] nfc_data_len As input: size of the NFC data in the
+ *                              @p nfc_data buffer. As output: size of the
+ *                              parsed record.
+ *
+ *  @retval 0 If the operation was successful.
+ *  @retval -EINVAL If the record does not fit into the NFC data.
+ */
+int nfc_ndef_record_view_parse(struct nfc_ndef_record_view *view,
+			       const uint8_t *nfc_data,
+			       uint32_t *nfc_data_len);
+
 
 /** @brief Parse NDEF records.
  *
@@ -22,6 +22,7 @@
 extern "C" {
 #endif
 
+#include <stddef.h>
 #include <zephyr/types.h>
 
 /** @brief Available generated wave types.
@@ -66,6 +67,93 @@ struct wave_gen_param {
  */
 int wave_gen_generate_value(uint32_t time, const struct wave_gen_param *params, double *out_val);
 
+/** @brief Amplitude of the normalized wave used by @ref wave_gen_sine (Q1.30 format).
+ */
+#define WAVE_GEN_Q30_ONE (1 << 30)
+
+/** @brief Wave block generator.
+ *
+ * Generates blocks of samples of a wave signal using a phase accumulator and
+ * a sine lookup table instead of evaluating trigonometric functions for every
+ * sample. The phase is tracked as an exact fraction, so it does not drift
+ * regardless of the number of generated samples.
+ *
+ * The structure must be initialized with @ref wave_gen_block_init. Its members
+ * must not be modified directly.
+ */
+struct wave_gen_block {
+	/** Parameters of the generated wave signal. */
+	struct wave_gen_param params;
+
+	/** Phase of the next sample, full range of the variable is one period. */
+	uint32_t phase;
+
+	/** Fractional part of the phase, in units of 1/den. */
+	uint32_t phase_rem;
+
+	/** Phase increment per sample. */
+	uint32_t step;
+
+	/** Fractional part of the phase increment, in units of 1/den. */
+	uint32_t step_rem;
+
+	/** Denominator of the fractional parts. */
+	uint32_t den;
+};
+
+/**
+ * @brief Initialize wave block generator.
+ *
+ * @param[out]	block		Wave block generator.
+ * @param[in]	params		Parameters describing generated wave signal.
+ *				The parameters are copied.
+ * @param[in]	time		Time of the first generated sample [ms].
+ * @param[in]	sample_rate_hz	Sampling frequency [Hz].
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL If the parameters are invalid or the product of the wave
+ *                 period and the sampling frequency does not fit in 32 bits.
+ */
+int wave_gen_block_init(struct wave_gen_block *block, const struct wave_gen_param *params,
+			uint32_t time, uint32_t sample_rate_hz);
+
+/**
+ * @brief Generate block of wave values.
+ *
+ * Consecutive calls continue the wave signal where the previous call ended.
+ *
+ * @param[in,out]	block	Wave block generator.
+ * @param[out]		out	Buffer for the generated values.
+ * @param[in]		cnt	Number of values to generate.
+ */
+void wave_gen_block_generate(struct wave_gen_block *block, float *out, size_t cnt);
+
+/**
+ * @brief Generate block of wave values in fixed-point format.
+ *
+ * Works like @ref wave_gen_block_generate, but uses integer arithmetic only.
+ * The offset, amplitude and noise amplitude are rounded to integers. The
+ * generated values are truncated towards zero and saturated to the range of
+ * the int16_t type.
+ *
+ * @param[in,out]	block	Wave block generator.
+ * @param[out]		out	Buffer for the generated values.
+ * @param[in]		cnt	Number of values to generate.
+ */
+void wave_gen_block_generate_s16(struct wave_gen_block *block, int16_t *out, size_t cnt);
+
+/**
+ * @brief Get sine value for given phase using the lookup table.
+ *
+ * The value is exactly antisymmetric, that is
+ * wave_gen_sine(phase + 2^31) == -wave_gen_sine(phase).
+ *
+ * @param[in]	phase	Phase, full range of the variable is one period.
+ *
+ * @return Sine value in Q1.30 format, see @ref WAVE_GEN_Q30_ONE.
+ */
+int32_t wave_gen_sine(uint32_t phase);
+
 #ifdef __cplusplus
 }
 #endif
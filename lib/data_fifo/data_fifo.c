@@ -11,8 +11,6 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(data_fifo, CONFIG_DATA_FIFO_LOG_LEVEL);
 
-static struct k_spinlock lock;
-
 /** @brief Checks that the elements in the msgq and slab are legal.
  * I.e. the number of msgq elements cannot be more than mem blocks used.
  */
@@ -20,12 +18,12 @@ static int msgq_slab_legal_used_elements(struct data_fifo *data_fifo, uint32_t *
 					 uint32_t *slab_blocks_num_used_in)
 {
 	/* Lock so msgq and slab reads are in sync */
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key = k_spin_lock(&data_fifo->lock);
 
 	uint32_t msgq_num_used = k_msgq_num_used_get(&data_fifo->msgq);
 	uint32_t slab_blocks_num_used = k_mem_slab_num_used_get(&data_fifo->mem_slab);
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(&data_fifo->lock, key);
 
 	if (slab_blocks_num_used < msgq_num_used) {
 		LOG_ERR("Num used mgsq %d cannot be larger than used blocks %d", msgq_num_used,
@@ -41,6 +39,186 @@ static int msgq_slab_legal_used_elements(struct data_fifo *data_fifo, uint32_t *
 	return 0;
 }
 
+/* Ring indices wrap at twice the number of elements. This keeps a full ring distinguishable
+ * from an empty one, and slot numbers stay consistent for any number of elements.
+ */
+static inline uint32_t spsc_idx(atomic_t *idx)
+{
+	return (uint32_t)atomic_get(idx);
+}
+
+/* Each index has a single writer, so it can be advanced without a compare-and-swap */
+static inline void spsc_idx_advance(struct data_fifo *data_fifo, atomic_t *idx)
+{
+	uint32_t next = spsc_idx(idx) + 1;
+
+	atomic_set(idx, (next == 2 * data_fifo->elements_max) ? 0 : next);
+}
+
+static inline uint32_t spsc_idx_diff(struct data_fifo *data_fifo, uint32_t a, uint32_t b)
+{
+	return (a >= b) ? (a - b) : (a + 2 * data_fifo->elements_max - b);
+}
+
+static inline void *spsc_block(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return data_fifo->slab_buffer + (idx % data_fifo->elements_max) * data_fifo->block_size_max;
+}
+
+static inline struct data_fifo_msgq *spsc_entry(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return &((struct data_fifo_msgq *)data_fifo->msgq_buffer)[idx % data_fifo->elements_max];
+}
+
+static bool spsc_vacant_available(struct data_fifo *data_fifo)
+{
+	return spsc_idx_diff(data_fifo, spsc_idx(&data_fifo->spsc.alloc_idx),
+			     spsc_idx(&data_fifo->spsc.free_idx)) < data_fifo->elements_max;
+}
+
+static bool spsc_filled_available(struct data_fifo *data_fifo)
+{
+	return spsc_idx(&data_fifo->spsc.lock_idx) != spsc_idx(&data_fifo->spsc.get_idx);
+}
+
+/** @brief Wake up the other side if it is blocked.
+ *
+ * The semaphore is only touched when the peer has announced that it is waiting,
+ * so the uncontended path stays free of kernel locks.
+ */
+static void spsc_notify(atomic_t *waiting, struct k_sem *sem)
+{
+	if (atomic_cas(waiting, 1, 0)) {
+		k_sem_give(sem);
+	}
+}
+
+/** @brief Wait until available() returns true or the timeout expires.
+ *
+ * The waiting flag is raised before the condition is re-checked, and the peer
+ * publishes its index before checking the flag. With both sides using sequentially
+ * consistent atomics, at least one of them observes the other, so no wakeup is lost.
+ */
+static int spsc_wait(struct data_fifo *data_fifo, bool (*available)(struct data_fifo *),
+		     atomic_t *waiting, struct k_sem *sem, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	int ret;
+
+	while (!available(data_fifo)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -ENOMSG;
+		}
+
+		atomic_set(waiting, 1);
+
+		if (available(data_fifo)) {
+			atomic_clear(waiting);
+			break;
+		}
+
+		ret = k_sem_take(sem, sys_timepoint_timeout(end));
+		if (ret) {
+			atomic_clear(waiting);
+			return available(data_fifo) ? 0 : -EAGAIN;
+		}
+	}
+
+	return 0;
+}
+
+static int spsc_first_vacant_get(struct data_fifo *data_fifo, void **data, k_timeout_t timeout)
+{
+	int ret;
+
+	ret = spsc_wait(data_fifo, spsc_vacant_available, &data_fifo->spsc.vacant_waiting,
+			&data_fifo->spsc.vacant_sem, timeout);
+	if (ret) {
+		/* Match the k_mem_slab_alloc() return values */
+		*data = NULL;
+		return (ret == -ENOMSG) ? -ENOMEM : ret;
+	}
+
+	*data = spsc_block(data_fifo, spsc_idx(&data_fifo->spsc.alloc_idx));
+	spsc_idx_advance(data_fifo, &data_fifo->spsc.alloc_idx);
+
+	return 0;
+}
+
+static int spsc_block_lock(struct data_fifo *data_fifo, void *data, size_t size)
+{
+	uint32_t lock_idx = spsc_idx(&data_fifo->spsc.lock_idx);
+	struct data_fifo_msgq *entry;
+
+	if (lock_idx == spsc_idx(&data_fifo->spsc.alloc_idx) ||
+	    data != spsc_block(data_fifo, lock_idx)) {
+		LOG_ERR("Block %p not locked in allocation order", data);
+		return -ESPIPE;
+	}
+
+	entry = spsc_entry(data_fifo, lock_idx);
+	entry->block_ptr = data;
+	entry->size = size;
+
+	/* Publish the entry to the consumer */
+	spsc_idx_advance(data_fifo, &data_fifo->spsc.lock_idx);
+	spsc_notify(&data_fifo->spsc.filled_waiting, &data_fifo->spsc.filled_sem);
+
+	return 0;
+}
+
+static int spsc_last_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
+				k_timeout_t timeout)
+{
+	uint32_t get_idx;
+	struct data_fifo_msgq *entry;
+	int ret;
+
+	ret = spsc_wait(data_fifo, spsc_filled_available, &data_fifo->spsc.filled_waiting,
+			&data_fifo->spsc.filled_sem, timeout);
+	if (ret) {
+		return ret;
+	}
+
+	get_idx = spsc_idx(&data_fifo->spsc.get_idx);
+	entry = spsc_entry(data_fifo, get_idx);
+
+	*data = entry->block_ptr;
+	*size = entry->size;
+
+	spsc_idx_advance(data_fifo, &data_fifo->spsc.get_idx);
+
+	return 0;
+}
+
+static void spsc_block_free(struct data_fifo *data_fifo, void *data)
+{
+	uint32_t free_idx = spsc_idx(&data_fifo->spsc.free_idx);
+
+	if (free_idx == spsc_idx(&data_fifo->spsc.get_idx) ||
+	    data != spsc_block(data_fifo, free_idx)) {
+		LOG_ERR("Block %p not freed in retrieval order", data);
+		__ASSERT_NO_MSG(false);
+		return;
+	}
+
+	/* Hand the block back to the producer */
+	spsc_idx_advance(data_fifo, &data_fifo->spsc.free_idx);
+	spsc_notify(&data_fifo->spsc.vacant_waiting, &data_fifo->spsc.vacant_sem);
+}
+
+static void spsc_reset(struct data_fifo *data_fifo)
+{
+	atomic_clear(&data_fifo->spsc.alloc_idx);
+	atomic_clear(&data_fifo->spsc.lock_idx);
+	atomic_clear(&data_fifo->spsc.get_idx);
+	atomic_clear(&data_fifo->spsc.free_idx);
+	atomic_clear(&data_fifo->spsc.vacant_waiting);
+	atomic_clear(&data_fifo->spsc.filled_waiting);
+	k_sem_reset(&data_fifo->spsc.vacant_sem);
+	k_sem_reset(&data_fifo->spsc.filled_sem);
+}
+
 int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 				       k_timeout_t timeout)
 {
@@ -48,6 +226,10 @@ int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+	if (data_fifo->single_producer_consumer) {
+		return spsc_first_vacant_get(data_fifo, data, timeout);
+	}
+
 	ret = k_mem_slab_alloc(&data_fifo->mem_slab, data, timeout);
 	return ret;
 }
@@ -66,6 +248,10 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
 		return -EINVAL;
 	}
 
+	if (data_fifo->single_producer_consumer) {
+		return spsc_block_lock(data_fifo, *data, size);
+	}
+
 	struct data_fifo_msgq msgq_tmp;
 
 	msgq_tmp.block_ptr = *data;
@@ -91,6 +277,10 @@ int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+	if (data_fifo->single_producer_consumer) {
+		return spsc_last_filled_get(data_fifo, data, size, timeout);
+	}
+
 	struct data_fifo_msgq msgq_tmp;
 
 	ret = k_msgq_get(&data_fifo->msgq, &msgq_tmp, timeout);
@@ -108,6 +298,11 @@ void data_fifo_block_free(struct data_fifo *data_fifo, void *data)
 	__ASSERT_NO_MSG(data_fifo != NULL);
 	__ASSERT_NO_MSG(data_fifo->initialized);
 
+	if (data_fifo->single_producer_consumer) {
+		spsc_block_free(data_fifo, data);
+		return;
+	}
+
 	k_mem_slab_free(&data_fifo->mem_slab, data);
 }
 
@@ -120,6 +315,19 @@ int data_fifo_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num, u
 	uint32_t msgq_num_used = UINT32_MAX;
 	uint32_t slab_blocks_num_used = UINT32_MAX;
 
+	if (data_fifo->single_producer_consumer) {
+		uint32_t free_idx = spsc_idx(&data_fifo->spsc.free_idx);
+		uint32_t get_idx = spsc_idx(&data_fifo->spsc.get_idx);
+
+		uint32_t lock_idx = spsc_idx(&data_fifo->spsc.lock_idx);
+		uint32_t alloc_idx = spsc_idx(&data_fifo->spsc.alloc_idx);
+
+		*locked_num = spsc_idx_diff(data_fifo, lock_idx, get_idx);
+		*alloced_num = spsc_idx_diff(data_fifo, alloc_idx, free_idx);
+
+		return 0;
+	}
+
 	ret = msgq_slab_legal_used_elements(data_fifo, &msgq_num_used, &slab_blocks_num_used);
 	if (ret) {
 		return ret;
@@ -138,6 +346,11 @@ int data_fifo_empty(struct data_fifo *data_fifo)
 	void *old_data;
 	size_t size;
 
+	if (data_fifo->single_producer_consumer) {
+		spsc_reset(data_fifo);
+		return 0;
+	}
+
 	ret = data_fifo_num_used_get(data_fifo, &fifo_alloced_num, &fifo_locked_num);
 	if (ret) {
 		LOG_ERR("Failed to get num used in FIFO");
@@ -192,6 +405,14 @@ int data_fifo_init(struct data_fifo *data_fifo)
 	__ASSERT_NO_MSG((data_fifo->block_size_max % WB_UP(1)) == 0);
 	int ret;
 
+	if (data_fifo->single_producer_consumer) {
+		k_sem_init(&data_fifo->spsc.vacant_sem, 0, 1);
+		k_sem_init(&data_fifo->spsc.filled_sem, 0, 1);
+		spsc_reset(data_fifo);
+		data_fifo->initialized = true;
+		return 0;
+	}
+
 	k_msgq_init(&data_fifo->msgq, data_fifo->msgq_buffer, sizeof(struct data_fifo_msgq),
 		    data_fifo->elements_max);
 
@@ -33,6 +33,14 @@ BUILD_ASSERT(CONFIG_EI_WRAPPER_THREAD_STACK_SIZE > 0);
 #define THREAD_PRIORITY 	CONFIG_EI_WRAPPER_THREAD_PRIORITY
 #define DEBUG_MODE		IS_ENABLED(CONFIG_EI_WRAPPER_DEBUG_MODE)
 
+#if CONFIG_EI_WRAPPER_CONTINUOUS
+#define SLICE_CNT		EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW
+#define SLICE_SIZE		(INPUT_WINDOW_SIZE / SLICE_CNT)
+
+BUILD_ASSERT(INPUT_WINDOW_SIZE % SLICE_CNT == 0);
+BUILD_ASSERT(SLICE_SIZE % INPUT_FRAME_SIZE == 0);
+#endif /* CONFIG_EI_WRAPPER_CONTINUOUS */
+
 enum state {
 	STATE_DISABLED,
 	STATE_WAITING_FOR_DATA,
@@ -45,6 +53,8 @@ struct data_buffer {
 	size_t process_idx;
 	size_t append_idx;
 	size_t wait_data_size;
+	size_t shift;
+	bool window_valid;
 	struct k_spinlock lock;
 	enum state state;
 };
@@ -58,6 +68,7 @@ static K_SEM_DEFINE(ei_sem, 0, 1);
 static struct data_buffer ei_input;
 static ei_impulse_result_t ei_result;
 static int cur_res_idx;
+static size_t read_offset;
 static ei_wrapper_result_ready_cb user_cb;
 
 
@@ -84,12 +95,13 @@ static size_t buf_calc_free_space(const struct data_buffer *b)
 	return ARRAY_SIZE(b->buf) - buf_get_collected_data_count(b) - 1;
 }
 
-static void buf_processing_end(struct data_buffer *b)
+static void buf_processing_end(struct data_buffer *b, bool window_valid)
 {
 	k_spinlock_key_t key = k_spin_lock(&b->lock);
 
 	__ASSERT_NO_MSG(b->state == STATE_PROCESSING);
 	b->state = STATE_READY;
+	b->window_valid = window_valid;
 
 	k_spin_unlock(&b->lock, key);
 }
@@ -111,6 +123,8 @@ static int buf_cleanup(struct data_buffer *b, bool *cancelled)
 		b->process_idx = 0;
 		b->append_idx = 0;
 		b->wait_data_size = 0;
+		b->shift = 0;
+		b->window_valid = false;
 		b->state = STATE_READY;
 	}
 
@@ -210,6 +224,7 @@ static int buf_processing_move(struct data_buffer *b, size_t move,
 
 	size_t max_move = buf_get_collected_data_count(b);
 
+	b->shift = move;
 	b->process_idx += move;
 	if (b->process_idx >= ARRAY_SIZE(b->buf)) {
 		b->process_idx -= ARRAY_SIZE(b->buf);
@@ -303,42 +318,109 @@ int ei_wrapper_start_prediction(size_t window_shift, size_t frame_shift)
 
 static int raw_feature_get_data(size_t offset, size_t length, float *out_ptr)
 {
-	buf_get(&ei_input, out_ptr, offset, length);
+	buf_get(&ei_input, out_ptr, read_offset + offset, length);
 
 	return 0;
 }
 
+#if CONFIG_EI_WRAPPER_CONTINUOUS
+static size_t buf_get_new_slice_count(const struct data_buffer *b)
+{
+	/* Shift and window validity cannot change while processing is done. */
+	__ASSERT_NO_MSG(b->state == STATE_PROCESSING);
+
+	if (!b->window_valid || (b->shift % SLICE_SIZE)) {
+		return SLICE_CNT;
+	}
+
+	return MIN(b->shift / SLICE_SIZE, SLICE_CNT);
+}
+
+static EI_IMPULSE_ERROR run_impulse(size_t *slice_cnt)
+{
+	signal_t features_signal;
+	EI_IMPULSE_ERROR err = EI_IMPULSE_OK;
+	int sampling_time = 0;
+	int dsp_time = 0;
+	int classification_time = 0;
+	int anomaly_time = 0;
+
+	features_signal.get_data = &raw_feature_get_data;
+	features_signal.total_length = SLICE_SIZE;
+
+	*slice_cnt = buf_get_new_slice_count(&ei_input);
+
+	/* Only the slices that were shifted into the input window are processed.
+	 * Features of the other slices are kept by the library.
+	 */
+	for (size_t i = SLICE_CNT - *slice_cnt; (i < SLICE_CNT) && !err; i++) {
+		read_offset = i * SLICE_SIZE;
+
+		err = run_classifier_continuous(&features_signal, &ei_result, DEBUG_MODE,
+						false);
+
+		sampling_time += ei_result.timing.sampling;
+		dsp_time += ei_result.timing.dsp;
+		classification_time += ei_result.timing.classification;
+		anomaly_time += ei_result.timing.anomaly;
+	}
+
+	read_offset = 0;
+
+	ei_result.timing.sampling = sampling_time;
+	ei_result.timing.dsp = dsp_time;
+	ei_result.timing.classification = classification_time;
+	ei_result.timing.anomaly = anomaly_time;
+
+	return err;
+}
+#else
+static EI_IMPULSE_ERROR run_impulse(size_t *slice_cnt)
+{
+	signal_t features_signal;
+
+	features_signal.get_data = &raw_feature_get_data;
+	features_signal.total_length = INPUT_WINDOW_SIZE;
+
+	*slice_cnt = 1;
+
+	return run_classifier(&features_signal, &ei_result, DEBUG_MODE);
+}
+#endif /* CONFIG_EI_WRAPPER_CONTINUOUS */
+
 static void processing_finished(int err)
 {
 	__ASSERT_NO_MSG(user_cb);
 
-	buf_processing_end(&ei_input);
+	buf_processing_end(&ei_input, !err);
 	cur_res_idx = -1;
 	user_cb(err);
 }
 
 static void edge_impulse_thread_fn(void)
 {
-	signal_t features_signal;
 	int64_t start_time;
+	size_t slice_cnt;
+
+	if (IS_ENABLED(CONFIG_EI_WRAPPER_CONTINUOUS)) {
+		run_classifier_init();
+	}
 
 	while (true) {
 		k_sem_take(&ei_sem, K_FOREVER);
 
-		features_signal.get_data = &raw_feature_get_data;
-		features_signal.total_length = INPUT_WINDOW_SIZE;
-
 		if (IS_ENABLED(CONFIG_EI_WRAPPER_PROFILING)) {
 			start_time = k_uptime_get();
 		}
 
 		/* Invoke the impulse. */
-		EI_IMPULSE_ERROR err = run_classifier(&features_signal,
-						      &ei_result, DEBUG_MODE);
+		EI_IMPULSE_ERROR err = run_impulse(&slice_cnt);
+
 		if (IS_ENABLED(CONFIG_EI_WRAPPER_PROFILING)) {
 			int64_t delta = k_uptime_delta(&start_time);
 
-			LOG_INF("run_classifier execution time: %dms", (int32_t)delta);
+			LOG_INF("run_classifier execution time: %dms (slices: %zu)",
+				(int32_t)delta, slice_cnt);
 			LOG_INF("sampling: %dms dsp: %dms classification: %dms anomaly: %dms",
 				ei_result.timing.sampling,
 				ei_result.timing.dsp,
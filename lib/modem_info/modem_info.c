@@ -7,6 +7,7 @@
 #include <nrf_modem_at.h>
 #include <modem/at_monitor.h>
 #include <modem/at_parser.h>
+#include <modem/nrf_modem_lib.h>
 #include <ctype.h>
 #include <zephyr/device.h>
 #include <errno.h>
@@ -149,6 +150,12 @@ LOG_MODULE_REGISTER(modem_info);
 BUILD_ASSERT(SHORT_OP_NAME_SIZE_WITHOUT_NULL_TERM == (MODEM_INFO_SHORT_OP_NAME_SIZE - 1),
 	     "Short operator size macros must match");
 
+/* Snapshot parameters read from the %XMONITOR response */
+#define SNAPSHOT_NETWORK_PARAMS (MODEM_INFO_SNAPSHOT_RSRP | MODEM_INFO_SNAPSHOT_SNR | \
+				 MODEM_INFO_SNAPSHOT_BAND | MODEM_INFO_SNAPSHOT_OPERATOR)
+#define SNAPSHOT_PARAM_COUNT	8
+#define SNAPSHOT_CMD_SIZE	64
+
 struct modem_info_data {
 	const char *cmd;
 	const char *data_name;
@@ -360,6 +367,66 @@ static const struct modem_info_data *const modem_data[] = {
 
 AT_MONITOR(modem_info_cesq_mon, "%CESQ", modem_info_rsrp_subscribe_handler, PAUSED);
 
+#if CONFIG_MODEM_INFO_SNAPSHOT_CACHE
+AT_MONITOR(modem_info_snapshot_cesq_mon, "%CESQ", snapshot_cesq_handler);
+AT_MONITOR(modem_info_snapshot_cereg_mon, "+CEREG", snapshot_cereg_handler);
+NRF_MODEM_LIB_ON_INIT(modem_info_snapshot_init_hook, snapshot_on_modem_init, NULL);
+#endif /* CONFIG_MODEM_INFO_SNAPSHOT_CACHE */
+
+struct snapshot_cmd {
+	uint32_t params;
+	const char *cmd;
+	const char *rsp_prefix;
+	void (*parse)(const char *rsp, struct modem_info_snapshot *snapshot);
+};
+
+static void snapshot_xmonitor_parse(const char *rsp, struct modem_info_snapshot *snapshot);
+static void snapshot_xtemp_parse(const char *rsp, struct modem_info_snapshot *snapshot);
+static void snapshot_xvbat_parse(const char *rsp, struct modem_info_snapshot *snapshot);
+static void snapshot_xconnstat_parse(const char *rsp, struct modem_info_snapshot *snapshot);
+static void snapshot_cgdcont_parse(const char *rsp, struct modem_info_snapshot *snapshot);
+
+static const struct snapshot_cmd snapshot_cmds[] = {
+	{
+		.params		= SNAPSHOT_NETWORK_PARAMS,
+		.cmd		= "%XMONITOR",
+		.rsp_prefix	= "%XMONITOR: ",
+		.parse		= snapshot_xmonitor_parse,
+	},
+	{
+		.params		= MODEM_INFO_SNAPSHOT_TEMP,
+		.cmd		= "%XTEMP?",
+		.rsp_prefix	= "%XTEMP: ",
+		.parse		= snapshot_xtemp_parse,
+	},
+	{
+		.params		= MODEM_INFO_SNAPSHOT_BATTERY,
+		.cmd		= "%XVBAT",
+		.rsp_prefix	= "%XVBAT: ",
+		.parse		= snapshot_xvbat_parse,
+	},
+	{
+		.params		= MODEM_INFO_SNAPSHOT_CONN_STATS,
+		.cmd		= "%XCONNSTAT?",
+		.rsp_prefix	= "%XCONNSTAT: ",
+		.parse		= snapshot_xconnstat_parse,
+	},
+	{
+		.params		= MODEM_INFO_SNAPSHOT_IP_ADDRESS,
+		.cmd		= "+CGDCONT?",
+		.rsp_prefix	= "+CGDCONT: ",
+		.parse		= snapshot_cgdcont_parse,
+	},
+};
+
+static K_MUTEX_DEFINE(snapshot_mutex);
+static char snapshot_buf[CONFIG_MODEM_INFO_SNAPSHOT_BUFFER_SIZE];
+
+#if CONFIG_MODEM_INFO_SNAPSHOT_CACHE
+static struct modem_info_snapshot snapshot_cache;
+static int64_t snapshot_cache_time[SNAPSHOT_PARAM_COUNT];
+#endif /* CONFIG_MODEM_INFO_SNAPSHOT_CACHE */
+
 static rsrp_cb_t modem_info_rsrp_cb;
 
 static void flip_iccid_string(char *buf)
@@ -992,6 +1059,356 @@ int modem_info_get_snr(int *val)
 	return 0;
 }
 
+static void snapshot_xmonitor_parse(const char *rsp, struct modem_info_snapshot *snapshot)
+{
+	unsigned int band;
+	int rsrp;
+	int snr;
+
+	/* The parameters are only reported when the device is registered. */
+	int ret = sscanf(rsp,
+			 "%%XMONITOR: "
+			 "%*u,"		/* <reg_status> ignored */
+			 "%*[^,],"	/* <full_name> ignored */
+			 "\"%" STRINGIFY(SHORT_OP_NAME_SIZE_WITHOUT_NULL_TERM) "[^\"]\"," /* <short_name> */
+			 "%*[^,],"	/* <plmn> ignored */
+			 "%*[^,],"	/* <tac> ignored */
+			 "%*d,"		/* <AcT> ignored */
+			 "%u,"		/* <band> */
+			 "%*[^,],"	/* <cell_id> ignored */
+			 "%*d,"		/* <phys_cell_id> ignored */
+			 "%*d,"		/* <EARFCN> ignored */
+			 "%d,"		/* <rsrp> */
+			 "%d",		/* <snr> */
+			 snapshot->operator_name, &band, &rsrp, &snr);
+
+	if (ret >= 1) {
+		snapshot->valid |= MODEM_INFO_SNAPSHOT_OPERATOR;
+	}
+
+	if ((ret >= 2) && (band != BAND_UNAVAILABLE) && (band <= UINT8_MAX)) {
+		snapshot->band = band;
+		snapshot->valid |= MODEM_INFO_SNAPSHOT_BAND;
+	}
+
+	if ((ret >= 3) && (rsrp != CELL_RSRP_INVALID)) {
+		snapshot->rsrp = RSRP_IDX_TO_DBM(rsrp);
+		snapshot->valid |= MODEM_INFO_SNAPSHOT_RSRP;
+	}
+
+	if ((ret >= 4) && (snr != SNR_UNAVAILABLE)) {
+		snapshot->snr = snr - SNR_OFFSET_VAL;
+		snapshot->valid |= MODEM_INFO_SNAPSHOT_SNR;
+	}
+}
+
+static void snapshot_xtemp_parse(const char *rsp, struct modem_info_snapshot *snapshot)
+{
+	if (sscanf(rsp, "%%XTEMP: %d", &snapshot->temperature) == 1) {
+		snapshot->valid |= MODEM_INFO_SNAPSHOT_TEMP;
+	}
+}
+
+static void snapshot_xvbat_parse(const char *rsp, struct modem_info_snapshot *snapshot)
+{
+	if (sscanf(rsp, "%%XVBAT: %d", &snapshot->battery_voltage) == 1) {
+		snapshot->valid |= MODEM_INFO_SNAPSHOT_BATTERY;
+	}
+}
+
+static void snapshot_xconnstat_parse(const char *rsp, struct modem_info_snapshot *snapshot)
+{
+	if (sscanf(rsp, "%%XCONNSTAT: %*d,%*d,%d,%d",
+		   &snapshot->tx_kbytes, &snapshot->rx_kbytes) == 2) {
+		snapshot->valid |= MODEM_INFO_SNAPSHOT_CONN_STATS;
+	}
+}
+
+static void snapshot_cgdcont_parse(const char *rsp, struct modem_info_snapshot *snapshot)
+{
+	const char *addr = rsp;
+	const char *addr_end;
+	size_t len;
+
+	/* Only the first PDN connection with an address is reported. */
+	if (snapshot->valid & MODEM_INFO_SNAPSHOT_IP_ADDRESS) {
+		return;
+	}
+
+	/* The address is the third quoted string of the response:
+	 * +CGDCONT: <cid>,"<PDP_type>","<APN>","<PDP_addr>",...
+	 */
+	for (size_t i = 0; i < 5; i++) {
+		addr = strchr(addr, '"');
+		if (!addr) {
+			return;
+		}
+
+		addr++;
+	}
+
+	/* IPv4 and IPv6 addresses are separated by a space. Keep the first one. */
+	addr_end = strpbrk(addr, "\" ");
+	if (!addr_end) {
+		return;
+	}
+
+	len = addr_end - addr;
+	if ((len == 0) || (len >= sizeof(snapshot->ip_address))) {
+		return;
+	}
+
+	memcpy(snapshot->ip_address, addr, len);
+	snapshot->ip_address[len] = '\0';
+	snapshot->valid |= MODEM_INFO_SNAPSHOT_IP_ADDRESS;
+}
+
+static void snapshot_copy(struct modem_info_snapshot *dst, const struct modem_info_snapshot *src,
+			  uint32_t params)
+{
+	if (params & MODEM_INFO_SNAPSHOT_RSRP) {
+		dst->rsrp = src->rsrp;
+	}
+
+	if (params & MODEM_INFO_SNAPSHOT_SNR) {
+		dst->snr = src->snr;
+	}
+
+	if (params & MODEM_INFO_SNAPSHOT_BAND) {
+		dst->band = src->band;
+	}
+
+	if (params & MODEM_INFO_SNAPSHOT_OPERATOR) {
+		strcpy(dst->operator_name, src->operator_name);
+	}
+
+	if (params & MODEM_INFO_SNAPSHOT_TEMP) {
+		dst->temperature = src->temperature;
+	}
+
+	if (params & MODEM_INFO_SNAPSHOT_BATTERY) {
+		dst->battery_voltage = src->battery_voltage;
+	}
+
+	if (params & MODEM_INFO_SNAPSHOT_CONN_STATS) {
+		dst->tx_kbytes = src->tx_kbytes;
+		dst->rx_kbytes = src->rx_kbytes;
+	}
+
+	if (params & MODEM_INFO_SNAPSHOT_IP_ADDRESS) {
+		strcpy(dst->ip_address, src->ip_address);
+	}
+
+	dst->valid |= params;
+}
+
+#if CONFIG_MODEM_INFO_SNAPSHOT_CACHE
+static uint32_t snapshot_cache_get(uint32_t params, struct modem_info_snapshot *snapshot)
+{
+	int64_t now = k_uptime_get();
+	uint32_t cached = 0;
+
+	for (size_t i = 0; i < SNAPSHOT_PARAM_COUNT; i++) {
+		if ((params & snapshot_cache.valid & BIT(i)) &&
+		    ((now - snapshot_cache_time[i]) <
+		     (CONFIG_MODEM_INFO_SNAPSHOT_CACHE_MAX_AGE * MSEC_PER_SEC))) {
+			cached |= BIT(i);
+		}
+	}
+
+	snapshot_copy(snapshot, &snapshot_cache, cached);
+
+	return cached;
+}
+
+static void snapshot_cache_store(uint32_t params, const struct modem_info_snapshot *snapshot)
+{
+	int64_t now = k_uptime_get();
+
+	/* Drop the parameters that were not available. */
+	snapshot_cache.valid &= ~params;
+	snapshot_copy(&snapshot_cache, snapshot, params & snapshot->valid);
+
+	for (size_t i = 0; i < SNAPSHOT_PARAM_COUNT; i++) {
+		if (params & BIT(i)) {
+			snapshot_cache_time[i] = now;
+		}
+	}
+}
+
+static void snapshot_cesq_handler(const char *notif)
+{
+	int rsrp;
+
+	if (sscanf(notif, "%%CESQ: %d", &rsrp) != 1) {
+		return;
+	}
+
+	k_mutex_lock(&snapshot_mutex, K_FOREVER);
+
+	if (rsrp == CELL_RSRP_INVALID) {
+		snapshot_cache.valid &= ~MODEM_INFO_SNAPSHOT_RSRP;
+	} else {
+		snapshot_cache.rsrp = RSRP_IDX_TO_DBM(rsrp);
+		snapshot_cache.valid |= MODEM_INFO_SNAPSHOT_RSRP;
+		snapshot_cache_time[find_lsb_set(MODEM_INFO_SNAPSHOT_RSRP) - 1] = k_uptime_get();
+	}
+
+	k_mutex_unlock(&snapshot_mutex);
+}
+
+static void snapshot_on_modem_init(int ret, void *ctx)
+{
+	ARG_UNUSED(ctx);
+
+	if (ret != 0) {
+		return;
+	}
+
+	/* Subscribe to the notifications that keep the cached RSRP up to date. */
+	if (nrf_modem_at_printf("AT%%CESQ=1") != 0) {
+		LOG_WRN("Could not subscribe to %%CESQ notifications");
+	}
+}
+
+static void snapshot_cereg_handler(const char *notif)
+{
+	ARG_UNUSED(notif);
+
+	/* Registration or cell changed, the network parameters are outdated. */
+	k_mutex_lock(&snapshot_mutex, K_FOREVER);
+	snapshot_cache.valid &= ~(SNAPSHOT_NETWORK_PARAMS | MODEM_INFO_SNAPSHOT_IP_ADDRESS);
+	k_mutex_unlock(&snapshot_mutex);
+}
+#endif /* CONFIG_MODEM_INFO_SNAPSHOT_CACHE */
+
+/* Sends the commands of the given parameters in one AT command line and parses the responses.
+ * Returns the result of nrf_modem_at_cmd().
+ */
+static int snapshot_cmds_send(uint32_t params, struct modem_info_snapshot *snapshot)
+{
+	char cmd[SNAPSHOT_CMD_SIZE] = "AT";
+	char *rsp = snapshot_buf;
+	int err;
+
+	BUILD_ASSERT(sizeof(cmd) > sizeof("AT%XMONITOR;%XTEMP?;%XVBAT;%XCONNSTAT?;+CGDCONT?"));
+
+	/* Chain the commands, so that they are all sent in one AT command line. */
+	for (size_t i = 0; i < ARRAY_SIZE(snapshot_cmds); i++) {
+		if (params & snapshot_cmds[i].params) {
+			if (strlen(cmd) > strlen("AT")) {
+				strcat(cmd, ";");
+			}
+
+			strcat(cmd, snapshot_cmds[i].cmd);
+		}
+	}
+
+	err = nrf_modem_at_cmd(snapshot_buf, sizeof(snapshot_buf), "%s", cmd);
+	if (err) {
+		return err;
+	}
+
+	while (rsp && *rsp) {
+		char *rsp_end = strstr(rsp, AT_CMD_RSP_DELIM);
+
+		if (rsp_end) {
+			*rsp_end = '\0';
+			rsp_end += strlen(AT_CMD_RSP_DELIM);
+		}
+
+		for (size_t i = 0; i < ARRAY_SIZE(snapshot_cmds); i++) {
+			const struct snapshot_cmd *snapshot_cmd = &snapshot_cmds[i];
+
+			if ((params & snapshot_cmd->params) &&
+			    !strncmp(rsp, snapshot_cmd->rsp_prefix,
+				     strlen(snapshot_cmd->rsp_prefix))) {
+				snapshot_cmd->parse(rsp, snapshot);
+				break;
+			}
+		}
+
+		rsp = rsp_end;
+	}
+
+	return 0;
+}
+
+static int snapshot_fetch(uint32_t params, struct modem_info_snapshot *snapshot)
+{
+	int err;
+
+	err = snapshot_cmds_send(params, snapshot);
+	if (err > 0) {
+		/* The modem stops at the first failing command of the line. Send the
+		 * commands one by one, so that only the parameters of the failing
+		 * command are missing.
+		 */
+		LOG_DBG("Snapshot command line failed, error: %d", err);
+
+		for (size_t i = 0; i < ARRAY_SIZE(snapshot_cmds); i++) {
+			if (!(params & snapshot_cmds[i].params)) {
+				continue;
+			}
+
+			err = snapshot_cmds_send(snapshot_cmds[i].params, snapshot);
+			if (err < 0) {
+				break;
+			}
+
+			if (err > 0) {
+				LOG_WRN("Could not read %s, error: %d", snapshot_cmds[i].cmd, err);
+			}
+		}
+	}
+
+	if (err < 0) {
+		LOG_ERR("Could not get snapshot, error: %d", err);
+		return -EIO;
+	}
+
+	snapshot->valid &= params;
+
+	return 0;
+}
+
+int modem_info_snapshot_get(uint32_t params, bool allow_cached,
+			    struct modem_info_snapshot *snapshot)
+{
+	struct modem_info_snapshot fetched = {0};
+	int err = 0;
+
+	if ((params == 0) || (snapshot == NULL)) {
+		return -EINVAL;
+	}
+
+	memset(snapshot, 0, sizeof(*snapshot));
+
+	k_mutex_lock(&snapshot_mutex, K_FOREVER);
+
+#if CONFIG_MODEM_INFO_SNAPSHOT_CACHE
+	if (allow_cached) {
+		params &= ~snapshot_cache_get(params, snapshot);
+	}
+#endif /* CONFIG_MODEM_INFO_SNAPSHOT_CACHE */
+
+	if (params) {
+		err = snapshot_fetch(params, &fetched);
+	}
+
+	if (!err && params) {
+		snapshot_copy(snapshot, &fetched, fetched.valid);
+
+#if CONFIG_MODEM_INFO_SNAPSHOT_CACHE
+		snapshot_cache_store(params, &fetched);
+#endif /* CONFIG_MODEM_INFO_SNAPSHOT_CACHE */
+	}
+
+	k_mutex_unlock(&snapshot_mutex);
+
+	return err;
+}
+
 int modem_info_init(void)
 {
 	return 0;
@@ -7,9 +7,7 @@
 #include <tone.h>
 
 #include <zephyr/kernel.h>
-#include <math.h>
-#include <stdio.h>
-#include <arm_math.h>
+#include <wave_gen.h>
 
 #define FREQ_LIMIT_LOW 100
 #define FREQ_LIMIT_HIGH 10000
@@ -31,11 +29,28 @@ int tone_gen(int16_t *tone, size_t *tone_size, uint16_t tone_freq_hz, uint32_t s
 
 	uint32_t samples_for_one_period = smpl_freq_hz / tone_freq_hz;
 
+	if (samples_for_one_period == 0) {
+		*tone_size = 0;
+		return 0;
+	}
+
+	const float scale = amplitude * INT16_MAX / WAVE_GEN_Q30_ONE;
+	/* Phase increment is 2^32 / samples_for_one_period, tracked exactly */
+	const uint32_t step = (uint32_t)(BIT64(32) / samples_for_one_period);
+	const uint32_t step_rem = (uint32_t)(BIT64(32) % samples_for_one_period);
+	uint32_t phase = 0;
+	uint32_t phase_rem = samples_for_one_period / 2;
+
 	for (uint32_t i = 0; i < samples_for_one_period; i++) {
-		float curr_val = i * 2 * PI / samples_for_one_period;
-		float32_t res = arm_sin_f32(curr_val);
 		/* Generate one sine wave */
-		tone[i] = amplitude * res * INT16_MAX;
+		tone[i] = scale * wave_gen_sine(phase);
+
+		phase += step;
+		phase_rem += step_rem;
+		if (phase_rem >= samples_for_one_period) {
+			phase_rem -= samples_for_one_period;
+			phase++;
+		}
 	}
 
 	/* Configured for bit depth 16 */
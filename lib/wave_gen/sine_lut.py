@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+"""Generate the quarter sine wave lookup table of the wave generator library.
+
+The table covers the angles from 0 to pi/2 with 2^bits linear segments.
+The values are in Q1.30 format.
+"""
+
+import argparse
+import math
+
+Q30_ONE = 1 << 30
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__, allow_abbrev=False)
+    parser.add_argument('--bits', type=int, required=True,
+                        help='Number of bits of the table index')
+    parser.add_argument('--output', required=True,
+                        help='Output file, included in the table definition')
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    segments = 1 << args.bits
+
+    with open(args.output, 'w') as f:
+        f.write('/* Generated by sine_lut.py, do not edit. */\n')
+        for i in range(segments + 1):
+            # Round half away from zero, like lround().
+            val = math.floor(math.sin(math.pi / 2 * i / segments) * Q30_ONE + 0.5)
+            f.write(f'{val},\n')
+
+
+if __name__ == '__main__':
+    main()
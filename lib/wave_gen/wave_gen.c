@@ -5,6 +5,7 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
 #include <stdlib.h>
 
 #include <math.h>
@@ -17,6 +18,21 @@ LOG_MODULE_REGISTER(wave_gen, CONFIG_WAVE_GEN_LIB_LOG_LEVEL);
 
 #include <wave_gen.h>
 
+/* Quarter of the sine period is covered by 2^SINE_LUT_BITS linear segments. */
+#define SINE_LUT_BITS		7
+#define SINE_LUT_SIZE		(BIT(SINE_LUT_BITS) + 1)
+#define SINE_FRAC_BITS		(30 - SINE_LUT_BITS)
+
+#define PHASE_HALF		BIT(31)
+#define PHASE_QUARTER		BIT(30)
+
+/* Quarter of the sine period in Q1.30 format, generated by sine_lut.py. */
+static const int32_t sine_lut[] = {
+#include "wave_gen_sine_lut.inc"
+};
+
+BUILD_ASSERT(ARRAY_SIZE(sine_lut) == SINE_LUT_SIZE, "Sine table does not match SINE_LUT_BITS");
+
 /**
  * @brief Generates a pseudo-random number between -1 and 1.
  *
@@ -125,3 +141,149 @@ int wave_gen_generate_value(uint32_t time, const struct wave_gen_param *params,
 
 	return 0;
 }
+
+int32_t wave_gen_sine(uint32_t phase)
+{
+	uint32_t x = phase & (PHASE_QUARTER - 1);
+	uint32_t idx;
+	uint32_t frac;
+	int32_t res;
+
+	/* The sine is symmetric within a half period. */
+	if (phase & PHASE_QUARTER) {
+		x = PHASE_QUARTER - x;
+	}
+
+	idx = x >> SINE_FRAC_BITS;
+	frac = x & BIT_MASK(SINE_FRAC_BITS);
+	res = sine_lut[idx];
+
+	if (frac) {
+		res += ((int64_t)(sine_lut[idx + 1] - res) * frac) >> SINE_FRAC_BITS;
+	}
+
+	return (phase & PHASE_HALF) ? -res : res;
+}
+
+static int32_t block_wave_val(enum wave_gen_type type, uint32_t phase)
+{
+	switch (type) {
+	case WAVE_GEN_TYPE_SINE:
+		return wave_gen_sine(phase);
+
+	case WAVE_GEN_TYPE_TRIANGLE:
+		if (phase < PHASE_HALF) {
+			return (int32_t)phase - WAVE_GEN_Q30_ONE;
+		}
+
+		return WAVE_GEN_Q30_ONE - (int32_t)(phase - PHASE_HALF);
+
+	case WAVE_GEN_TYPE_SQUARE:
+		return (phase < PHASE_HALF) ? -WAVE_GEN_Q30_ONE : WAVE_GEN_Q30_ONE;
+
+	case WAVE_GEN_TYPE_NONE:
+	default:
+		return 0;
+	}
+}
+
+static void block_phase_advance(struct wave_gen_block *block)
+{
+	block->phase += block->step;
+
+	if (block->phase_rem >= block->den - block->step_rem) {
+		block->phase_rem -= block->den - block->step_rem;
+		block->phase++;
+	} else {
+		block->phase_rem += block->step_rem;
+	}
+}
+
+int wave_gen_block_init(struct wave_gen_block *block, const struct wave_gen_param *params,
+			uint32_t time, uint32_t sample_rate_hz)
+{
+	uint64_t den = (uint64_t)params->period_ms * sample_rate_hz;
+	uint64_t num;
+
+	if ((params->type >= WAVE_GEN_TYPE_COUNT) || (sample_rate_hz == 0)) {
+		return -EINVAL;
+	}
+
+	block->params = *params;
+
+	if (params->period_ms == 0) {
+		if (params->type != WAVE_GEN_TYPE_NONE) {
+			return -EINVAL;
+		}
+
+		block->phase = 0;
+		block->phase_rem = 0;
+		block->step = 0;
+		block->step_rem = 0;
+		block->den = 1;
+
+		return 0;
+	}
+
+	if (den > UINT32_MAX) {
+		return -EINVAL;
+	}
+
+	/* One period is den units, one sample is 1000 units and time of 1 ms is
+	 * sample_rate_hz units. The phase is rounded to the nearest value.
+	 */
+	block->den = den;
+
+	num = (((uint64_t)(time % params->period_ms) * sample_rate_hz) << 32) + den / 2;
+	block->phase = num / den;
+	block->phase_rem = num % den;
+
+	num = (uint64_t)MSEC_PER_SEC << 32;
+	block->step = num / den;
+	block->step_rem = num % den;
+
+	return 0;
+}
+
+void wave_gen_block_generate(struct wave_gen_block *block, float *out, size_t cnt)
+{
+	const struct wave_gen_param *params = &block->params;
+	const float scale = params->amplitude / WAVE_GEN_Q30_ONE;
+	const float offset = params->offset;
+	const float noise = params->noise;
+
+	for (size_t i = 0; i < cnt; i++) {
+		float res = offset + scale * block_wave_val(params->type, block->phase);
+
+		if (noise != 0.0f) {
+			res += noise * (float)generate_pseudo_random();
+		}
+
+		out[i] = res;
+		block_phase_advance(block);
+	}
+}
+
+void wave_gen_block_generate_s16(struct wave_gen_block *block, int16_t *out, size_t cnt)
+{
+	const struct wave_gen_param *params = &block->params;
+	/* Larger amplitudes saturate all values except zero crossings anyway. */
+	const int64_t amplitude = CLAMP(llround(params->amplitude * (1 << 16)),
+					-(1LL << 32), (1LL << 32));
+	const int32_t offset = lround(params->offset);
+	const int32_t noise = lround(params->noise);
+
+	for (size_t i = 0; i < cnt; i++) {
+		int64_t res = amplitude * block_wave_val(params->type, block->phase);
+
+		/* Truncate towards zero to keep the wave symmetric. */
+		res = res / ((int64_t)WAVE_GEN_Q30_ONE << 16) + offset;
+
+		if (noise != 0) {
+			res += (int64_t)noise * (rand() - RAND_MAX / 2) / (RAND_MAX / 2);
+		}
+
+		out[i] = CLAMP(res, INT16_MIN, INT16_MAX);
+		block_phase_advance(block);
+	}
+}
@@ -70,6 +70,66 @@ void platformUartPanic(void);
  */
 uint16_t platformRadioChannelGet(otInstance *aInstance);
 
+#if defined(CONFIG_OPENTHREAD_PLATFORM_RADIO_STATS)
+/**
+ * Statistics of the radio platform.
+ *
+ * Latencies are accumulated in microseconds, the averages can be obtained by dividing the sums
+ * by the number of frames.
+ */
+struct platform_radio_stats {
+	/** Number of received frames passed to OpenThread. */
+	uint32_t rx_frames;
+
+	/** Number of wake-ups of the OpenThread thread that passed received frames. */
+	uint32_t rx_batches;
+
+	/** Largest number of received frames passed in a single wake-up. */
+	uint32_t rx_batch_max;
+
+	/** Largest latency between the reception of a frame and passing it to OpenThread.
+	 *  Only measured if CONFIG_NET_PKT_TIMESTAMP is enabled.
+	 */
+	uint32_t rx_latency_max_us;
+
+	/** Sum of the latencies between the reception of a frame and passing it to OpenThread. */
+	uint64_t rx_latency_sum_us;
+
+	/** Number of transmitted frames. */
+	uint32_t tx_frames;
+
+	/** Largest latency between a transmit request and passing the frame to the radio. */
+	uint32_t tx_start_latency_max_us;
+
+	/** Sum of the latencies between a transmit request and passing the frame to the radio. */
+	uint64_t tx_start_latency_sum_us;
+
+	/** Largest latency between a transmit request and reporting its result to OpenThread. */
+	uint32_t tx_done_latency_max_us;
+
+	/** Sum of the latencies between a transmit request and reporting its result. */
+	uint64_t tx_done_latency_sum_us;
+};
+
+/**
+ * Get the statistics of the radio platform.
+ *
+ * Must be called with the OpenThread API mutex locked.
+ *
+ * @param[out]  stats  The statistics.
+ *
+ */
+void platformRadioStatsGet(struct platform_radio_stats *stats);
+
+/**
+ * Reset the statistics of the radio platform.
+ *
+ * Must be called with the OpenThread API mutex locked.
+ *
+ */
+void platformRadioStatsReset(void);
+#endif /* CONFIG_OPENTHREAD_PLATFORM_RADIO_STATS */
+
 #if defined(CONFIG_OPENTHREAD_DIAG)
 /**
  * Set channel on radio driver.
@@ -101,6 +101,9 @@ static const struct device *const radio_dev =
 	DEVICE_DT_GET(DT_CHOSEN(zephyr_ieee802154));
 static struct ieee802154_radio_api *radio_api;
 
+/* Radio capabilities do not change at runtime, read them once. */
+static enum ieee802154_hw_caps radio_caps;
+
 /* Get the default tx output power from Kconfig */
 static int8_t tx_power = CONFIG_OPENTHREAD_DEFAULT_TX_POWER;
 static uint16_t channel;
@@ -122,6 +125,22 @@ static otError tx_result;
 K_FIFO_DEFINE(rx_pkt_fifo);
 K_FIFO_DEFINE(tx_pkt_fifo);
 
+#if defined(CONFIG_OPENTHREAD_PLATFORM_RADIO_STATS)
+static struct platform_radio_stats radio_stats;
+
+/* Cycle counts at which the frame being transmitted was requested by
+ * OpenThread and passed to the radio driver.
+ */
+static uint32_t tx_request_cycles;
+static uint32_t tx_start_cycles;
+
+static void radio_stats_latency_add(uint64_t *sum_us, uint32_t *max_us, uint32_t latency_us)
+{
+	*sum_us += latency_us;
+	*max_us = MAX(*max_us, latency_us);
+}
+#endif /* CONFIG_OPENTHREAD_PLATFORM_RADIO_STATS */
+
 static int8_t get_transmit_power_for_channel(uint8_t aChannel)
 {
 	int8_t channel_max_power = OT_RADIO_POWER_INVALID;
@@ -362,13 +381,14 @@ void platformRadioInit(void)
 		return;
 	}
 
+	radio_caps = radio_api->get_capabilities(radio_dev);
+
 	k_work_queue_start(&ot_work_q, ot_task_stack,
 			   K_KERNEL_STACK_SIZEOF(ot_task_stack),
 			   OT_WORKER_PRIORITY, NULL);
 	k_thread_name_set(&ot_work_q.thread, "ot_radio_workq");
 
-	if ((radio_api->get_capabilities(radio_dev) &
-	     IEEE802154_HW_TX_RX_ACK) != IEEE802154_HW_TX_RX_ACK) {
+	if ((radio_caps & IEEE802154_HW_TX_RX_ACK) != IEEE802154_HW_TX_RX_ACK) {
 		LOG_ERR("Only radios with automatic ack handling "
 			"are currently supported");
 		k_panic();
@@ -390,7 +410,9 @@ void transmit_message(struct k_work *tx_job)
 
 	ARG_UNUSED(tx_job);
 
-	enum ieee802154_hw_caps radio_caps = radio_api->get_capabilities(radio_dev);
+#if defined(CONFIG_OPENTHREAD_PLATFORM_RADIO_STATS)
+	tx_start_cycles = k_cycle_get_32();
+#endif
 
 	/*
 	 * The payload is already in tx_payload->data,
@@ -485,6 +507,18 @@ void transmit_message(struct k_work *tx_job)
 
 static inline void handle_tx_done(otInstance *aInstance)
 {
+#if defined(CONFIG_OPENTHREAD_PLATFORM_RADIO_STATS)
+	uint32_t now = k_cycle_get_32();
+
+	radio_stats.tx_frames++;
+	radio_stats_latency_add(&radio_stats.tx_start_latency_sum_us,
+				&radio_stats.tx_start_latency_max_us,
+				k_cyc_to_us_floor32(tx_start_cycles - tx_request_cycles));
+	radio_stats_latency_add(&radio_stats.tx_done_latency_sum_us,
+				&radio_stats.tx_done_latency_max_us,
+				k_cyc_to_us_floor32(now - tx_request_cycles));
+#endif
+
 	sTransmitFrame.mInfo.mTxInfo.mIsSecurityProcessed =
 		net_pkt_ieee802154_frame_secured(tx_pkt);
 	sTransmitFrame.mInfo.mTxInfo.mIsHeaderUpdated = net_pkt_ieee802154_mac_hdr_rdy(tx_pkt);
@@ -499,18 +533,22 @@ static inline void handle_tx_done(otInstance *aInstance)
 }
 
 static void openthread_handle_received_frame(otInstance *instance,
-					     struct net_pkt *pkt)
+					     struct net_pkt *pkt, uint8_t rx_channel)
 {
 	otRadioFrame recv_frame;
 
 	memset(&recv_frame, 0, sizeof(otRadioFrame));
 
+	/* The frame is passed to OpenThread in place, without copying. */
 	recv_frame.mPsdu = net_buf_frag_last(pkt->buffer)->data;
 	/* Length inc. CRC. */
 	recv_frame.mLength = net_buf_frags_len(pkt->buffer);
-	recv_frame.mChannel = platformRadioChannelGet(instance);
+	recv_frame.mChannel = rx_channel;
 	recv_frame.mInfo.mRxInfo.mLqi = net_pkt_ieee802154_lqi(pkt);
 	recv_frame.mInfo.mRxInfo.mRssi = net_pkt_ieee802154_rssi_dbm(pkt);
+	/* The ACK was already sent by the radio, with the frame pending bit taken from the
+	 * source match table kept up to date by otPlatRadio*SrcMatch*(). Only report it here.
+	 */
 	recv_frame.mInfo.mRxInfo.mAckedWithFramePending = net_pkt_ieee802154_ack_fpb(pkt);
 
 #if defined(CONFIG_NET_PKT_TIMESTAMP)
@@ -521,6 +559,11 @@ static void openthread_handle_received_frame(otInstance *instance,
 	recv_frame.mInfo.mRxInfo.mAckFrameCounter = net_pkt_ieee802154_ack_fc(pkt);
 	recv_frame.mInfo.mRxInfo.mAckKeyId = net_pkt_ieee802154_ack_keyid(pkt);
 
+#if defined(CONFIG_OPENTHREAD_PLATFORM_RADIO_STATS) && defined(CONFIG_NET_PKT_TIMESTAMP)
+	radio_stats_latency_add(&radio_stats.rx_latency_sum_us, &radio_stats.rx_latency_max_us,
+				otPlatTimeGet() - recv_frame.mInfo.mRxInfo.mTimestamp);
+#endif
+
 	if (IS_ENABLED(CONFIG_OPENTHREAD_DIAG) && otPlatDiagModeGet()) {
 		otPlatDiagRadioReceiveDone(instance, &recv_frame, OT_ERROR_NONE);
 	} else {
@@ -627,6 +670,10 @@ static int run_tx_task(otInstance *aInstance)
 	if (!k_work_is_pending(&tx_job)) {
 		sState = OT_RADIO_STATE_TRANSMIT;
 
+#if defined(CONFIG_OPENTHREAD_PLATFORM_RADIO_STATS)
+		tx_request_cycles = k_cycle_get_32();
+#endif
+
 		k_work_submit_to_queue(&ot_work_q, &tx_job);
 		return 0;
 	} else {
@@ -653,11 +700,25 @@ void platformRadioProcess(otInstance *aInstance)
 
 	if (is_pending_event_set(PENDING_EVENT_FRAME_RECEIVED)) {
 		struct net_pkt *rx_pkt;
+		uint8_t rx_channel = platformRadioChannelGet(aInstance);
+		uint32_t rx_count = 0;
 
+		/* Pass all the frames received since the last wake-up. */
 		reset_pending_event(PENDING_EVENT_FRAME_RECEIVED);
 		while ((rx_pkt = (struct net_pkt *) k_fifo_get(&rx_pkt_fifo, K_NO_WAIT)) != NULL) {
-			openthread_handle_received_frame(aInstance, rx_pkt);
+			openthread_handle_received_frame(aInstance, rx_pkt, rx_channel);
+			rx_count++;
 		}
+
+#if defined(CONFIG_OPENTHREAD_PLATFORM_RADIO_STATS)
+		if (rx_count > 0) {
+			radio_stats.rx_frames += rx_count;
+			radio_stats.rx_batches++;
+			radio_stats.rx_batch_max = MAX(radio_stats.rx_batch_max, rx_count);
+		}
+#else
+		ARG_UNUSED(rx_count);
+#endif
 	}
 
 	if (is_pending_event_set(PENDING_EVENT_RX_FAILED)) {
@@ -677,8 +738,7 @@ void platformRadioProcess(otInstance *aInstance)
 	if (is_pending_event_set(PENDING_EVENT_TX_DONE)) {
 		reset_pending_event(PENDING_EVENT_TX_DONE);
 
-		if (sState == OT_RADIO_STATE_TRANSMIT ||
-		    radio_api->get_capabilities(radio_dev) & IEEE802154_HW_SLEEP_TO_TX) {
+		if (sState == OT_RADIO_STATE_TRANSMIT || radio_caps & IEEE802154_HW_SLEEP_TO_TX) {
 			sState = OT_RADIO_STATE_RECEIVE;
 			handle_tx_done(aInstance);
 		}
@@ -716,6 +776,18 @@ void platformRadioProcess(otInstance *aInstance)
 	}
 }
 
+#if defined(CONFIG_OPENTHREAD_PLATFORM_RADIO_STATS)
+void platformRadioStatsGet(struct platform_radio_stats *stats)
+{
+	*stats = radio_stats;
+}
+
+void platformRadioStatsReset(void)
+{
+	memset(&radio_stats, 0, sizeof(radio_stats));
+}
+#endif /* CONFIG_OPENTHREAD_PLATFORM_RADIO_STATS */
+
 uint16_t platformRadioChannelGet(otInstance *aInstance)
 {
 	ARG_UNUSED(aInstance);
@@ -908,10 +980,6 @@ otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aPacket)
 
 	__ASSERT_NO_MSG(aPacket == &sTransmitFrame);
 
-	enum ieee802154_hw_caps radio_caps;
-
-	radio_caps = radio_api->get_capabilities(radio_dev);
-
 	if (sState == OT_RADIO_STATE_RECEIVE ||
 	    (sState == OT_RADIO_STATE_SLEEP &&
 	     radio_caps & IEEE802154_HW_SLEEP_TO_TX)) {
@@ -942,12 +1010,9 @@ int8_t otPlatRadioGetRssi(otInstance *aInstance)
 	int8_t ret_rssi = INT8_MAX;
 	int error = 0;
 	const uint16_t detection_time = 1;
-	enum ieee802154_hw_caps radio_caps;
 
 	ARG_UNUSED(aInstance);
 
-	radio_caps = radio_api->get_capabilities(radio_dev);
-
 	if (!(radio_caps & IEEE802154_HW_ENERGY_SCAN)) {
 		/*
 		 * TODO: No API in Zephyr to get the RSSI
@@ -975,14 +1040,11 @@ int8_t otPlatRadioGetRssi(otInstance *aInstance)
 otRadioCaps otPlatRadioGetCaps(otInstance *aInstance)
 {
 	otRadioCaps caps = OT_RADIO_CAPS_NONE;
-	enum ieee802154_hw_caps radio_caps;
 
 	ARG_UNUSED(aInstance);
 	__ASSERT(radio_api,
 	    "platformRadioInit needs to be called prior to otPlatRadioGetCaps");
 
-	radio_caps = radio_api->get_capabilities(radio_dev);
-
 	if (radio_caps & IEEE802154_HW_ENERGY_SCAN) {
 		caps |= OT_RADIO_CAPS_ENERGY_SCAN;
 	}
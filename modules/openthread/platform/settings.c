@@ -8,6 +8,8 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/settings/settings.h>
 #include <zephyr/random/random.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <openthread/platform/settings.h>
 
@@ -67,11 +69,11 @@ static int ot_setting_delete_cb(const char *key, size_t len,
 	if (ret != 0) {
 		LOG_ERR("Failed to remove setting %s, ret %d", path,
 			ret);
-		__ASSERT_NO_MSG(false);
+		ctx->status = ret;
+	} else if (ctx->status == -ENOENT) {
+		ctx->status = 0;
 	}
 
-	ctx->status = 0;
-
 	if (ctx->target_index == ctx->index) {
 		/* Break the loop on index match, otherwise it was -1
 		 * (delete all).
@@ -155,6 +157,9 @@ struct ot_setting_read_ctx {
 
 	/* Operation result. */
 	int status;
+
+	/* Indicates if only the subtree root shall be read. */
+	bool exact;
 };
 
 static int ot_setting_read_cb(const char *key, size_t len,
@@ -164,9 +169,9 @@ static int ot_setting_read_cb(const char *key, size_t len,
 	int ret;
 	struct ot_setting_read_ctx *ctx = (struct ot_setting_read_ctx *)param;
 
-	ARG_UNUSED(len);
-	ARG_UNUSED(read_cb);
-	ARG_UNUSED(cb_arg);
+	if (ctx->exact && key != NULL) {
+		return 0;
+	}
 
 	if (ctx->target_index != ctx->index) {
 		ctx->index++;
@@ -200,6 +205,247 @@ out:
 	return 1;
 }
 
+#if defined(CONFIG_OPENTHREAD_SETTINGS_INDEX)
+
+/* RAM index of the OpenThread settings, so that lookups by key and index,
+ * as well as deletions, do not have to walk the settings subtree in flash.
+ * The position of an entry among the entries with the same key is the index
+ * used by the OpenThread API.
+ */
+struct ot_setting_index_entry {
+	/* OpenThread key. */
+	uint16_t key;
+
+	/* Length of the stored value. */
+	uint16_t length;
+
+	/* Random suffix of an entry created by otPlatSettingsAdd. */
+	uint32_t suffix;
+
+	/* Indicates if the entry is stored under the suffix or the key itself. */
+	bool has_suffix;
+};
+
+static struct ot_setting_index_entry ot_index[CONFIG_OPENTHREAD_SETTINGS_INDEX_SIZE];
+static size_t ot_index_count;
+
+/* Cleared if the index could not hold all the settings. The subtree is
+ * walked for every operation from then on.
+ */
+static bool ot_index_valid;
+
+static void ot_setting_index_path(const struct ot_setting_index_entry *entry,
+				  char *path, size_t size)
+{
+	int ret;
+
+	if (entry->has_suffix) {
+		ret = snprintk(path, size, "%s/%x/%08x", OT_SETTINGS_ROOT_KEY,
+			       entry->key, entry->suffix);
+	} else {
+		ret = snprintk(path, size, "%s/%x", OT_SETTINGS_ROOT_KEY,
+			       entry->key);
+	}
+	__ASSERT(ret < size, "Setting path buffer too small.");
+}
+
+static int ot_setting_index_find(uint16_t key, int index)
+{
+	for (size_t i = 0; i < ot_index_count; i++) {
+		if (ot_index[i].key != key) {
+			continue;
+		}
+
+		if (index == 0) {
+			return i;
+		}
+
+		index--;
+	}
+
+	return -ENOENT;
+}
+
+static bool ot_setting_index_suffix_used(uint16_t key, uint32_t suffix)
+{
+	for (size_t i = 0; i < ot_index_count; i++) {
+		if (ot_index[i].key == key && ot_index[i].has_suffix &&
+		    ot_index[i].suffix == suffix) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void ot_setting_index_add(uint16_t key, uint32_t suffix, bool has_suffix,
+				 size_t length)
+{
+	if (ot_index_count == ARRAY_SIZE(ot_index)) {
+		LOG_WRN("OT settings index full, falling back to subtree lookups");
+		ot_index_valid = false;
+		return;
+	}
+
+	ot_index[ot_index_count++] = (struct ot_setting_index_entry) {
+		.key = key,
+		.length = length,
+		.suffix = suffix,
+		.has_suffix = has_suffix,
+	};
+}
+
+static void ot_setting_index_remove(size_t pos)
+{
+	ot_index_count--;
+	memmove(&ot_index[pos], &ot_index[pos + 1],
+		(ot_index_count - pos) * sizeof(ot_index[0]));
+}
+
+static int ot_setting_index_delete(int pos)
+{
+	int ret;
+	char path[OT_SETTINGS_MAX_PATH_LEN];
+
+	ot_setting_index_path(&ot_index[pos], path, sizeof(path));
+
+	LOG_DBG("Removing: %s", path);
+
+	ret = settings_delete(path);
+	if (ret != 0) {
+		LOG_ERR("Failed to remove setting %s, ret %d", path, ret);
+		/* The setting is still stored, so it stays indexed. */
+		return ret;
+	}
+
+	ot_setting_index_remove(pos);
+
+	return 0;
+}
+
+static void ot_setting_index_delete_key(uint16_t key)
+{
+	int pos;
+
+	while ((pos = ot_setting_index_find(key, 0)) >= 0) {
+		if (ot_setting_index_delete(pos) != 0) {
+			break;
+		}
+	}
+}
+
+static int ot_setting_index_build_cb(const char *key, size_t len,
+				     settings_read_cb read_cb, void *cb_arg,
+				     void *param)
+{
+	char *end;
+	unsigned long ot_key;
+	unsigned long suffix = 0;
+	bool has_suffix = false;
+
+	ARG_UNUSED(read_cb);
+	ARG_UNUSED(cb_arg);
+	ARG_UNUSED(param);
+
+	if (!ot_index_valid) {
+		return 1;
+	}
+
+	if (key == NULL) {
+		/* Nothing is stored under the root key itself. */
+		return 0;
+	}
+
+	ot_key = strtoul(key, &end, 16);
+	if (*end == '/') {
+		suffix = strtoul(end + 1, &end, 16);
+		has_suffix = true;
+	}
+
+	if ((*end != '\0') || (ot_key > UINT16_MAX) || (len > UINT16_MAX)) {
+		LOG_WRN("Unexpected OT setting %s, falling back to subtree lookups", key);
+		ot_index_valid = false;
+		return 1;
+	}
+
+	ot_setting_index_add(ot_key, suffix, has_suffix, len);
+
+	return 0;
+}
+
+static void ot_setting_index_build(void)
+{
+	int ret;
+
+	ot_index_count = 0;
+	ot_index_valid = true;
+
+	ret = settings_load_subtree_direct(OT_SETTINGS_ROOT_KEY,
+					   ot_setting_index_build_cb, NULL);
+	if (ret != 0) {
+		LOG_ERR("Failed to build OT settings index, ret %d", ret);
+		ot_index_valid = false;
+	}
+
+	LOG_DBG("OT settings index built, %zu entries, valid %d", ot_index_count,
+		ot_index_valid);
+}
+
+static otError ot_setting_index_get(uint16_t key, int index, uint8_t *value,
+				    uint16_t *length)
+{
+	int ret;
+	int pos;
+	char path[OT_SETTINGS_MAX_PATH_LEN];
+	struct ot_setting_read_ctx read_ctx = {
+		.value = value,
+		.length = length,
+		.status = -ENOENT,
+		.exact = true,
+	};
+
+	pos = ot_setting_index_find(key, index);
+	if (pos < 0) {
+		LOG_DBG("aKey %u aIndex %d not found", key, index);
+		return OT_ERROR_NOT_FOUND;
+	}
+
+	if (value == NULL) {
+		if (length != NULL) {
+			*length = ot_index[pos].length;
+		}
+
+		return OT_ERROR_NONE;
+	}
+
+	ot_setting_index_path(&ot_index[pos], path, sizeof(path));
+
+	ret = settings_load_subtree_direct(path, ot_setting_read_cb, &read_ctx);
+	if (ret != 0) {
+		LOG_ERR("Failed to load OT setting %s, ret %d", path, ret);
+	}
+
+	if (read_ctx.status != 0) {
+		LOG_DBG("aKey %u aIndex %d not found", key, index);
+		return OT_ERROR_NOT_FOUND;
+	}
+
+	return OT_ERROR_NONE;
+}
+
+#endif /* CONFIG_OPENTHREAD_SETTINGS_INDEX */
+
+static bool ot_setting_suffix_used(uint16_t key, uint32_t suffix, const char *path)
+{
+#if defined(CONFIG_OPENTHREAD_SETTINGS_INDEX)
+	if (ot_index_valid) {
+		return ot_setting_index_suffix_used(key, suffix);
+	}
+#endif
+
+	return ot_setting_exists(path);
+}
+
 /* OpenThread APIs */
 
 void otPlatSettingsInit(otInstance *aInstance, const uint16_t *aSensitiveKeys,
@@ -215,6 +461,10 @@ void otPlatSettingsInit(otInstance *aInstance, const uint16_t *aSensitiveKeys,
 	if (ret != 0) {
 		LOG_ERR("settings_subsys_init failed (ret %d)", ret);
 	}
+
+#if defined(CONFIG_OPENTHREAD_SETTINGS_INDEX)
+	ot_setting_index_build();
+#endif
 }
 
 otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex,
@@ -233,6 +483,12 @@ otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex,
 
 	LOG_DBG("%s Entry aKey %u aIndex %d", __func__, aKey, aIndex);
 
+#if defined(CONFIG_OPENTHREAD_SETTINGS_INDEX)
+	if (ot_index_valid) {
+		return ot_setting_index_get(aKey, aIndex, aValue, aValueLength);
+	}
+#endif
+
 	ret = snprintk(path, sizeof(path), "%s/%x", OT_SETTINGS_ROOT_KEY, aKey);
 	__ASSERT(ret < sizeof(path), "Setting path buffer too small.");
 
@@ -260,7 +516,15 @@ otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey,
 
 	LOG_DBG("%s Entry aKey %u", __func__, aKey);
 
+#if defined(CONFIG_OPENTHREAD_SETTINGS_INDEX)
+	if (ot_index_valid) {
+		ot_setting_index_delete_key(aKey);
+	} else {
+		(void)ot_setting_delete_subtree(aKey, -1, false);
+	}
+#else
 	(void)ot_setting_delete_subtree(aKey, -1, false);
+#endif
 
 	ret = snprintk(path, sizeof(path), "%s/%x", OT_SETTINGS_ROOT_KEY, aKey);
 	__ASSERT(ret < sizeof(path), "Setting path buffer too small.");
@@ -271,6 +535,12 @@ otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey,
 		return OT_ERROR_NO_BUFS;
 	}
 
+#if defined(CONFIG_OPENTHREAD_SETTINGS_INDEX)
+	if (ot_index_valid) {
+		ot_setting_index_add(aKey, 0, false, aValueLength);
+	}
+#endif
+
 	return OT_ERROR_NONE;
 }
 
@@ -278,6 +548,7 @@ otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey,
 			  const uint8_t *aValue, uint16_t aValueLength)
 {
 	int ret;
+	uint32_t suffix;
 	char path[OT_SETTINGS_MAX_PATH_LEN];
 
 	ARG_UNUSED(aInstance);
@@ -285,10 +556,11 @@ otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey,
 	LOG_DBG("%s Entry aKey %u", __func__, aKey);
 
 	do {
+		suffix = sys_rand32_get();
 		ret = snprintk(path, sizeof(path), "%s/%x/%08x",
-			       OT_SETTINGS_ROOT_KEY, aKey, sys_rand32_get());
+			       OT_SETTINGS_ROOT_KEY, aKey, suffix);
 		__ASSERT(ret < sizeof(path), "Setting path buffer too small.");
-	} while (ot_setting_exists(path));
+	} while (ot_setting_suffix_used(aKey, suffix, path));
 
 	ret = settings_save_one(path, aValue, aValueLength);
 	if (ret != 0) {
@@ -296,6 +568,12 @@ otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey,
 		return OT_ERROR_NO_BUFS;
 	}
 
+#if defined(CONFIG_OPENTHREAD_SETTINGS_INDEX)
+	if (ot_index_valid) {
+		ot_setting_index_add(aKey, suffix, true, aValueLength);
+	}
+#endif
+
 	return OT_ERROR_NONE;
 }
 
@@ -307,10 +585,33 @@ otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
 
 	LOG_DBG("%s Entry aKey %u aIndex %d", __func__, aKey, aIndex);
 
+#if defined(CONFIG_OPENTHREAD_SETTINGS_INDEX)
+	if (ot_index_valid) {
+		if (aIndex == -1) {
+			ret = ot_setting_index_find(aKey, 0);
+			ot_setting_index_delete_key(aKey);
+		} else {
+			ret = ot_setting_index_find(aKey, aIndex);
+			if ((ret >= 0) && (ot_setting_index_delete(ret) != 0)) {
+				return OT_ERROR_FAILED;
+			}
+		}
+
+		if (ret < 0) {
+			LOG_DBG("Entry not found aKey %u aIndex %d", aKey, aIndex);
+			return OT_ERROR_NOT_FOUND;
+		}
+
+		return OT_ERROR_NONE;
+	}
+#endif
+
 	ret = ot_setting_delete_subtree(aKey, aIndex, true);
-	if (ret != 0) {
+	if (ret == -ENOENT) {
 		LOG_DBG("Entry not found aKey %u aIndex %d", aKey, aIndex);
 		return OT_ERROR_NOT_FOUND;
+	} else if (ret != 0) {
+		return OT_ERROR_FAILED;
 	}
 
 	return OT_ERROR_NONE;
@@ -321,6 +622,11 @@ void otPlatSettingsWipe(otInstance *aInstance)
 	ARG_UNUSED(aInstance);
 
 	(void)ot_setting_delete_subtree(-1, -1, true);
+
+#if defined(CONFIG_OPENTHREAD_SETTINGS_INDEX)
+	ot_index_count = 0;
+	ot_index_valid = true;
+#endif
 }
 
 void otPlatSettingsDeinit(otInstance *aInstance)
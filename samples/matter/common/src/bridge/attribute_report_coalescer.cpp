@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "attribute_report_coalescer.h"
+
+#include <app/reporting/reporting.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+
+namespace Nrf
+{
+
+void AttributeReportCoalescer::Report(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId)
+{
+	mStats.mUpdates++;
+
+	for (uint16_t i = 0; i < mPendingCount; i++) {
+		const PendingReport &pending = mPending[i];
+
+		if (pending.mEndpoint == endpoint && pending.mClusterId == clusterId &&
+		    pending.mAttributeId == attributeId) {
+			mStats.mMerged++;
+			return;
+		}
+	}
+
+	if (mPendingCount == kMaxPendingReports) {
+		LOG_DBG("Report coalescing queue full, flushing");
+		Flush();
+	}
+
+	mPending[mPendingCount++] = { endpoint, clusterId, attributeId };
+
+	if (!mTimerActive) {
+		CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(System::Clock::Milliseconds32(kIntervalMs),
+									TimerTimeoutCallback, this);
+		if (err != CHIP_NO_ERROR) {
+			LOG_ERR("Cannot start the report coalescing timer, reporting immediately");
+			Flush();
+			return;
+		}
+		mTimerActive = true;
+	}
+}
+
+void AttributeReportCoalescer::Discard(EndpointId endpoint)
+{
+	uint16_t kept = 0;
+
+	for (uint16_t i = 0; i < mPendingCount; i++) {
+		if (mPending[i].mEndpoint != endpoint) {
+			mPending[kept++] = mPending[i];
+		}
+	}
+
+	mPendingCount = kept;
+}
+
+void AttributeReportCoalescer::Flush()
+{
+	if (mTimerActive) {
+		DeviceLayer::SystemLayer().CancelTimer(TimerTimeoutCallback, this);
+		mTimerActive = false;
+	}
+
+	if (mPendingCount == 0) {
+		return;
+	}
+
+	for (uint16_t i = 0; i < mPendingCount; i++) {
+		MatterReportingAttributeChangeCallback(mPending[i].mEndpoint, mPending[i].mClusterId,
+						       mPending[i].mAttributeId);
+	}
+
+	mStats.mReports += mPendingCount;
+	mStats.mFlushes++;
+	mPendingCount = 0;
+}
+
+void AttributeReportCoalescer::TimerTimeoutCallback(System::Layer *layer, void *context)
+{
+	auto *coalescer = reinterpret_cast<AttributeReportCoalescer *>(context);
+
+	coalescer->mTimerActive = false;
+	coalescer->Flush();
+}
+
+} /* namespace Nrf */
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <app/util/basic-types.h>
+#include <lib/core/CHIPError.h>
+#include <system/SystemLayer.h>
+
+namespace Nrf
+{
+
+/*
+   AttributeReportCoalescer gathers attribute change notifications coming from bridged devices and
+   passes them to the Matter reporting engine once per reporting interval. Repeated changes of the same
+   attribute within one interval are merged into a single notification, so bursts of updates coming
+   from the non-Matter devices do not flood the Matter stack.
+   All methods must be called from the Matter thread.
+*/
+class AttributeReportCoalescer {
+public:
+	struct Stats {
+		uint32_t mUpdates;
+		uint32_t mMerged;
+		uint32_t mReports;
+		uint32_t mFlushes;
+	};
+
+	/**
+	 * @brief Schedule the report of the attribute change.
+	 *
+	 * If the same attribute is already pending, the change is merged with the pending one. If there is no
+	 * space left for a new entry, all pending entries are reported immediately.
+	 *
+	 * @param endpoint endpoint of the changed attribute
+	 * @param clusterId cluster of the changed attribute
+	 * @param attributeId id of the changed attribute
+	 */
+	void Report(chip::EndpointId endpoint, chip::ClusterId clusterId, chip::AttributeId attributeId);
+
+	/**
+	 * @brief Drop all pending reports for the specified endpoint, for example when the endpoint is removed.
+	 *
+	 * @param endpoint endpoint for which the pending reports shall be dropped
+	 */
+	void Discard(chip::EndpointId endpoint);
+
+	/**
+	 * @brief Report all pending attribute changes immediately.
+	 */
+	void Flush();
+
+	const Stats &GetStats() const { return mStats; }
+	void ResetStats() { mStats = {}; }
+
+	static AttributeReportCoalescer &Instance()
+	{
+		static AttributeReportCoalescer sInstance;
+		return sInstance;
+	}
+
+private:
+	static constexpr uint16_t kMaxPendingReports = CONFIG_BRIDGE_REPORT_COALESCING_MAX_PENDING;
+	static constexpr uint32_t kIntervalMs = CONFIG_BRIDGE_REPORT_COALESCING_INTERVAL_MS;
+
+	struct PendingReport {
+		chip::EndpointId mEndpoint;
+		chip::ClusterId mClusterId;
+		chip::AttributeId mAttributeId;
+	};
+
+	static void TimerTimeoutCallback(chip::System::Layer *layer, void *context);
+
+	PendingReport mPending[kMaxPendingReports];
+	uint16_t mPendingCount{ 0 };
+	bool mTimerActive{ false };
+	Stats mStats{};
+};
+
+} /* namespace Nrf */
@@ -5,6 +5,7 @@
  */
 
 #include "bridge_manager.h"
+#include "bridge/attribute_report_coalescer.h"
 #include "bridge/bridge_storage_manager.h"
 
 #include "binding/binding_handler.h"
@@ -120,21 +121,17 @@ CHIP_ERROR BridgeManager::DoAddBridgedDevices(MatterBridgedDevice *devices[], Br
 
 CHIP_ERROR BridgeManager::RemoveBridgedDevice(uint16_t endpoint, uint8_t &devicesPairIndex)
 {
-	uint8_t index = 0;
-	while (index < kMaxBridgedDevices) {
-		if (mDevicesMap.Contains(index)) {
-			auto &devicePair = mDevicesMap[index];
-			if (devicePair.mDevice->GetEndpointId() == endpoint) {
-				LOG_INF("Removed dynamic endpoint %d (index=%d)", endpoint, index);
-				/* Free dynamically allocated memory */
-				emberAfClearDynamicEndpoint(index);
-				devicesPairIndex = index;
-				return SafelyRemoveDevice(index);
-			}
-		}
-		index++;
+	uint16_t index = mEndpointIndexes.Find(endpoint);
+
+	if (!GetPair(index)) {
+		return CHIP_ERROR_NOT_FOUND;
 	}
-	return CHIP_ERROR_NOT_FOUND;
+
+	LOG_INF("Removed dynamic endpoint %d (index=%d)", endpoint, index);
+	/* Free dynamically allocated memory */
+	emberAfClearDynamicEndpoint(index);
+	devicesPairIndex = index;
+	return SafelyRemoveDevice(index);
 }
 
 CHIP_ERROR BridgeManager::SafelyRemoveDevice(uint8_t index)
@@ -143,6 +140,8 @@ CHIP_ERROR BridgeManager::SafelyRemoveDevice(uint8_t index)
 	bool removeProvider = true;
 	auto &devicePair = mDevicesMap[index];
 
+	UntrackPair(index);
+
 	uint8_t duplicatesNumber = mDevicesMap.GetDuplicatesCount(devicePair, duplicatedItemKeys);
 	/* There must be at least 2 duplicates in the map to determine the real duplicate,
        as the one under the current index is also contained in the map. */
@@ -247,6 +246,7 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 			if (err == CHIP_ERROR_NO_MEMORY) {
 				LOG_ERR("The device object was not constructed properly due to the lack of memory");
 			}
+			UntrackPair(index);
 			mDevicesMap.Erase(index);
 		}
 
@@ -266,6 +266,7 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 							}
 							/* The pair was added to a map, so we have to take care about
 							 * removing it in case of failure. */
+							UntrackPair(index);
 							mDevicesMap.Erase(index);
 						}
 
@@ -321,6 +322,7 @@ CHIP_ERROR BridgeManager::CreateEndpoint(uint8_t index, uint16_t endpointId)
 	if (err == CHIP_NO_ERROR) {
 		LOG_INF("Added device to dynamic endpoint %d (index=%d)", endpointId, index);
 		storedDevice->Init(endpointId);
+		TrackPair(index, endpointId);
 		return CHIP_NO_ERROR;
 	} else if (err != CHIP_ERROR_ENDPOINT_EXISTS) {
 		LOG_ERR("Failed to add dynamic endpoint: Internal error!");
@@ -333,6 +335,34 @@ CHIP_ERROR BridgeManager::CreateEndpoint(uint8_t index, uint16_t endpointId)
 	}
 }
 
+void BridgeManager::TrackPair(uint8_t index, uint16_t endpointId)
+{
+	/* The map items are stored in place, so the address of the value stays valid until it is erased. */
+	mDevicesByIndex[index] = &mDevicesMap[index];
+
+	if (!mEndpointIndexes.Insert(endpointId, index)) {
+		LOG_ERR("Cannot add endpoint %d to the lookup table", endpointId);
+	}
+}
+
+void BridgeManager::UntrackPair(uint8_t index)
+{
+	BridgedDevicePair *pair = GetPair(index);
+
+	if (!pair) {
+		return;
+	}
+
+	if (pair->mDevice) {
+		mEndpointIndexes.Erase(pair->mDevice->GetEndpointId());
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+		AttributeReportCoalescer::Instance().Discard(pair->mDevice->GetEndpointId());
+#endif
+	}
+
+	mDevicesByIndex[index] = nullptr;
+}
+
 CHIP_ERROR BridgeManager::AddDevices(MatterBridgedDevice *devices[], BridgedDeviceDataProvider *dataProvider,
 				     uint8_t deviceListSize, chip::Optional<uint8_t> devicesPairIndexes[],
 				     uint16_t endpointIds[])
@@ -376,9 +406,11 @@ CHIP_ERROR BridgeManager::HandleRead(uint16_t index, ClusterId clusterId,
 				     uint16_t maxReadLength)
 {
 	VerifyOrReturnError(attributeMetadata && buffer, CHIP_ERROR_INVALID_ARGUMENT);
-	VerifyOrReturnValue(Instance().mDevicesMap.Contains(index), CHIP_ERROR_INTERNAL);
 
-	auto *device = Instance().mDevicesMap[index].mDevice;
+	BridgedDevicePair *pair = Instance().GetPair(index);
+	VerifyOrReturnValue(pair && pair->mDevice, CHIP_ERROR_INTERNAL);
+
+	auto *device = pair->mDevice;
 
 	/* Handle reads for the generic information for all bridged devices. Provide a valid answer even if device state
 	 * is unreachable. */
@@ -402,9 +434,11 @@ CHIP_ERROR BridgeManager::HandleWrite(uint16_t index, ClusterId clusterId,
 				      const EmberAfAttributeMetadata *attributeMetadata, uint8_t *buffer)
 {
 	VerifyOrReturnError(attributeMetadata && buffer, CHIP_ERROR_INVALID_ARGUMENT);
-	VerifyOrReturnValue(Instance().mDevicesMap.Contains(index), CHIP_ERROR_INTERNAL);
 
-	auto *device = Instance().mDevicesMap[index].mDevice;
+	BridgedDevicePair *pair = Instance().GetPair(index);
+	VerifyOrReturnValue(pair && pair->mDevice && pair->mProvider, CHIP_ERROR_INTERNAL);
+
+	auto *device = pair->mDevice;
 
 	/* Verify if the device is reachable or we should return prematurely. */
 	VerifyOrReturnError(device->GetIsReachable(), CHIP_ERROR_INCORRECT_STATE);
@@ -442,7 +476,7 @@ CHIP_ERROR BridgeManager::HandleWrite(uint16_t index, ClusterId clusterId,
 
 	/* After updating MatterBridgedDevice state, forward request to the non-Matter device. */
 	if (err == CHIP_NO_ERROR) {
-		CHIP_ERROR updateError = Instance().mDevicesMap[index].mProvider->UpdateState(
+		CHIP_ERROR updateError = pair->mProvider->UpdateState(
 			clusterId, attributeMetadata->attributeId, buffer);
 		/* This is acceptable that not all writable attributes can be reflected in the provider device. */
 		if (updateError != CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE) {
@@ -457,15 +491,24 @@ void BridgeManager::HandleUpdate(BridgedDeviceDataProvider &dataProvider, Cluste
 {
 	VerifyOrReturn(data);
 
+	BridgeManager &bridge = Instance();
+
 	/* The state update was triggered by non-Matter device, find bridged Matter device to update it as well.
 	 */
-	for (auto &item : Instance().mDevicesMap.mMap) {
-		if (item.value.mProvider == &dataProvider) {
+	for (uint8_t i = 0; i < bridge.mDevicesIndexesCounter; i++) {
+		BridgedDevicePair *pair = bridge.GetPair(bridge.mDevicesIndexes[i]);
+
+		if (pair && pair->mDevice && pair->mProvider == &dataProvider) {
 			/* If the Bridged Device state was updated successfully, schedule sending Matter data
 			 * report. */
-			auto *device = item.value.mDevice;
+			auto *device = pair->mDevice;
 			if (CHIP_NO_ERROR == device->HandleAttributeChange(clusterId, attributeId, data, dataSize)) {
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+				AttributeReportCoalescer::Instance().Report(device->GetEndpointId(), clusterId,
+									    attributeId);
+#else
 				MatterReportingAttributeChangeCallback(device->GetEndpointId(), clusterId, attributeId);
+#endif
 			}
 		}
 	}
@@ -485,9 +528,13 @@ void BridgeManager::HandleCommand(BridgedDeviceDataProvider &dataProvider, Clust
 	bindingData->ClusterId = clusterId;
 	bindingData->InvokeCommandFunc = invokeCommand;
 
-	for (auto &item : Instance().mDevicesMap.mMap) {
-		if (item.value.mProvider == &dataProvider) {
-			auto *device = item.value.mDevice;
+	BridgeManager &bridge = Instance();
+
+	for (uint8_t i = 0; i < bridge.mDevicesIndexesCounter; i++) {
+		BridgedDevicePair *pair = bridge.GetPair(bridge.mDevicesIndexes[i]);
+
+		if (pair && pair->mDevice && pair->mProvider == &dataProvider) {
+			auto *device = pair->mDevice;
 
 			if (emberAfContainsClient(device->GetEndpointId(), clusterId)) {
 				bindingData->EndpointId = device->GetEndpointId();
@@ -500,11 +547,16 @@ void BridgeManager::HandleCommand(BridgedDeviceDataProvider &dataProvider, Clust
 
 BridgedDeviceDataProvider *BridgeManager::GetProvider(EndpointId endpoint, uint16_t &deviceType)
 {
-	uint16_t endpointIndex = emberAfGetDynamicIndexFromEndpoint(endpoint);
-	if (Instance().mDevicesMap.Contains(endpointIndex)) {
-		BridgedDevicePair &bridgedDevices = Instance().mDevicesMap[endpointIndex];
-		deviceType = bridgedDevices.mDevice->GetDeviceType();
-		return bridgedDevices.mProvider;
+	return GetProviderByIndex(mEndpointIndexes.Find(endpoint), deviceType);
+}
+
+BridgedDeviceDataProvider *BridgeManager::GetProviderByIndex(uint16_t index, uint16_t &deviceType)
+{
+	BridgedDevicePair *pair = GetPair(index);
+
+	if (pair && pair->mDevice) {
+		deviceType = pair->mDevice->GetDeviceType();
+		return pair->mProvider;
 	}
 	return nullptr;
 }
@@ -516,7 +568,7 @@ emberAfExternalAttributeReadCallback(EndpointId endpoint, ClusterId clusterId,
 				     const EmberAfAttributeMetadata *attributeMetadata, uint8_t *buffer,
 				     uint16_t maxReadLength)
 {
-	uint16_t endpointIndex = emberAfGetDynamicIndexFromEndpoint(endpoint);
+	uint16_t endpointIndex = Nrf::BridgeManager::Instance().GetIndex(endpoint);
 
 	if (CHIP_NO_ERROR == Nrf::BridgeManager::Instance().HandleRead(endpointIndex, clusterId, attributeMetadata,
 								       buffer, maxReadLength)) {
@@ -530,7 +582,7 @@ Protocols::InteractionModel::Status
 emberAfExternalAttributeWriteCallback(EndpointId endpoint, ClusterId clusterId,
 				      const EmberAfAttributeMetadata *attributeMetadata, uint8_t *buffer)
 {
-	uint16_t endpointIndex = emberAfGetDynamicIndexFromEndpoint(endpoint);
+	uint16_t endpointIndex = Nrf::BridgeManager::Instance().GetIndex(endpoint);
 
 	if (CHIP_NO_ERROR ==
 	    Nrf::BridgeManager::Instance().HandleWrite(endpointIndex, clusterId, attributeMetadata, buffer)) {
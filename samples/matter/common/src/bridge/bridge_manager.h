@@ -8,6 +8,7 @@
 
 #include "binding/binding_handler.h"
 #include "bridge_util.h"
+#include "endpoint_index_table.h"
 #include "util/finite_map.h"
 #include "bridged_device_data_provider.h"
 #include "matter_bridged_device.h"
@@ -109,6 +110,23 @@ public:
 	 */
 	BridgedDeviceDataProvider *GetProvider(chip::EndpointId endpoint, uint16_t &deviceType);
 
+	/**
+	 * @brief Get the data provider stored under the specified bridged device index.
+	 *
+	 * @param index index of the bridged device, as returned by GetDevicesIndexes()
+	 * @param[out] deviceType a type of the bridged device
+	 * @return pointer to the data provider bridged with the device under the specified index
+	 */
+	BridgedDeviceDataProvider *GetProviderByIndex(uint16_t index, uint16_t &deviceType);
+
+	/**
+	 * @brief Get the bridged device index assigned to the specified endpoint.
+	 *
+	 * @param endpoint endpoint on which the bridged device is stored
+	 * @return index of the bridged device or UINT16_MAX if there is no bridged device on the endpoint
+	 */
+	uint16_t GetIndex(chip::EndpointId endpoint) const { return mEndpointIndexes.Find(endpoint); }
+
 	static CHIP_ERROR HandleRead(uint16_t index, chip::ClusterId clusterId,
 				     const EmberAfAttributeMetadata *attributeMetadata, uint8_t *buffer,
 				     uint16_t maxReadLength);
@@ -246,7 +264,37 @@ private:
 	 */
 	CHIP_ERROR CreateEndpoint(uint8_t index, uint16_t endpointId);
 
+	/**
+	 * @brief Get the bridged device pair stored under the specified index in constant time.
+	 *
+	 * @param index index of the bridged device pair
+	 * @return pointer to the pair or nullptr if there is no pair under the index
+	 */
+	BridgedDevicePair *GetPair(uint16_t index)
+	{
+		return index < kMaxBridgedDevices ? mDevicesByIndex[index] : nullptr;
+	}
+
+	/**
+	 * @brief Register the pair stored in the map under the specified index in the lookup tables.
+	 *
+	 * @param index index of the bridged device pair
+	 * @param endpointId value of endpoint id assigned to the bridged device
+	 */
+	void TrackPair(uint8_t index, uint16_t endpointId);
+
+	/**
+	 * @brief Remove the pair stored in the map under the specified index from the lookup tables.
+	 * It must be called before the pair is erased from the map.
+	 *
+	 * @param index index of the bridged device pair
+	 */
+	void UntrackPair(uint8_t index);
+
 	DeviceMap mDevicesMap;
+	/* Direct lookup tables over mDevicesMap, used on the attribute access hot paths. */
+	BridgedDevicePair *mDevicesByIndex[kMaxBridgedDevices] = { nullptr };
+	EndpointIndexTable<kMaxBridgedDevices> mEndpointIndexes;
 	uint16_t mNumberOfProviders{ 0 };
 	uint8_t mDevicesIndexes[BridgeManager::kMaxBridgedDevices] = { 0 };
 	uint8_t mDevicesIndexesCounter;
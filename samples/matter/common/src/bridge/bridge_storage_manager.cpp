@@ -79,6 +79,12 @@ template <> bool BridgeStorageManager::LoadBridgedDevice(BridgedDeviceV1 &device
 	}
 
 	uint8_t inUserDataSize = device.mUserDataSize;
+	/* The user data is optional, so records of devices that do not use it end here. */
+	if (readSize == counter) {
+		device.mUserDataSize = 0;
+		return true;
+	}
+
 	/* Validate if user buffer size is big enough to fit the stored user data size. */
 	if (readSize < counter + sizeof(device.mUserDataSize)) {
 		return false;
@@ -104,7 +110,8 @@ template <> bool BridgeStorageManager::LoadBridgedDevice(BridgedDeviceV1 &device
 }
 #endif
 
-template <> bool BridgeStorageManager::LoadBridgedDevice(BridgedDeviceV2 &device, uint8_t index)
+#ifdef CONFIG_BRIDGE_MIGRATE_VERSION_2
+bool BridgeStorageManager::LoadBridgedDeviceVersion2(BridgedDeviceV2 &device, uint8_t index)
 {
 	Nrf::PersistentStorageNode id = CreateIndexNode(index, &mBridgedDevice);
 	size_t readSize = 0;
@@ -162,6 +169,12 @@ template <> bool BridgeStorageManager::LoadBridgedDevice(BridgedDeviceV2 &device
 	}
 
 	uint8_t inUserDataSize = device.mUserDataSize;
+	/* The user data is optional, so records of devices that do not use it end here. */
+	if (readSize == counter) {
+		device.mUserDataSize = 0;
+		return true;
+	}
+
 	/* Validate if user buffer size is big enough to fit the stored user data size. */
 	if (readSize < counter + sizeof(device.mUserDataSize)) {
 		return false;
@@ -185,24 +198,292 @@ template <> bool BridgeStorageManager::LoadBridgedDevice(BridgedDeviceV2 &device
 
 	return true;
 }
+#endif
+
+template <> bool BridgeStorageManager::LoadBridgedDevice(BridgedDeviceV2 &device, uint8_t index)
+{
+	uint8_t buffer[kMaxRecordSize];
+	size_t readSize = 0;
+
+	k_mutex_lock(&mLock, K_FOREVER);
+
+	/* The record may not have been committed yet, so the pending changes take precedence over the settings. */
+	PendingRecord *pending = FindPendingRecord(index);
+	if (pending) {
+		bool result = !pending->mRemove && DeserializeRecord(device, pending->mData, pending->mSize);
+		k_mutex_unlock(&mLock);
+		return result;
+	}
+
+	k_mutex_unlock(&mLock);
+
+	Nrf::PersistentStorageNode id = CreateIndexNode(index, &mBridgedDevice);
+
+	if (Nrf::GetPersistentStorage().NonSecureLoad(&id, buffer, sizeof(buffer), readSize) != PSErrorCode::Success) {
+		return false;
+	}
+
+	return DeserializeRecord(device, buffer, readSize);
+}
+
+bool BridgeStorageManager::SerializeRecord(const BridgedDevice &device, uint8_t *buffer, uint16_t &size)
+{
+	uint16_t counter = 0;
+	const bool hasUserData = device.mUserData && device.mUserDataSize > 0;
+
+	if (device.mUniqueIDLength > sizeof(device.mUniqueID) || device.mNodeLabelLength > sizeof(device.mNodeLabel) ||
+	    (hasUserData && device.mUserDataSize > kMaxUserDataSize)) {
+		return false;
+	}
+
+	memcpy(buffer, &device.mEndpointId, sizeof(device.mEndpointId));
+	counter += sizeof(device.mEndpointId);
+	memcpy(buffer + counter, &device.mDeviceType, sizeof(device.mDeviceType));
+	counter += sizeof(device.mDeviceType);
+	buffer[counter++] = static_cast<uint8_t>(device.mUniqueIDLength);
+	memcpy(buffer + counter, device.mUniqueID, device.mUniqueIDLength);
+	counter += device.mUniqueIDLength;
+	buffer[counter++] = static_cast<uint8_t>(device.mNodeLabelLength);
+	memcpy(buffer + counter, device.mNodeLabel, device.mNodeLabelLength);
+	counter += device.mNodeLabelLength;
+
+	/* Check if there are any user data to save. mUserData can be nullptr if not needed. */
+	if (hasUserData) {
+		buffer[counter++] = static_cast<uint8_t>(device.mUserDataSize);
+		memcpy(buffer + counter, device.mUserData, device.mUserDataSize);
+		counter += device.mUserDataSize;
+	}
+
+	size = counter;
+	return true;
+}
+
+bool BridgeStorageManager::DeserializeRecord(BridgedDevice &device, const uint8_t *buffer, size_t size)
+{
+	size_t counter = 0;
+	const size_t mandatoryItemsSize = sizeof(device.mEndpointId) + sizeof(device.mDeviceType) + sizeof(uint8_t);
+
+	/* Validate that read size is big enough to include mandatory data. */
+	if (size < mandatoryItemsSize) {
+		return false;
+	}
+
+	memcpy(&device.mEndpointId, buffer, sizeof(device.mEndpointId));
+	counter += sizeof(device.mEndpointId);
+	memcpy(&device.mDeviceType, buffer + counter, sizeof(device.mDeviceType));
+	counter += sizeof(device.mDeviceType);
+	device.mUniqueIDLength = buffer[counter++];
+
+	/* Validate that read size is big enough to include the unique ID and the node label length. */
+	if (device.mUniqueIDLength > sizeof(device.mUniqueID) || size < counter + device.mUniqueIDLength + 1) {
+		return false;
+	}
+
+	memcpy(device.mUniqueID, buffer + counter, device.mUniqueIDLength);
+	counter += device.mUniqueIDLength;
+	device.mNodeLabelLength = buffer[counter++];
+
+	/* Validate that read size is big enough to include the node label. */
+	if (device.mNodeLabelLength > sizeof(device.mNodeLabel) || size < counter + device.mNodeLabelLength) {
+		return false;
+	}
+
+	memcpy(device.mNodeLabel, buffer + counter, device.mNodeLabelLength);
+	counter += device.mNodeLabelLength;
+
+	/* Check if user prepared a buffer for reading user data. It can be nullptr if not needed. */
+	if (!device.mUserData) {
+		device.mUserDataSize = 0;
+		return true;
+	}
+
+	/* The user data is optional, so records of devices that do not use it end here. */
+	if (size == counter) {
+		device.mUserDataSize = 0;
+		return true;
+	}
+
+	if (size < counter + sizeof(uint8_t)) {
+		return false;
+	}
+
+	const size_t storedUserDataSize = buffer[counter++];
+
+	/* Validate that user data size value read from the storage is not bigger than the one expected by the user and
+	 * that the record is big enough to include it. */
+	if (device.mUserDataSize < storedUserDataSize || size < counter + storedUserDataSize) {
+		return false;
+	}
+
+	device.mUserDataSize = storedUserDataSize;
+	memcpy(device.mUserData, buffer + counter, device.mUserDataSize);
+
+	return true;
+}
 
 bool BridgeStorageManager::Init()
 {
 	const PSErrorCode status = Nrf::GetPersistentStorage().NonSecureInit(&mBridge);
+	size_t indexesCount = 0;
 
 	if (status != PSErrorCode::Success) {
 		return false;
 	}
 
+	/* The indexes list format is the same in all scheme versions, so load it once and keep it in RAM. */
+	if (Nrf::GetPersistentStorage().NonSecureLoad(&mBridgedDevicesIndexes, mIndexes, sizeof(mIndexes),
+						      indexesCount) == PSErrorCode::Success) {
+		mIndexesCount = static_cast<uint8_t>(indexesCount);
+	} else {
+		mIndexesCount = 0;
+	}
+
 	/* Perform data migration from previous data structure versions if needed. */
 	return MigrateData();
 }
 
 void BridgeStorageManager::FactoryReset()
 {
+	k_work_cancel_delayable(&mCommitWork);
+
+	k_mutex_lock(&mLock, K_FOREVER);
+	mPendingRecordsCount = 0;
+	mIndexesCount = 0;
+	mIndexesDirty = false;
+	k_mutex_unlock(&mLock);
+
 	Nrf::GetPersistentStorage().NonSecureFactoryReset();
 }
 
+BridgeStorageManager::PendingRecord *BridgeStorageManager::FindPendingRecord(uint8_t index)
+{
+	for (uint8_t i = 0; i < mPendingRecordsCount; i++) {
+		if (mPendingRecords[i].mIndex == index) {
+			return &mPendingRecords[i];
+		}
+	}
+
+	return nullptr;
+}
+
+BridgeStorageManager::PendingRecord *BridgeStorageManager::AcquirePendingRecord(uint8_t index)
+{
+	PendingRecord *pending = FindPendingRecord(index);
+
+	if (pending) {
+		return pending;
+	}
+
+	/* No free slot left, write all gathered changes to make space for the new one. */
+	if (mPendingRecordsCount == kMaxPendingRecords && !CommitLocked()) {
+		return nullptr;
+	}
+
+	pending = &mPendingRecords[mPendingRecordsCount++];
+	pending->mIndex = index;
+
+	return pending;
+}
+
+void BridgeStorageManager::ScheduleCommit()
+{
+	/* Do not postpone the already scheduled commit, so the data is not kept in RAM for too long. */
+	k_work_schedule(&mCommitWork, K_MSEC(CONFIG_BRIDGE_STORAGE_COMMIT_DELAY_MS));
+}
+
+void BridgeStorageManager::CommitWorkHandler(k_work *work)
+{
+	if (!Instance().Commit()) {
+		LOG_ERR("Failed to commit bridged devices to the storage");
+	}
+}
+
+bool BridgeStorageManager::Commit()
+{
+	k_mutex_lock(&mLock, K_FOREVER);
+	bool result = CommitLocked();
+	k_mutex_unlock(&mLock);
+
+	return result;
+}
+
+bool BridgeStorageManager::CommitLocked()
+{
+	bool result = true;
+	uint8_t kept = 0;
+
+	if (mPendingRecordsCount == 0 && !mIndexesDirty) {
+		return true;
+	}
+
+	for (uint8_t i = 0; i < mPendingRecordsCount; i++) {
+		PendingRecord &pending = mPendingRecords[i];
+		Nrf::PersistentStorageNode id = CreateIndexNode(pending.mIndex, &mBridgedDevice);
+		PSErrorCode status;
+
+		if (pending.mRemove) {
+			status = Nrf::GetPersistentStorage().NonSecureRemove(&id);
+			mStats.mRecordRemovals++;
+		} else {
+			status = Nrf::GetPersistentStorage().NonSecureStore(&id, pending.mData, pending.mSize);
+			mStats.mRecordWrites++;
+		}
+
+		if (status != PSErrorCode::Success) {
+			result = false;
+
+			/* Keep the failed writes pending, so they are retried with the next commit. A failed removal is
+			 * not retried, as the record may have never been committed. */
+			if (!pending.mRemove) {
+				mPendingRecords[kept++] = pending;
+			}
+		}
+	}
+
+	mPendingRecordsCount = kept;
+
+	if (mIndexesDirty) {
+		if (Nrf::GetPersistentStorage().NonSecureStore(&mBridgedDevicesIndexes, mIndexes, mIndexesCount) ==
+		    PSErrorCode::Success) {
+			mIndexesDirty = false;
+			mStats.mIndexesWrites++;
+		} else {
+			result = false;
+		}
+	}
+
+	mStats.mCommits++;
+
+	return result;
+}
+
+BridgeStorageManager::Stats BridgeStorageManager::GetStats()
+{
+	k_mutex_lock(&mLock, K_FOREVER);
+	Stats stats = mStats;
+	k_mutex_unlock(&mLock);
+
+	return stats;
+}
+
+bool BridgeStorageManager::IsBridgedDeviceStored(uint8_t index)
+{
+	bool stored = false;
+
+	k_mutex_lock(&mLock, K_FOREVER);
+
+	for (uint8_t i = 0; i < mIndexesCount; i++) {
+		if (mIndexes[i] == index) {
+			stored = true;
+			break;
+		}
+	}
+
+	k_mutex_unlock(&mLock);
+
+	return stored;
+}
+
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
 bool BridgeStorageManager::MigrateDataOldScheme(uint8_t bridgedDeviceIndex)
 {
@@ -241,8 +522,8 @@ bool BridgeStorageManager::MigrateDataOldScheme(uint8_t bridgedDeviceIndex)
 	}
 	device.mUniqueIDLength = strlen(device.mUniqueID);
 
-	/* Store all information using a new scheme. */
-	if (!StoreBridgedDevice(device, bridgedDeviceIndex)) {
+	/* Store all information using a new scheme. The old keys are removed only when the new record is written. */
+	if (!StoreMigratedBridgedDevice(device, bridgedDeviceIndex)) {
 		return false;
 	}
 
@@ -295,11 +576,44 @@ bool BridgeStorageManager::MigrateDataVersion1(uint8_t bridgedDeviceIndex)
 	device.mUniqueIDLength = strlen(device.mUniqueID);
 
 	/* Store all information using new scheme */
-	if (!StoreBridgedDevice(device, bridgedDeviceIndex)) {
+	return StoreMigratedBridgedDevice(device, bridgedDeviceIndex);
+}
+#endif
+
+#ifdef CONFIG_BRIDGE_MIGRATE_VERSION_2
+bool BridgeStorageManager::MigrateDataVersion2(uint8_t bridgedDeviceIndex)
+{
+	BridgedDeviceV2 device;
+	uint8_t userData[kMaxUserDataSize];
+
+	/* Load the optional user data as well, as its content is implementation specific. */
+	device.mUserDataSize = sizeof(userData);
+	device.mUserData = userData;
+
+	if (!LoadBridgedDeviceVersion2(device, bridgedDeviceIndex)) {
 		return false;
 	}
 
-	return true;
+	/* The in-memory representation is the same, only the record format changes. */
+	return StoreMigratedBridgedDevice(device, bridgedDeviceIndex);
+}
+#endif
+
+#if defined(CONFIG_BRIDGE_MIGRATE_PRE_2_7_0) || defined(CONFIG_BRIDGE_MIGRATE_VERSION_1) ||                          \
+	defined(CONFIG_BRIDGE_MIGRATE_VERSION_2)
+bool BridgeStorageManager::StoreMigratedBridgedDevice(BridgedDevice &device, uint8_t index)
+{
+	if (!StoreBridgedDevice(device, index)) {
+		return false;
+	}
+
+	/* Do not wait for the deferred commit, as the migrated record must be in the storage before the old data is
+	 * removed or the version is updated. */
+	k_mutex_lock(&mLock, K_FOREVER);
+	const bool result = CommitLocked();
+	k_mutex_unlock(&mLock);
+
+	return result;
 }
 #endif
 
@@ -324,38 +638,52 @@ bool BridgeStorageManager::MigrateData()
 		return false;
 	}
 
-	uint8_t count;
-	uint8_t indexes[BridgeManager::kMaxBridgedDevices] = { 0 };
-	size_t indexesCount = 0;
-
-	if (LoadBridgedDevicesCount(count) &&
-	    LoadBridgedDevicesIndexes(indexes, BridgeManager::kMaxBridgedDevices, indexesCount)) {
-		/* Migrate all devices */
-		for (size_t i = 0; i < indexesCount; i++) {
-			if (!versionPresent) {
+	/* The indexes list was already loaded by Init(). */
+	for (uint8_t i = 0; i < mIndexesCount; i++) {
+		if (!versionPresent) {
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
-				if (!MigrateDataOldScheme(indexes[i])) {
-					return false;
-				}
-#else
-				/* Migration not enabled */
-				LOG_ERR("Migration of old data scheme not enabled.");
+			if (!MigrateDataOldScheme(mIndexes[i])) {
 				return false;
+			}
+#else
+			/* Migration not enabled */
+			LOG_ERR("Migration of old data scheme not enabled.");
+			return false;
 #endif
-			} else if (version == 1) {
+		} else if (version == 1) {
 #ifdef CONFIG_BRIDGE_MIGRATE_VERSION_1
-				if (!MigrateDataVersion1(indexes[i])) {
-					return false;
-				}
-#else
-				/* Migration not enabled */
-				LOG_ERR("Migration of data scheme version 1 not enabled.");
+			if (!MigrateDataVersion1(mIndexes[i])) {
 				return false;
+			}
+#else
+			/* Migration not enabled */
+			LOG_ERR("Migration of data scheme version 1 not enabled.");
+			return false;
 #endif
+		} else if (version == 2) {
+#ifdef CONFIG_BRIDGE_MIGRATE_VERSION_2
+			if (!MigrateDataVersion2(mIndexes[i])) {
+				return false;
 			}
+#else
+			/* Migration not enabled */
+			LOG_ERR("Migration of data scheme version 2 not enabled.");
+			return false;
+#endif
 		}
 	}
 
+	/* Write the migrated records before the version is bumped. */
+	if (!Commit()) {
+		return false;
+	}
+
+#if defined(CONFIG_BRIDGE_MIGRATE_PRE_2_7_0) || defined(CONFIG_BRIDGE_MIGRATE_VERSION_1) ||                          \
+	defined(CONFIG_BRIDGE_MIGRATE_VERSION_2)
+	/* The devices count is derived from the indexes list since version 3. */
+	Nrf::GetPersistentStorage().NonSecureRemove(&mBridgedDevicesCount);
+#endif
+
 	/* Store current version */
 	version = kCurrentVersion;
 	const PSErrorCode status = Nrf::GetPersistentStorage().NonSecureStore(&mVersion, &version, sizeof(version));
@@ -363,40 +691,51 @@ bool BridgeStorageManager::MigrateData()
 	return status == PSErrorCode::Success;
 }
 
-bool BridgeStorageManager::StoreBridgedDevicesCount(uint8_t count)
-{
-	const PSErrorCode status =
-		Nrf::GetPersistentStorage().NonSecureStore(&mBridgedDevicesCount, &count, sizeof(count));
-
-	return status == PSErrorCode::Success;
-}
-
 bool BridgeStorageManager::LoadBridgedDevicesCount(uint8_t &count)
 {
-	return LoadDataToObject(&mBridgedDevicesCount, count);
+	k_mutex_lock(&mLock, K_FOREVER);
+	count = mIndexesCount;
+	k_mutex_unlock(&mLock);
+
+	return count > 0;
 }
 
 bool BridgeStorageManager::StoreBridgedDevicesIndexes(uint8_t *indexes, uint8_t count)
 {
-	if (!indexes) {
+	if (!indexes || count > kMaxBridgedDevices) {
 		return false;
 	}
 
-	const PSErrorCode status = Nrf::GetPersistentStorage().NonSecureStore(&mBridgedDevicesIndexes, indexes, count);
+	k_mutex_lock(&mLock, K_FOREVER);
+	memcpy(mIndexes, indexes, count);
+	mIndexesCount = count;
+	mIndexesDirty = true;
+	k_mutex_unlock(&mLock);
 
-	return status == PSErrorCode::Success;
+	ScheduleCommit();
+
+	return true;
 }
 
 bool BridgeStorageManager::LoadBridgedDevicesIndexes(uint8_t *indexes, uint8_t maxCount, size_t &count)
 {
+	bool result = false;
+
 	if (!indexes) {
 		return false;
 	}
 
-	const PSErrorCode status =
-		Nrf::GetPersistentStorage().NonSecureLoad(&mBridgedDevicesIndexes, indexes, maxCount, count);
+	k_mutex_lock(&mLock, K_FOREVER);
 
-	return status == PSErrorCode::Success;
+	if (mIndexesCount <= maxCount) {
+		memcpy(indexes, mIndexes, mIndexesCount);
+		count = mIndexesCount;
+		result = true;
+	}
+
+	k_mutex_unlock(&mLock);
+
+	return result;
 }
 
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
@@ -450,47 +789,52 @@ bool BridgeStorageManager::RemoveBridgedDeviceType(uint8_t bridgedDeviceIndex)
 
 bool BridgeStorageManager::StoreBridgedDevice(BridgedDevice &device, uint8_t index)
 {
-	uint8_t buffer[sizeof(BridgedDevice) + kMaxUserDataSize];
-	uint16_t counter = 0;
-	Nrf::PersistentStorageNode id = CreateIndexNode(index, &mBridgedDevice);
+	uint8_t buffer[kMaxRecordSize];
+	uint16_t size = 0;
 
-	/* Serialize data structure and insert it into buffer. */
-	memcpy(buffer, &device.mEndpointId, sizeof(device.mEndpointId));
-	counter += sizeof(device.mEndpointId);
-	memcpy(buffer + counter, &device.mDeviceType, sizeof(device.mDeviceType));
-	counter += sizeof(device.mDeviceType);
-	memcpy(buffer + counter, &device.mUniqueIDLength, sizeof(device.mUniqueIDLength));
-	counter += sizeof(device.mUniqueIDLength);
-	memcpy(buffer + counter, device.mUniqueID, device.mUniqueIDLength);
-	counter += device.mUniqueIDLength;
-	memcpy(buffer + counter, &device.mNodeLabelLength, sizeof(device.mNodeLabelLength));
-	counter += sizeof(device.mNodeLabelLength);
-	memcpy(buffer + counter, device.mNodeLabel, device.mNodeLabelLength);
-	counter += device.mNodeLabelLength;
+	if (!SerializeRecord(device, buffer, size)) {
+		return false;
+	}
 
-	/* Check if there are any user data to save. mUserData can be nullptr if not needed. */
-	if (device.mUserData && device.mUserDataSize > 0) {
-		if (device.mUserDataSize > kMaxUserDataSize) {
-			return false;
-		}
+	k_mutex_lock(&mLock, K_FOREVER);
 
-		memcpy(buffer + counter, &device.mUserDataSize, sizeof(device.mUserDataSize));
-		counter += sizeof(device.mUserDataSize);
-		memcpy(buffer + counter, device.mUserData, device.mUserDataSize);
-		counter += device.mUserDataSize;
+	PendingRecord *pending = AcquirePendingRecord(index);
+	if (pending) {
+		pending->mRemove = false;
+		pending->mSize = size;
+		memcpy(pending->mData, buffer, size);
 	}
 
-	const PSErrorCode status = Nrf::GetPersistentStorage().NonSecureStore(&id, buffer, counter);
+	k_mutex_unlock(&mLock);
 
-	return status == PSErrorCode::Success;
+	if (!pending) {
+		return false;
+	}
+
+	ScheduleCommit();
+
+	return true;
 }
 
 bool BridgeStorageManager::RemoveBridgedDevice(uint8_t index)
 {
-	Nrf::PersistentStorageNode id = CreateIndexNode(index, &mBridgedDevice);
-	const PSErrorCode status = Nrf::GetPersistentStorage().NonSecureRemove(&id);
+	k_mutex_lock(&mLock, K_FOREVER);
 
-	return status == PSErrorCode::Success;
+	PendingRecord *pending = AcquirePendingRecord(index);
+	if (pending) {
+		pending->mRemove = true;
+		pending->mSize = 0;
+	}
+
+	k_mutex_unlock(&mLock);
+
+	if (!pending) {
+		return false;
+	}
+
+	ScheduleCommit();
+
+	return true;
 }
 
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
@@ -9,6 +9,8 @@
 #include "matter_bridged_device.h"
 #include "persistent_storage/persistent_storage.h"
 
+#include <zephyr/kernel.h>
+
 #ifdef CONFIG_BRIDGED_DEVICE_BT
 #include <zephyr/bluetooth/addr.h>
 #endif
@@ -20,26 +22,39 @@ namespace Nrf
  * The class implements the following key-values storage structure:
  *
  * /br/
- *		/brd_cnt/ /<uint8_t>/
- *		/brd_ids/ /<uint8_t[brd_cnt]>/
+ *		/brd_ids/ /<uint8_t[count]>/
  * 		/brd/
- *			/0/ /<BridgedDevice>/
- *			/1/ /<BridgedDevice>/
+ *			/0/ /<BridgedDevice record>/
+ *			/1/ /<BridgedDevice record>/
  *			.
  *			.
- *			/n/ /<BridgedDevice>/
+ *			/n/ /<BridgedDevice record>/
  *		/ver/ <uint8_t>
+ *
+ * Since version 3 the number of devices is derived from the size of the indexes list and each device is stored as a
+ * single compact record:
+ *
+ *	<uint16_t endpoint id><uint16_t device type><uint8_t unique id length><unique id>
+ *	<uint8_t node label length><node label>[<uint8_t user data size><user data>]
+ *
+ * The indexes list is cached in RAM. Device records and the indexes list are not written immediately, but gathered
+ * and committed together after CONFIG_BRIDGE_STORAGE_COMMIT_DELAY_MS, so adding or removing several devices results
+ * in a minimal number of flash writes.
  */
 class BridgeStorageManager {
 public:
 	static inline constexpr auto kMaxUserDataSize = 128u;
 
 	constexpr static auto kBridgePrefix = "br";
-	constexpr static auto kBridgedDevicesCountPrefix = "brd_cnt";
 	constexpr static auto kBridgedDevicesIndexesPrefix = "brd_ids";
 	constexpr static auto kBridgedDevicePrefix = "brd";
 	constexpr static auto kVersionPrefix = "ver";
 
+#if defined(CONFIG_BRIDGE_MIGRATE_PRE_2_7_0) || defined(CONFIG_BRIDGE_MIGRATE_VERSION_1) ||                          \
+	defined(CONFIG_BRIDGE_MIGRATE_VERSION_2)
+	constexpr static auto kBridgedDevicesCountPrefix = "brd_cnt";
+#endif
+
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
 	constexpr static auto kBridgedDeviceEndpointIdPrefix = "eid";
 	constexpr static auto kBridgedDeviceLabelPrefix = "label";
@@ -72,17 +87,34 @@ public:
 		uint8_t *mUserData = nullptr;
 	};
 
+	/* Version 3 keeps the same in-memory representation as version 2 and changes only the stored record format. */
 	using BridgedDevice = BridgedDeviceV2;
-	static constexpr uint8_t kCurrentVersion = 2;
+	static constexpr uint8_t kCurrentVersion = 3;
 
 	static constexpr auto kMaxIndexLength = 3;
+	static constexpr uint8_t kMaxBridgedDevices = CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT;
+	static constexpr size_t kMaxRecordSize = sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint8_t) +
+						 MatterBridgedDevice::kUniqueIDSize + sizeof(uint8_t) +
+						 MatterBridgedDevice::kNodeLabelSize + sizeof(uint8_t) + kMaxUserDataSize;
+	static constexpr uint8_t kMaxPendingRecords = CONFIG_BRIDGE_STORAGE_MAX_PENDING_RECORDS;
+
+	struct Stats {
+		uint32_t mRecordWrites;
+		uint32_t mRecordRemovals;
+		uint32_t mIndexesWrites;
+		uint32_t mCommits;
+	};
 
 	BridgeStorageManager()
 		: mBridge(kBridgePrefix, strlen(kBridgePrefix)),
-		  mBridgedDevicesCount(kBridgedDevicesCountPrefix, strlen(kBridgedDevicesCountPrefix), &mBridge),
 		  mBridgedDevicesIndexes(kBridgedDevicesIndexesPrefix, strlen(kBridgedDevicesIndexesPrefix), &mBridge),
 		  mBridgedDevice(kBridgedDevicePrefix, strlen(kBridgedDevicePrefix), &mBridge),
 		  mVersion(kVersionPrefix, strlen(kVersionPrefix), &mBridge)
+#if defined(CONFIG_BRIDGE_MIGRATE_PRE_2_7_0) || defined(CONFIG_BRIDGE_MIGRATE_VERSION_1) ||                          \
+	defined(CONFIG_BRIDGE_MIGRATE_VERSION_2)
+		  ,
+		  mBridgedDevicesCount(kBridgedDevicesCountPrefix, strlen(kBridgedDevicesCountPrefix), &mBridge)
+#endif
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
 		  ,
 		  mBridgedDeviceEndpointId(kBridgedDeviceEndpointIdPrefix, strlen(kBridgedDeviceEndpointIdPrefix),
@@ -97,6 +129,8 @@ public:
 #endif
 #endif
 	{
+		k_mutex_init(&mLock);
+		k_work_init_delayable(&mCommitWork, CommitWorkHandler);
 	}
 
 	static BridgeStorageManager &Instance()
@@ -119,35 +153,30 @@ public:
 	void FactoryReset();
 
 	/**
-	 * @brief Store bridged devices count into settings
+	 * @brief Load bridged devices count.
 	 *
-	 * @param count count value to be stored
-	 * @return true if key has been written successfully
-	 * @return false an error occurred
-	 */
-	bool StoreBridgedDevicesCount(uint8_t count);
-
-	/**
-	 * @brief Load bridged devices count from settings
+	 * The count is derived from the cached indexes list, so it does not access the settings.
 	 *
 	 * @param count reference to the count object to be filled with loaded data
-	 * @return true if key has been loaded successfully
-	 * @return false an error occurred
+	 * @return true if there is at least one bridged device stored
+	 * @return false there are no bridged devices stored
 	 */
 	bool LoadBridgedDevicesCount(uint8_t &count);
 
 	/**
 	 * @brief Store bridged devices indexes into settings
 	 *
+	 * The indexes list is updated in RAM immediately and written to the settings with the next commit.
+	 *
 	 * @param indexes address of array containing indexes to be stored
 	 * @param count size of indexes array to be stored
-	 * @return true if key has been written successfully
+	 * @return true if the indexes list has been updated successfully
 	 * @return false an error occurred
 	 */
 	bool StoreBridgedDevicesIndexes(uint8_t *indexes, uint8_t count);
 
 	/**
-	 * @brief Load bridged devices indexes from settings
+	 * @brief Load bridged devices indexes from the cached indexes list
 	 *
 	 * @param indexes address of indexes array to be filled with loaded data
 	 * @param maxCount maximum size that can be used for indexes array
@@ -171,13 +200,24 @@ public:
 	 */
 	template <typename T = BridgedDevice> bool LoadBridgedDevice(T &device, uint8_t index);
 
+	/**
+	 * @brief Check if the bridged device is present in the cached indexes list, without accessing the settings.
+	 *
+	 * @param index index describing specific bridged device
+	 * @return true if the bridged device is stored
+	 * @return false the bridged device is not stored
+	 */
+	bool IsBridgedDeviceStored(uint8_t index);
+
 	/**
 	 * @brief Store bridged device into settings. Helper method allowing to store endpoint id, node label and device
 	 * type of specific bridged device using a single call.
 	 *
+	 * The record is serialized immediately and written to the settings with the next commit.
+	 *
 	 * @param device instance of bridged device object to be stored
 	 * @param index index describing specific bridged device
-	 * @return true if key has been written successfully
+	 * @return true if the record has been scheduled for storing successfully
 	 * @return false an error occurred
 	 */
 	bool StoreBridgedDevice(BridgedDevice &device, uint8_t index);
@@ -185,13 +225,91 @@ public:
 	/**
 	 * @brief Remove bridged device entry from settings
 	 *
+	 * The record is removed from the settings with the next commit.
+	 *
 	 * @param bridgedDeviceIndex index describing specific bridged device to be removed
-	 * @return true if key entry has been removed successfully
+	 * @return true if the record has been scheduled for removal successfully
 	 * @return false an error occurred
 	 */
 	bool RemoveBridgedDevice(uint8_t bridgedDeviceIndex);
 
+	/**
+	 * @brief Write all pending device records and the indexes list to the settings immediately.
+	 *
+	 * @return true if all pending changes have been written successfully
+	 * @return false an error occurred
+	 */
+	bool Commit();
+
+	/**
+	 * @brief Get the storage statistics.
+	 *
+	 * @return storage statistics gathered since the boot
+	 */
+	Stats GetStats();
+
 private:
+	struct PendingRecord {
+		uint8_t mIndex;
+		bool mRemove;
+		uint16_t mSize;
+		uint8_t mData[kMaxRecordSize];
+	};
+
+	static void CommitWorkHandler(k_work *work);
+
+	/**
+	 * @brief Find the pending record for the given index. Must be called with the lock taken.
+	 *
+	 * @param index index describing specific bridged device
+	 * @return pointer to the pending record or nullptr if there is none
+	 */
+	PendingRecord *FindPendingRecord(uint8_t index);
+
+	/**
+	 * @brief Get a pending record slot for the given index, committing the pending changes if there is no free
+	 * slot. Must be called with the lock taken.
+	 *
+	 * @param index index describing specific bridged device
+	 * @return pointer to the pending record or nullptr if the commit failed
+	 */
+	PendingRecord *AcquirePendingRecord(uint8_t index);
+
+	/**
+	 * @brief Schedule the deferred commit of the pending changes.
+	 */
+	void ScheduleCommit();
+
+	/**
+	 * @brief Write all pending changes to the settings. Must be called with the lock taken.
+	 *
+	 * @return true if all pending changes have been written successfully
+	 * @return false an error occurred
+	 */
+	bool CommitLocked();
+
+	/**
+	 * @brief Serialize the bridged device into the version 3 record format.
+	 *
+	 * @param device instance of bridged device object to be serialized
+	 * @param buffer buffer of kMaxRecordSize bytes to be filled with the record
+	 * @param size reference to the object to be filled with the record size
+	 * @return true on success
+	 * @return false the device does not fit the record
+	 */
+	static bool SerializeRecord(const BridgedDevice &device, uint8_t *buffer, uint16_t &size);
+
+	/**
+	 * @brief Deserialize the bridged device from the version 3 record format.
+	 *
+	 * @param device instance of bridged device object to be filled. See LoadBridgedDevice() for user data handling.
+	 * @param buffer buffer containing the record
+	 * @param size size of the record
+	 * @return true on success
+	 * @return false the record is malformed or the user data does not fit the user buffer
+	 */
+	static bool DeserializeRecord(BridgedDevice &device, const uint8_t *buffer, size_t size);
+
 	/**
 	 * @brief Provides backward compatibility between non-compatible data scheme versions.
 	 *
@@ -231,6 +349,42 @@ private:
 	bool MigrateDataVersion1(uint8_t bridgedDeviceIndex);
 #endif
 
+#ifdef CONFIG_BRIDGE_MIGRATE_VERSION_2
+	/**
+	 * @brief Migrate bridged device data at given index.
+	 *
+	 * It migrates bridge device record from version 2 to current one.
+	 *
+	 * @param bridgedDeviceIndex index describing specific bridged device to be migrated
+	 * @return true if migration was successful
+	 * @return false an error occurred
+	 */
+	bool MigrateDataVersion2(uint8_t bridgedDeviceIndex);
+
+	/**
+	 * @brief Load bridged device stored in version 2 record format.
+	 *
+	 * @param device instance of bridged device object to be filled with loaded data
+	 * @param index index describing specific bridged device
+	 * @return true if key has been loaded successfully
+	 * @return false an error occurred
+	 */
+	bool LoadBridgedDeviceVersion2(BridgedDeviceV2 &device, uint8_t index);
+#endif
+
+#if defined(CONFIG_BRIDGE_MIGRATE_PRE_2_7_0) || defined(CONFIG_BRIDGE_MIGRATE_VERSION_1) ||                          \
+	defined(CONFIG_BRIDGE_MIGRATE_VERSION_2)
+	/**
+	 * @brief Store the migrated bridged device and write it to the settings immediately.
+	 *
+	 * @param device instance of bridged device object to be stored
+	 * @param index index describing specific bridged device
+	 * @return true if the record has been written successfully
+	 * @return false an error occurred
+	 */
+	bool StoreMigratedBridgedDevice(BridgedDevice &device, uint8_t index);
+#endif
+
 	/* The below methods are deprecated and used only for the migration purposes between the older scheme versions.
 	 */
 
@@ -318,11 +472,25 @@ private:
 #endif
 
 	Nrf::PersistentStorageNode mBridge;
-	Nrf::PersistentStorageNode mBridgedDevicesCount;
 	Nrf::PersistentStorageNode mBridgedDevicesIndexes;
 	Nrf::PersistentStorageNode mBridgedDevice;
 	Nrf::PersistentStorageNode mVersion;
 
+#if defined(CONFIG_BRIDGE_MIGRATE_PRE_2_7_0) || defined(CONFIG_BRIDGE_MIGRATE_VERSION_1) ||                          \
+	defined(CONFIG_BRIDGE_MIGRATE_VERSION_2)
+	/* Used only to remove the devices count key stored by the older scheme versions. */
+	Nrf::PersistentStorageNode mBridgedDevicesCount;
+#endif
+
+	k_mutex mLock;
+	k_work_delayable mCommitWork;
+	uint8_t mIndexes[kMaxBridgedDevices] = { 0 };
+	uint8_t mIndexesCount = 0;
+	bool mIndexesDirty = false;
+	PendingRecord mPendingRecords[kMaxPendingRecords];
+	uint8_t mPendingRecordsCount = 0;
+	Stats mStats{};
+
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
 	/* The below fields are deprecated and used only for the migration purposes between the older scheme versions.
 	 */
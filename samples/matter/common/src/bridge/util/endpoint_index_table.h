@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace Nrf
+{
+
+/*
+   EndpointIndexTable maps Matter endpoint ids to bridged device indexes in constant time.
+   It is an open addressing hash table with linear probing. Dynamic endpoint ids are assigned
+   monotonically, so the low bits of the endpoint id are used directly as a hash, which spreads
+   consecutive endpoints over consecutive slots.
+   The table size is a power of two at least twice as big as the maximum number of entries, so the
+   probe sequences stay short. Erasing uses backward shift deletion, so no tombstones are needed.
+*/
+template <uint16_t N> class EndpointIndexTable {
+public:
+	static constexpr uint16_t kInvalidIndex{ std::numeric_limits<uint16_t>::max() };
+
+	bool Insert(uint16_t endpoint, uint16_t index)
+	{
+		if (mCount >= N) {
+			return false;
+		}
+
+		uint16_t slot = Home(endpoint);
+		while (mSlots[slot].mUsed) {
+			if (mSlots[slot].mEndpoint == endpoint) {
+				mSlots[slot].mIndex = index;
+				return true;
+			}
+			slot = Next(slot);
+		}
+
+		mSlots[slot] = { endpoint, index, true };
+		mCount++;
+		return true;
+	}
+
+	uint16_t Find(uint16_t endpoint) const
+	{
+		uint16_t slot = Home(endpoint);
+		while (mSlots[slot].mUsed) {
+			if (mSlots[slot].mEndpoint == endpoint) {
+				return mSlots[slot].mIndex;
+			}
+			slot = Next(slot);
+		}
+		return kInvalidIndex;
+	}
+
+	bool Erase(uint16_t endpoint)
+	{
+		uint16_t slot = Home(endpoint);
+		while (mSlots[slot].mUsed && mSlots[slot].mEndpoint != endpoint) {
+			slot = Next(slot);
+		}
+
+		if (!mSlots[slot].mUsed) {
+			return false;
+		}
+
+		/* Move back the following entries of the cluster that would otherwise become unreachable. */
+		uint16_t hole = slot;
+		for (uint16_t next = Next(hole); mSlots[next].mUsed; next = Next(next)) {
+			uint16_t home = Home(mSlots[next].mEndpoint);
+			bool canMove = (hole <= next) ? (home <= hole || home > next) : (home <= hole && home > next);
+			if (canMove) {
+				mSlots[hole] = mSlots[next];
+				hole = next;
+			}
+		}
+
+		mSlots[hole] = {};
+		mCount--;
+		return true;
+	}
+
+	uint16_t Size() const { return mCount; }
+
+private:
+	static constexpr uint16_t RoundUpToPowerOfTwo(uint16_t value)
+	{
+		uint16_t result = 1;
+		while (result < value) {
+			result <<= 1;
+		}
+		return result;
+	}
+
+	static constexpr uint16_t kSize = RoundUpToPowerOfTwo(2 * N);
+	static constexpr uint16_t kMask = kSize - 1;
+
+	static constexpr uint16_t Home(uint16_t endpoint) { return endpoint & kMask; }
+	static constexpr uint16_t Next(uint16_t slot) { return (slot + 1) & kMask; }
+
+	struct Slot {
+		uint16_t mEndpoint{ 0 };
+		uint16_t mIndex{ kInvalidIndex };
+		bool mUsed{ false };
+	};
+
+	Slot mSlots[kSize];
+	uint16_t mCount{ 0 };
+};
+
+} /* namespace Nrf */
@@ -0,0 +1,337 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+"""
+Utility for creating delta patches for the MCUBoot delta DFU target.
+
+A delta patch describes an MCUBoot application image (the target) in terms of
+the image currently running on the device (the source), so that only the
+differences need to be downloaded. The patch consists of a fixed header
+followed by a payload, which can be LZMA2 compressed:
+
+    struct header {             /* little endian */
+        uint32_t magic;         /* "DLTA" */
+        uint8_t  version;       /* 1 */
+        uint8_t  compression;   /* 0 - none, 1 - LZMA2 */
+        uint16_t reserved;
+        uint32_t source_size;
+        uint32_t source_crc;    /* CRC32 (IEEE) of the source image */
+        uint32_t target_size;
+    };
+
+The payload is a sequence of bsdiff-style records:
+
+    uint32_t diff_len;          /* bytes added to the source at the source offset */
+    uint8_t  diff[diff_len];
+    uint32_t extra_len;         /* bytes copied to the target as-is */
+    uint8_t  extra[extra_len];
+    int32_t  adjust;            /* change of the source offset */
+
+Usage examples:
+
+Creating a compressed delta patch:
+./mcuboot_delta_tool.py create --compress app_update_v1.bin app_update_v2.bin patch.bin
+
+Showing the delta patch header:
+./mcuboot_delta_tool.py show patch.bin
+
+Applying a delta patch on the host to verify it:
+./mcuboot_delta_tool.py apply app_update_v1.bin patch.bin app_update_v2_check.bin
+"""
+
+import argparse
+import lzma
+import struct
+import zlib
+
+
+MAGIC = 0x41544c44
+VERSION = 1
+
+COMPRESSION_NONE = 0
+COMPRESSION_LZMA2 = 1
+
+HEADER_FORMAT = '<IBBHIII'
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+
+# Length of the byte sequences used to find matching regions of the source
+MATCH_LEN = 8
+
+# Number of bytes past the best matching position after which a diff block ends
+MAX_MISMATCH_RUN = 32
+
+# LZMA2 dictionary size supported by the nRF compression library on the device
+LZMA2_DICT_SIZE = 128 * 1024
+LZMA2_LC = 3
+LZMA2_LP = 0
+LZMA2_PB = 2
+
+
+def _build_index(source: bytes) -> dict:
+    """
+    Map every MATCH_LEN long sequence of the source to its first offset
+    """
+
+    index = {}
+    for offset in range(len(source) - MATCH_LEN + 1):
+        index.setdefault(source[offset:offset + MATCH_LEN], offset)
+
+    return index
+
+
+def _diff_len(source: bytes, target: bytes, s_pos: int, t_pos: int) -> int:
+    """
+    Find the length of the region that is cheapest to encode as a diff, which is
+    where the matching bytes outnumber the mismatching ones the most
+    """
+
+    limit = min(len(source) - s_pos, len(target) - t_pos)
+    score = 0
+    best_score = 0
+    best_len = 0
+
+    for i in range(limit):
+        score += 1 if source[s_pos + i] == target[t_pos + i] else -1
+        if score > best_score:
+            best_score = score
+            best_len = i + 1
+        elif i + 1 - best_len > MAX_MISMATCH_RUN:
+            break
+
+    return best_len
+
+
+def _find_match(source: bytes, target: bytes, index: dict, t_pos: int, s_pos: int) -> tuple:
+    """
+    Find the next target offset that has a match in the source. A match at the
+    current source offset is preferred, as code shifted by an insertion stays aligned
+    """
+
+    for pos in range(t_pos, len(target) - MATCH_LEN + 1):
+        key = target[pos:pos + MATCH_LEN]
+        aligned = s_pos + pos - t_pos
+        if source[aligned:aligned + MATCH_LEN] == key:
+            return pos, aligned
+
+        match = index.get(key)
+        if match is not None:
+            return pos, match
+
+    return len(target), s_pos
+
+
+def generate_payload(source: bytes, target: bytes) -> bytes:
+    """
+    Generate the uncompressed patch payload
+    """
+
+    index = _build_index(source)
+    payload = bytearray()
+    s_pos = 0
+    t_pos = 0
+
+    while t_pos < len(target):
+        diff_len = _diff_len(source, target, s_pos, t_pos)
+        diff = bytes((target[t_pos + i] - source[s_pos + i]) & 0xff for i in range(diff_len))
+        t_pos += diff_len
+        s_pos += diff_len
+
+        next_t_pos, next_s_pos = _find_match(source, target, index, t_pos, s_pos)
+        extra = target[t_pos:next_t_pos]
+        t_pos = next_t_pos
+        adjust = next_s_pos - s_pos if t_pos < len(target) else 0
+        s_pos += adjust
+
+        payload += struct.pack('<I', diff_len) + diff
+        payload += struct.pack('<I', len(extra)) + extra
+        payload += struct.pack('<i', adjust)
+
+    return bytes(payload)
+
+
+def _lzma2_dict_prop(dict_size: int) -> int:
+    """
+    Encode the dictionary size the way the LZMA2 property byte does
+    """
+
+    for prop in range(40):
+        if ((2 | (prop & 1)) << (prop // 2 + 11)) >= dict_size:
+            return prop
+
+    return 40
+
+
+def compress_payload(payload: bytes) -> bytes:
+    """
+    Compress the payload with LZMA2, prefixed with the header expected by the nRF
+    compression library
+    """
+
+    filters = [{
+        'id': lzma.FILTER_LZMA2, 'preset': 9, 'dict_size': LZMA2_DICT_SIZE,
+        'lc': LZMA2_LC, 'lp': LZMA2_LP, 'pb': LZMA2_PB,
+    }]
+    header = bytes([_lzma2_dict_prop(LZMA2_DICT_SIZE),
+                    LZMA2_LC + LZMA2_LP * 9 + LZMA2_PB * 45])
+
+    return header + lzma.compress(payload, format=lzma.FORMAT_RAW, filters=filters)
+
+
+def decompress_payload(data: bytes) -> bytes:
+    """
+    Reverse of compress_payload
+    """
+
+    filters = [{'id': lzma.FILTER_LZMA2, 'dict_size': LZMA2_DICT_SIZE}]
+
+    return lzma.decompress(data[2:], format=lzma.FORMAT_RAW, filters=filters)
+
+
+def generate_patch(source: bytes, target: bytes, compress: bool) -> bytes:
+    """
+    Generate a delta patch turning source into target
+    """
+
+    payload = generate_payload(source, target)
+    compression = COMPRESSION_NONE
+
+    if compress:
+        payload = compress_payload(payload)
+        compression = COMPRESSION_LZMA2
+
+    header = struct.pack(HEADER_FORMAT, MAGIC, VERSION, compression, 0,
+                         len(source), zlib.crc32(source), len(target))
+
+    return header + payload
+
+
+def parse_header(patch: bytes) -> dict:
+    """
+    Parse and validate the delta patch header
+    """
+
+    magic, version, compression, _, source_size, source_crc, target_size = \
+        struct.unpack_from(HEADER_FORMAT, patch)
+
+    if magic != MAGIC or version != VERSION:
+        raise ValueError('Not a supported delta patch')
+
+    return {'compression': compression, 'source_size': source_size,
+            'source_crc': source_crc, 'target_size': target_size}
+
+
+def apply_patch(source: bytes, patch: bytes) -> bytes:
+    """
+    Apply a delta patch the same way the device does
+    """
+
+    header = parse_header(patch)
+    if header['source_size'] != len(source) or header['source_crc'] != zlib.crc32(source):
+        raise ValueError('Patch does not apply to the given source image')
+
+    payload = patch[HEADER_SIZE:]
+    if header['compression'] == COMPRESSION_LZMA2:
+        payload = decompress_payload(payload)
+
+    target = bytearray()
+    s_pos = 0
+    pos = 0
+
+    while len(target) < header['target_size']:
+        diff_len, = struct.unpack_from('<I', payload, pos)
+        pos += 4
+        target += bytes((payload[pos + i] + source[s_pos + i]) & 0xff for i in range(diff_len))
+        pos += diff_len
+        s_pos += diff_len
+
+        extra_len, = struct.unpack_from('<I', payload, pos)
+        pos += 4
+        target += payload[pos:pos + extra_len]
+        pos += extra_len
+
+        adjust, = struct.unpack_from('<i', payload, pos)
+        pos += 4
+        s_pos += adjust
+
+    return bytes(target)
+
+
+def show_header(input_file: str) -> None:
+    """
+    Parse and print the delta patch header
+    """
+
+    with open(input_file, 'rb') as file:
+        header = parse_header(file.read(HEADER_SIZE))
+
+    compression = {COMPRESSION_NONE: 'none', COMPRESSION_LZMA2: 'lzma2'}
+    print(f'Compression: {compression.get(header["compression"], "unknown")}')
+    print(f'Source size: {header["source_size"]}')
+    print(f'Source CRC32: 0x{header["source_crc"]:08x}')
+    print(f'Target size: {header["target_size"]}')
+
+
+def read_file(path: str) -> bytes:
+    with open(path, 'rb') as file:
+        return file.read()
+
+
+def write_file(path: str, data: bytes) -> None:
+    with open(path, 'wb') as file:
+        file.write(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='MCUBoot delta patch tool',
+                                     fromfile_prefix_chars='@',
+                                     allow_abbrev=False)
+    subcommands = parser.add_subparsers(dest='subcommand', title='valid subcommands')
+
+    create_parser = subcommands.add_parser(
+        'create', help='Create delta patch')
+    create_parser.add_argument(
+        '-c', '--compress', action='store_true',
+        help='Compress the patch payload with LZMA2')
+    create_parser.add_argument(
+        'source_file', help='Path to the signed image running on the device')
+    create_parser.add_argument(
+        'target_file', help='Path to the signed update image')
+    create_parser.add_argument(
+        'output_file', help='Path to output patch file')
+
+    show_parser = subcommands.add_parser(
+        'show', help='Show delta patch header')
+    show_parser.add_argument(
+        'input_file', help='Path to patch file')
+
+    apply_parser = subcommands.add_parser(
+        'apply', help='Apply delta patch on the host')
+    apply_parser.add_argument(
+        'source_file', help='Path to the source image')
+    apply_parser.add_argument(
+        'patch_file', help='Path to patch file')
+    apply_parser.add_argument(
+        'output_file', help='Path to output image file')
+
+    args = parser.parse_args()
+
+    if args.subcommand == 'create':
+        source = read_file(args.source_file)
+        target = read_file(args.target_file)
+        patch = generate_patch(source, target, args.compress)
+        write_file(args.output_file, patch)
+        print(f'Patch size: {len(patch)} bytes ({len(target)} bytes image)')
+    elif args.subcommand == 'show':
+        show_header(args.input_file)
+    elif args.subcommand == 'apply':
+        target = apply_patch(read_file(args.source_file), read_file(args.patch_file))
+        write_file(args.output_file, target)
+    else:
+        parser.print_help()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,61 @@
+#
+# Copyright (c) 2025 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+import random
+
+import pytest
+from mcuboot_delta_tool import (
+    COMPRESSION_LZMA2,
+    COMPRESSION_NONE,
+    apply_patch,
+    generate_patch,
+    parse_header,
+)
+
+
+def _images():
+    rand = random.Random(0)
+    source = bytes(rand.getrandbits(8) for _ in range(64 * 1024))
+    target = bytearray(source)
+    # Insertion, modification, removal and appended data
+    target[3000:3000] = bytes(rand.getrandbits(8) for _ in range(100))
+    for offset in range(8000, 8040, 4):
+        target[offset] ^= 0x01
+    del target[20000:20500]
+    target += b'new tail' * 64
+    return source, bytes(target)
+
+
+@pytest.mark.parametrize('compress', [False, True], ids=['uncompressed', 'lzma2'])
+def test_patch_reproduces_target(compress):
+    source, target = _images()
+    patch = generate_patch(source, target, compress)
+
+    header = parse_header(patch)
+    assert header['compression'] == (COMPRESSION_LZMA2 if compress else COMPRESSION_NONE)
+    assert header['source_size'] == len(source)
+    assert header['target_size'] == len(target)
+    assert apply_patch(source, patch) == target
+
+
+def test_compressed_patch_is_small():
+    source, target = _images()
+    assert len(generate_patch(source, target, True)) < len(target) // 20
+
+
+@pytest.mark.parametrize(
+    'source, target',
+    [(b'', b'abc'), (b'abc', b''), (b'x' * 50, b'y' * 3), (b'0123456789' * 10, b'0123456789' * 10)],
+    ids=['empty_source', 'empty_target', 'no_match', 'identical']
+)
+def test_patch_edge_cases(source, target):
+    assert apply_patch(source, generate_patch(source, target, False)) == target
+
+
+def test_patch_rejects_other_source():
+    source, target = _images()
+    patch = generate_patch(source, target, False)
+    with pytest.raises(ValueError):
+        apply_patch(source[:-1] + b'\x00', patch)
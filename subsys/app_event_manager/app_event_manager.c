@@ -5,6 +5,7 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/slist.h>
@@ -23,6 +24,73 @@ static K_WORK_DEFINE(event_processor, event_processor_fn);
 static sys_slist_t eventq = SYS_SLIST_STATIC_INIT(&eventq);
 static struct k_spinlock lock;
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCE)
+/* Events of coalescing types that are waiting in the queue. */
+static struct app_event_header *queued_events[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+static uint32_t coalesced_cnt[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+
+/* Must be called under the queue lock. Returns true if the event was merged into the queued
+ * event of the same type and must be freed, or false if it must be queued.
+ */
+static bool event_coalesce(struct app_event_header *aeh)
+{
+	const struct event_type *et = aeh->type_id;
+	size_t idx = et - _event_type_list_start;
+	struct app_event_header *queued = queued_events[idx];
+
+	if (!queued) {
+		queued_events[idx] = aeh;
+		return false;
+	}
+
+	if (et->merge_fn) {
+		et->merge_fn(queued, aeh);
+	} else {
+		size_t size = app_event_manager_event_size(aeh);
+
+		/* Events with dynamic data of different sizes cannot be replaced in place. */
+		if (size != app_event_manager_event_size(queued)) {
+			queued_events[idx] = aeh;
+			return false;
+		}
+
+		memcpy((uint8_t *)queued + sizeof(*queued), (const uint8_t *)aeh + sizeof(*aeh),
+		       size - sizeof(*aeh));
+	}
+
+	coalesced_cnt[idx]++;
+
+	return true;
+}
+
+/* Must be called under the queue lock when the queued events are taken for processing. */
+static void event_coalesce_queue_taken(void)
+{
+	memset(queued_events, 0, sizeof(queued_events));
+}
+
+uint32_t app_event_manager_coalesced_cnt_get(const struct event_type *et)
+{
+	APP_EVENT_ASSERT_ID(et);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint32_t cnt = coalesced_cnt[et - _event_type_list_start];
+
+	k_spin_unlock(&lock, key);
+
+	return cnt;
+}
+#else
+static bool event_coalesce(struct app_event_header *aeh)
+{
+	return false;
+}
+
+static void event_coalesce_queue_taken(void)
+{
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_COALESCE */
+
 static bool log_is_event_displayed(const struct event_type *et)
 {
 	size_t idx = et - _event_type_list_start;
@@ -150,6 +218,7 @@ static void event_processor_fn(struct k_work *work)
 	}
 
 	sys_slist_merge_slist(&events, &eventq);
+	event_coalesce_queue_taken();
 
 	k_spin_unlock(&lock, key);
 
@@ -173,6 +242,11 @@ static void event_processor_fn(struct k_work *work)
 		log_event(aeh);
 
 		bool consumed = false;
+		uint32_t event_start = 0;
+
+		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_TRACE_STATS)) {
+			event_start = k_cycle_get_32();
+		}
 
 		for (const struct event_subscriber *es = et->subs_start;
 		     (es != et->subs_stop) && !consumed;
@@ -187,13 +261,24 @@ static void event_processor_fn(struct k_work *work)
 
 			log_event_progress(et, el);
 
-			consumed = el->notification(aeh);
+			if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_TRACE_STATS)) {
+				uint32_t start = k_cycle_get_32();
+
+				consumed = el->notification(aeh);
+				_app_event_trace_listener_stats_add(el, k_cycle_get_32() - start);
+			} else {
+				consumed = el->notification(aeh);
+			}
 
 			if (consumed) {
 				log_event_consumed(et);
 			}
 		}
 
+		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_TRACE_STATS)) {
+			_app_event_trace_type_stats_add(et, k_cycle_get_32() - event_start);
+		}
+
 		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
 			STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
 				h->hook(aeh);
@@ -209,16 +294,31 @@ void _event_submit(struct app_event_header *aeh)
 	__ASSERT_NO_MSG(aeh);
 	APP_EVENT_ASSERT_ID(aeh->type_id);
 
+	bool coalesced = false;
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
-	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
-		STRUCT_SECTION_FOREACH(event_submit_hook, h) {
-			h->hook(aeh);
+	if (app_event_get_type_flag(aeh->type_id, APP_EVENT_TYPE_FLAGS_COALESCE)) {
+		coalesced = event_coalesce(aeh);
+	}
+
+	if (!coalesced) {
+		/* Hooks only see events that are queued and later processed. */
+		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
+			STRUCT_SECTION_FOREACH(event_submit_hook, h) {
+				h->hook(aeh);
+			}
 		}
+
+		sys_slist_append(&eventq, &aeh->node);
 	}
-	sys_slist_append(&eventq, &aeh->node);
 	k_spin_unlock(&lock, key);
 
+	if (coalesced) {
+		/* The queued event already triggered the processing. */
+		app_event_manager_free(aeh);
+		return;
+	}
+
 	k_work_submit(&event_processor);
 }
 
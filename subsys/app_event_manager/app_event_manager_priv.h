@@ -235,6 +235,10 @@ struct app_event_header {
 /** Function to log data from this event. */
 typedef void (*log_event_data)(const struct app_event_header *aeh);
 
+/** Function to merge an event into the event of the same type waiting in the queue. */
+typedef void (*app_event_merge_fn)(struct app_event_header *queued,
+				   const struct app_event_header *aeh);
+
 /** Deprecated function to log data from this event. */
 typedef	int (*log_event_data_dep)(const struct app_event_header *aeh,
 				  char *buf,
@@ -292,17 +296,43 @@ struct event_type {
 	/** The size of the event structure */
 	uint16_t struct_size;
 #endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCE)
+	/** Function to merge events of this type, or NULL to replace the queued event. */
+	app_event_merge_fn merge_fn;
+#endif
 };
 
 
+/** Number of bits available for event type flags. */
+#define _APP_EVENT_TYPE_FLAGS_BITS (8 * sizeof(((struct event_type *)0)->flags))
+
+BUILD_ASSERT(APP_EVENT_TYPE_FLAGS_USER_DEFINED_START < _APP_EVENT_TYPE_FLAGS_BITS,
+	     "No event type flag bits left for user-defined flags");
+
 extern struct event_type _event_type_list_start[];
 extern struct event_type _event_type_list_end[];
 
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCE)
+#define _APP_EVENT_TYPE_DEFINE_MERGE_FN(fn)             \
+	.merge_fn = (fn),
+#else
+#define _APP_EVENT_TYPE_DEFINE_MERGE_FN(fn)
+#endif
+
 #define _APP_EVENT_TYPE_DEFINE(ename, log_fn, trace_data_pointer, et_flags)		\
+	_APP_EVENT_TYPE_DEFINE_EXT(ename, log_fn, trace_data_pointer, et_flags, NULL)
+
+#define _APP_EVENT_TYPE_DEFINE_EXT(ename, log_fn, trace_data_pointer, et_flags, merge)	\
 	BUILD_ASSERT(((et_flags) & ((BIT_MASK(APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START-	\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START))<<					\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START)) == 0);				\
+	BUILD_ASSERT(IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCE) ||			\
+		     (((et_flags) & BIT(APP_EVENT_TYPE_FLAGS_COALESCE)) == 0),		\
+		     "Coalescing events require CONFIG_APP_EVENT_MANAGER_COALESCE");	\
+	BUILD_ASSERT(((et_flags) & ~BIT_MASK(_APP_EVENT_TYPE_FLAGS_BITS)) == 0,		\
+		     "Event type flags do not fit in the flags field");		\
 	_APP_EVENT_SUBSCRIBERS_ARRAY_TAGS(ename);					\
 	STRUCT_SECTION_ITERABLE(event_type, _CONCAT(__event_type_, ename)) = {		\
 		.name            = STRINGIFY(ename),					\
@@ -315,6 +345,7 @@ extern struct event_type _event_type_list_end[];
 				((et_flags) | BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)) :	\
 				((et_flags) & (~BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)))),\
 		_APP_EVENT_TYPE_DEFINE_SIZES(ename) /* No comma here intentionally */	\
+		_APP_EVENT_TYPE_DEFINE_MERGE_FN(merge) /* No comma here intentionally */\
 	}
 
 /**
@@ -433,6 +464,20 @@ struct event_postprocess_hook {
  */
 void _event_submit(struct app_event_header *aeh);
 
+/** @brief Add the processing time of an event to the trace statistics.
+ *
+ * @param et      Event type.
+ * @param cycles  Time spent by all listeners of the event, in cycles.
+ */
+void _app_event_trace_type_stats_add(const struct event_type *et, uint32_t cycles);
+
+/** @brief Add the processing time of a listener to the trace statistics.
+ *
+ * @param el      Event listener.
+ * @param cycles  Time spent in the listener, in cycles.
+ */
+void _app_event_trace_listener_stats_add(const struct event_listener *el, uint32_t cycles);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <app_event_manager.h>
+#include <app_event_manager_trace.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(app_event_manager, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
+
+/* Maximum length of a variable-length encoded 32-bit integer. */
+#define VARINT_MAX_LEN 5
+
+/* Record type, event type index and name length. */
+#define TYPE_RECORD_HDR_LEN 3
+/* Record type, event type index, time delta and data length. */
+#define EVENT_RECORD_HDR_MAX_LEN (2 + 2 * VARINT_MAX_LEN)
+
+BUILD_ASSERT(CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT <= UINT8_MAX + 1,
+	     "Event type index must fit in a single byte");
+
+RING_BUF_DECLARE(trace_buf, CONFIG_APP_EVENT_MANAGER_TRACE_RECORDER_BUF_SIZE);
+static struct k_spinlock lock;
+
+static bool recording;
+static int64_t last_event_us;
+static uint32_t dropped;
+static ATOMIC_DEFINE(type_recorded, CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT);
+
+static size_t varint_encode(uint8_t *buf, uint32_t value)
+{
+	size_t len = 0;
+
+	while (value >= BIT(7)) {
+		buf[len++] = (value & BIT_MASK(7)) | BIT(7);
+		value >>= 7;
+	}
+
+	buf[len++] = value;
+
+	return len;
+}
+
+static bool type_record_put(const struct event_type *et, uint8_t idx)
+{
+	size_t name_len = MIN(strlen(et->name), UINT8_MAX);
+	uint8_t hdr[TYPE_RECORD_HDR_LEN] = {
+		APP_EVENT_TRACE_RECORD_TYPE,
+		idx,
+		name_len,
+	};
+
+	if (ring_buf_space_get(&trace_buf) < (sizeof(hdr) + name_len)) {
+		return false;
+	}
+
+	ring_buf_put(&trace_buf, hdr, sizeof(hdr));
+	ring_buf_put(&trace_buf, (const uint8_t *)et->name, name_len);
+
+	return true;
+}
+
+static void trace_event(const struct app_event_header *aeh)
+{
+	const struct event_type *et = aeh->type_id;
+	uint8_t idx = et - _event_type_list_start;
+	const uint8_t *data = (const uint8_t *)aeh + sizeof(*aeh);
+	size_t data_len = app_event_manager_event_size(aeh) - sizeof(*aeh);
+	uint8_t hdr[EVENT_RECORD_HDR_MAX_LEN];
+	size_t hdr_len = 0;
+	int64_t now_us = k_ticks_to_us_floor64(k_uptime_ticks());
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (!recording) {
+		goto out;
+	}
+
+	if (!atomic_test_bit(type_recorded, idx)) {
+		if (!type_record_put(et, idx)) {
+			dropped++;
+			goto out;
+		}
+
+		atomic_set_bit(type_recorded, idx);
+	}
+
+	hdr[hdr_len++] = APP_EVENT_TRACE_RECORD_EVENT;
+	hdr[hdr_len++] = idx;
+	hdr_len += varint_encode(&hdr[hdr_len], MIN(now_us - last_event_us, UINT32_MAX));
+	hdr_len += varint_encode(&hdr[hdr_len], data_len);
+
+	if (ring_buf_space_get(&trace_buf) < (hdr_len + data_len)) {
+		dropped++;
+		goto out;
+	}
+
+	ring_buf_put(&trace_buf, hdr, hdr_len);
+	ring_buf_put(&trace_buf, data, data_len);
+	last_event_us = now_us;
+
+out:
+	k_spin_unlock(&lock, key);
+}
+
+void app_event_trace_recorder_start(void)
+{
+	const struct app_event_trace_header hdr = {
+		.magic = APP_EVENT_TRACE_MAGIC,
+		.version = APP_EVENT_TRACE_VERSION,
+	};
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	ring_buf_reset(&trace_buf);
+	ring_buf_put(&trace_buf, (const uint8_t *)&hdr, sizeof(hdr));
+
+	for (size_t i = 0; i < CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT; i++) {
+		atomic_clear_bit(type_recorded, i);
+	}
+
+	last_event_us = k_ticks_to_us_floor64(k_uptime_ticks());
+	dropped = 0;
+	recording = true;
+
+	k_spin_unlock(&lock, key);
+}
+
+void app_event_trace_recorder_stop(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	recording = false;
+
+	k_spin_unlock(&lock, key);
+}
+
+size_t app_event_trace_recorder_read(uint8_t *buf, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	size_t len = ring_buf_get(&trace_buf, buf, size);
+
+	k_spin_unlock(&lock, key);
+
+	return len;
+}
+
+uint32_t app_event_trace_recorder_dropped_get(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint32_t cnt = dropped;
+
+	k_spin_unlock(&lock, key);
+
+	return cnt;
+}
+
+APP_EVENT_HOOK_POSTPROCESS_REGISTER(trace_event);
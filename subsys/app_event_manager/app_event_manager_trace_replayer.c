@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <inttypes.h>
+#include <zephyr/kernel.h>
+#include <app_event_manager.h>
+#include <app_event_manager_trace.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(app_event_manager, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
+
+/* Maximum number of event types in a trace. */
+#define TRACE_TYPE_CNT (UINT8_MAX + 1)
+
+struct trace_reader {
+	const uint8_t *data;
+	size_t len;
+	size_t offset;
+};
+
+static int u8_read(struct trace_reader *reader, uint8_t *value)
+{
+	if (reader->offset >= reader->len) {
+		return -EINVAL;
+	}
+
+	*value = reader->data[reader->offset++];
+
+	return 0;
+}
+
+static int varint_read(struct trace_reader *reader, uint32_t *value)
+{
+	uint32_t result = 0;
+	uint8_t byte;
+	int err;
+
+	for (size_t shift = 0; shift < 32; shift += 7) {
+		err = u8_read(reader, &byte);
+		if (err) {
+			return err;
+		}
+
+		result |= (uint32_t)(byte & BIT_MASK(7)) << shift;
+
+		if (!(byte & BIT(7))) {
+			*value = result;
+			return 0;
+		}
+	}
+
+	return -EINVAL;
+}
+
+static const uint8_t *bytes_read(struct trace_reader *reader, size_t len)
+{
+	const uint8_t *data = &reader->data[reader->offset];
+
+	if ((reader->len - reader->offset) < len) {
+		return NULL;
+	}
+
+	reader->offset += len;
+
+	return data;
+}
+
+static const struct event_type *event_type_find(const uint8_t *name, size_t name_len)
+{
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		if ((strncmp(et->name, (const char *)name, name_len) == 0) &&
+		    (et->name[name_len] == '\0')) {
+			return et;
+		}
+	}
+
+	return NULL;
+}
+
+static int type_record_parse(struct trace_reader *reader, const struct event_type **types,
+			     const struct app_event_trace_replay_param *param)
+{
+	const struct event_type *et;
+	const uint8_t *name;
+	uint8_t name_len;
+	uint8_t idx;
+
+	if (u8_read(reader, &idx) || u8_read(reader, &name_len)) {
+		return -EINVAL;
+	}
+
+	name = bytes_read(reader, name_len);
+	if (!name) {
+		return -EINVAL;
+	}
+
+	et = event_type_find(name, name_len);
+	if (!et) {
+		LOG_WRN("Event type %" PRIu8 " not found, skipping", idx);
+	} else if (param->filter && !param->filter(et)) {
+		et = NULL;
+	}
+
+	types[idx] = et;
+
+	return 0;
+}
+
+static bool event_data_valid(const struct event_type *et, const uint8_t *data, size_t len)
+{
+	size_t fixed_len = et->struct_size - sizeof(struct app_event_header);
+	struct event_dyndata dyndata;
+
+	if (!app_event_get_type_flag(et, APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)) {
+		return len == fixed_len;
+	}
+
+	if (len < fixed_len) {
+		return false;
+	}
+
+	memcpy(&dyndata, &data[fixed_len - sizeof(dyndata)], sizeof(dyndata));
+
+	return dyndata.size == (len - fixed_len);
+}
+
+static void replay_time_wait(int64_t start_us, uint64_t trace_us, uint32_t speed)
+{
+	int64_t target_us;
+	int64_t now_us;
+
+	if (speed == 0) {
+		return;
+	}
+
+	target_us = start_us + (trace_us / speed);
+	now_us = k_ticks_to_us_floor64(k_uptime_ticks());
+
+	if (target_us > now_us) {
+		k_usleep(target_us - now_us);
+	}
+}
+
+int app_event_trace_replay(const uint8_t *trace, size_t len,
+			   const struct app_event_trace_replay_param *param)
+{
+	static const struct app_event_trace_replay_param default_param;
+	const struct event_type *types[TRACE_TYPE_CNT] = {NULL};
+	struct trace_reader reader = {
+		.data = trace,
+		.len = len,
+	};
+	struct app_event_trace_header hdr;
+	uint64_t trace_us = 0;
+	int64_t start_us;
+	int cnt = 0;
+	int err;
+
+	if (!param) {
+		param = &default_param;
+	}
+
+	if (len < sizeof(hdr)) {
+		return -EINVAL;
+	}
+
+	memcpy(&hdr, bytes_read(&reader, sizeof(hdr)), sizeof(hdr));
+
+	if (hdr.magic != APP_EVENT_TRACE_MAGIC) {
+		return -EINVAL;
+	}
+
+	if (hdr.version != APP_EVENT_TRACE_VERSION) {
+		return -ENOTSUP;
+	}
+
+	start_us = k_ticks_to_us_floor64(k_uptime_ticks());
+
+	while (reader.offset < reader.len) {
+		const struct event_type *et;
+		struct app_event_header *aeh;
+		const uint8_t *data;
+		uint32_t delta_us;
+		uint32_t data_len;
+		uint8_t record;
+		uint8_t idx;
+
+		(void)u8_read(&reader, &record);
+
+		if (record == APP_EVENT_TRACE_RECORD_TYPE) {
+			err = type_record_parse(&reader, types, param);
+			if (err) {
+				return err;
+			}
+			continue;
+		}
+
+		if ((record != APP_EVENT_TRACE_RECORD_EVENT) ||
+		    u8_read(&reader, &idx) ||
+		    varint_read(&reader, &delta_us) ||
+		    varint_read(&reader, &data_len)) {
+			return -EINVAL;
+		}
+
+		data = bytes_read(&reader, data_len);
+		if (!data) {
+			return -EINVAL;
+		}
+
+		trace_us += delta_us;
+
+		et = types[idx];
+		if (!et) {
+			continue;
+		}
+
+		if (!event_data_valid(et, data, data_len)) {
+			LOG_ERR("Invalid %s event data length: %" PRIu32, et->name, data_len);
+			return -EINVAL;
+		}
+
+		replay_time_wait(start_us, trace_us, param->speed);
+
+		aeh = app_event_manager_alloc(sizeof(*aeh) + data_len);
+		if (!aeh) {
+			return -ENOMEM;
+		}
+
+		aeh->type_id = et;
+		memcpy((uint8_t *)aeh + sizeof(*aeh), data, data_len);
+
+		_event_submit(aeh);
+		cnt++;
+	}
+
+	return cnt;
+}
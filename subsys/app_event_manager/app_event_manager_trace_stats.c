@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <inttypes.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <app_event_manager.h>
+#include <app_event_manager_trace.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(app_event_manager, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
+
+#define LISTENER_CNT CONFIG_APP_EVENT_MANAGER_TRACE_STATS_MAX_LISTENER_CNT
+
+extern struct event_listener _event_listener_list_start[];
+
+static struct app_event_trace_stats type_stats[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+static struct app_event_trace_stats listener_stats[LISTENER_CNT];
+static struct k_spinlock lock;
+
+static void stats_add(struct app_event_trace_stats *stats, uint32_t cycles)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	stats->count++;
+	stats->total_cycles += cycles;
+	stats->max_cycles = MAX(stats->max_cycles, cycles);
+
+	k_spin_unlock(&lock, key);
+}
+
+static void stats_get(const struct app_event_trace_stats *src, struct app_event_trace_stats *dst)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	*dst = *src;
+
+	k_spin_unlock(&lock, key);
+}
+
+static size_t listener_idx(const struct event_listener *el)
+{
+	return el - _event_listener_list_start;
+}
+
+void _app_event_trace_type_stats_add(const struct event_type *et, uint32_t cycles)
+{
+	stats_add(&type_stats[et - _event_type_list_start], cycles);
+}
+
+void _app_event_trace_listener_stats_add(const struct event_listener *el, uint32_t cycles)
+{
+	size_t idx = listener_idx(el);
+
+	if (idx < LISTENER_CNT) {
+		stats_add(&listener_stats[idx], cycles);
+	}
+}
+
+void app_event_trace_type_stats_get(const struct event_type *et,
+				    struct app_event_trace_stats *stats)
+{
+	APP_EVENT_ASSERT_ID(et);
+
+	stats_get(&type_stats[et - _event_type_list_start], stats);
+}
+
+void app_event_trace_listener_stats_get(const struct event_listener *el,
+					struct app_event_trace_stats *stats)
+{
+	size_t idx = listener_idx(el);
+
+	if (idx < LISTENER_CNT) {
+		stats_get(&listener_stats[idx], stats);
+	} else {
+		memset(stats, 0, sizeof(*stats));
+	}
+}
+
+void app_event_trace_stats_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	memset(type_stats, 0, sizeof(type_stats));
+	memset(listener_stats, 0, sizeof(listener_stats));
+
+	k_spin_unlock(&lock, key);
+}
+
+static void stats_log(const char *name, const struct app_event_trace_stats *stats)
+{
+	if (stats->count == 0) {
+		return;
+	}
+
+	LOG_INF("%s: count %" PRIu32 ", avg %" PRIu32 " us, max %" PRIu32 " us, total %" PRIu32
+		" us", name, stats->count,
+		k_cyc_to_us_floor32(stats->total_cycles / stats->count),
+		k_cyc_to_us_floor32(stats->max_cycles),
+		(uint32_t)k_cyc_to_us_floor64(stats->total_cycles));
+}
+
+void app_event_trace_stats_log(void)
+{
+	struct app_event_trace_stats stats;
+	size_t listener_cnt;
+
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		app_event_trace_type_stats_get(et, &stats);
+		stats_log(et->name, &stats);
+	}
+
+	STRUCT_SECTION_COUNT(event_listener, &listener_cnt);
+	if (listener_cnt > LISTENER_CNT) {
+		LOG_WRN("Statistics of %zu listeners not collected", listener_cnt - LISTENER_CNT);
+	}
+
+	STRUCT_SECTION_FOREACH(event_listener, el) {
+		app_event_trace_listener_stats_get(el, &stats);
+		stats_log(el->name, &stats);
+	}
+}
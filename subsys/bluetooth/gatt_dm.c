@@ -7,6 +7,9 @@
 #include <inttypes.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/sys/byteorder.h>
 
 #include <bluetooth/gatt_dm.h>
 
@@ -22,6 +25,28 @@ LOG_MODULE_REGISTER(bt_gatt_dm, CONFIG_BT_GATT_DM_LOG_LEVEL);
 BUILD_ASSERT(sizeof(struct bt_gatt_service_val) % DATA_ALIGN == 0);
 BUILD_ASSERT(sizeof(struct bt_gatt_chrc) % DATA_ALIGN == 0);
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+#define GATT_DB_HASH_LEN 16
+
+#define CACHE_SUBTREE "bt_dm"
+/* "bt_dm/<peer>/<start handle><service UUID>" */
+#define CACHE_KEY_LEN (sizeof(CACHE_SUBTREE "/") + 2 * sizeof(bt_addr_le_t) + \
+		       sizeof("/") + 4 + 2 * BT_UUID_SIZE_128)
+
+/* Largest serialized UUID: the type followed by the value */
+#define CACHE_UUID_LEN_MAX (1 + BT_UUID_SIZE_128)
+/* Largest serialized attribute: handle, permissions, type UUID and either
+ * the service or the characteristic value.
+ */
+#define CACHE_ATTR_LEN_MAX (sizeof(uint16_t) + sizeof(uint8_t) + \
+			    CACHE_UUID_LEN_MAX + sizeof(uint16_t) + \
+			    sizeof(uint8_t) + CACHE_UUID_LEN_MAX)
+#define CACHE_RECORD_LEN_MAX (GATT_DB_HASH_LEN + sizeof(uint8_t) + \
+			      CONFIG_BT_GATT_DM_MAX_ATTRS * CACHE_ATTR_LEN_MAX)
+
+static void cache_discovery_store(struct bt_gatt_dm *dm);
+#endif
+
 #if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
 K_THREAD_STACK_DEFINE(bt_gatt_dm_wq_stack_area, CONFIG_BT_GATT_DM_WORKQ_STACK_SIZE);
 static struct k_work_q bt_gatt_dm_wq;
@@ -44,6 +69,7 @@ SYS_INIT(gatt_dm_wq_init, POST_KERNEL, CONFIG_BT_GATT_DM_WORKQ_INIT_PRIO);
 enum {
 	STATE_ATTRS_LOCKED,
 	STATE_ATTRS_RELEASE_PENDING,
+	STATE_CACHE_STORE_PENDING,
 	STATE_NUM
 };
 
@@ -92,6 +118,29 @@ struct bt_gatt_dm {
 
 	/* Work item used for discovery callbacks. */
 	struct k_work discover_work;
+
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	/* Address of the bonded peer, used as the cache key */
+	bt_addr_le_t peer;
+	/* Parameters used for reading the peer's Database Hash */
+	struct bt_gatt_read_params read_params;
+	/* The peer's Database Hash read at the start of the procedure */
+	uint8_t db_hash[GATT_DB_HASH_LEN];
+	/* Indicates that the Database Hash has been read */
+	bool hash_valid;
+	/* Indicates that the current result was served from the cache */
+	bool cache_hit;
+	/* The first handle of the current service search */
+	uint16_t search_start;
+	/* Work item used for serving the results from the cache */
+	struct k_work cache_work;
+	/* Serialized result waiting to be stored */
+	uint8_t *store_data;
+	/* Length of the serialized result */
+	size_t store_len;
+	/* Settings key of the serialized result */
+	char store_key[CACHE_KEY_LEN];
+#endif
 };
 
 /* Currently only one instance is supported */
@@ -271,6 +320,9 @@ static struct bt_gatt_dm_attr *attr_find_by_handle(
 static void discovery_complete(struct bt_gatt_dm *dm)
 {
 	LOG_DBG("Discovery complete.");
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	cache_discovery_store(dm);
+#endif
 	atomic_set_bit(dm->state_flags, STATE_ATTRS_RELEASE_PENDING);
 	if (dm->callback->completed) {
 		dm->callback->completed(dm, dm->context);
@@ -633,6 +685,496 @@ const struct bt_gatt_dm_attr *bt_gatt_dm_desc_next(
 	return curr;
 }
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+static void cache_store_work_handler(struct k_work *work);
+
+/* Defined statically, as storing may outlive the procedure that started it */
+static K_WORK_DEFINE(cache_store_work, cache_store_work_handler);
+
+static void cache_work_submit(struct k_work *work)
+{
+#if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
+	k_work_submit_to_queue(&bt_gatt_dm_wq, work);
+#else
+	k_work_submit(work);
+#endif
+}
+
+static void cache_key_get(const struct bt_gatt_dm *dm, char *key, size_t len)
+{
+	char peer[2 * sizeof(bt_addr_le_t) + 1];
+	char uuid[2 * BT_UUID_SIZE_128 + 1] = "";
+
+	bin2hex((const uint8_t *)&dm->peer, sizeof(dm->peer), peer, sizeof(peer));
+
+	if (dm->search_svc_by_uuid) {
+		const struct bt_uuid *svc_uuid = &dm->svc_uuid.uuid;
+
+		if (svc_uuid->type == BT_UUID_TYPE_16) {
+			uint8_t val[BT_UUID_SIZE_16];
+
+			sys_put_le16(BT_UUID_16(svc_uuid)->val, val);
+			bin2hex(val, sizeof(val), uuid, sizeof(uuid));
+		} else {
+			bin2hex(BT_UUID_128(svc_uuid)->val, BT_UUID_SIZE_128,
+				uuid, sizeof(uuid));
+		}
+	}
+
+	snprintk(key, len, CACHE_SUBTREE "/%s/%04x%s", peer, dm->search_start, uuid);
+}
+
+static void cache_uuid_encode(struct net_buf_simple *buf, const struct bt_uuid *uuid)
+{
+	net_buf_simple_add_u8(buf, uuid->type);
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		net_buf_simple_add_le16(buf, BT_UUID_16(uuid)->val);
+		break;
+	case BT_UUID_TYPE_32:
+		net_buf_simple_add_le32(buf, BT_UUID_32(uuid)->val);
+		break;
+	default:
+		net_buf_simple_add_mem(buf, BT_UUID_128(uuid)->val, BT_UUID_SIZE_128);
+		break;
+	}
+}
+
+static int cache_uuid_decode(struct net_buf_simple *buf, struct bt_uuid_128 *uuid)
+{
+	if (buf->len < 1) {
+		return -EINVAL;
+	}
+
+	switch (net_buf_simple_pull_u8(buf)) {
+	case BT_UUID_TYPE_16:
+		if (buf->len < BT_UUID_SIZE_16) {
+			return -EINVAL;
+		}
+
+		*(struct bt_uuid_16 *)uuid = (struct bt_uuid_16)BT_UUID_INIT_16(
+			net_buf_simple_pull_le16(buf));
+		return 0;
+	case BT_UUID_TYPE_32:
+		if (buf->len < BT_UUID_SIZE_32) {
+			return -EINVAL;
+		}
+
+		*(struct bt_uuid_32 *)uuid = (struct bt_uuid_32)BT_UUID_INIT_32(
+			net_buf_simple_pull_le32(buf));
+		return 0;
+	case BT_UUID_TYPE_128:
+		if (buf->len < BT_UUID_SIZE_128) {
+			return -EINVAL;
+		}
+
+		uuid->uuid.type = BT_UUID_TYPE_128;
+		memcpy(uuid->val, net_buf_simple_pull_mem(buf, BT_UUID_SIZE_128),
+		       BT_UUID_SIZE_128);
+		return 0;
+	default:
+		return -EINVAL;
+	}
+}
+
+static void cache_attr_encode(struct net_buf_simple *buf,
+			      const struct bt_gatt_dm_attr *attr)
+{
+	const struct bt_gatt_service_val *service_val;
+	const struct bt_gatt_chrc *chrc;
+
+	net_buf_simple_add_le16(buf, attr->handle);
+	net_buf_simple_add_u8(buf, attr->perm);
+	cache_uuid_encode(buf, attr->uuid);
+
+	service_val = bt_gatt_dm_attr_service_val(attr);
+	if (service_val) {
+		net_buf_simple_add_le16(buf, service_val->end_handle);
+		cache_uuid_encode(buf, service_val->uuid);
+		return;
+	}
+
+	chrc = bt_gatt_dm_attr_chrc_val(attr);
+	if (chrc) {
+		net_buf_simple_add_le16(buf, chrc->value_handle);
+		net_buf_simple_add_u8(buf, chrc->properties);
+		cache_uuid_encode(buf, chrc->uuid);
+	}
+}
+
+static int cache_attr_decode(struct bt_gatt_dm *dm, struct net_buf_simple *buf)
+{
+	struct bt_uuid_128 type;
+	struct bt_uuid_128 uuid;
+	struct bt_gatt_attr attr = {
+		.uuid = &type.uuid,
+	};
+	struct bt_gatt_dm_attr *cur_attr;
+	int err;
+
+	if (buf->len < sizeof(uint16_t) + sizeof(uint8_t)) {
+		return -EINVAL;
+	}
+
+	attr.handle = net_buf_simple_pull_le16(buf);
+	attr.perm = net_buf_simple_pull_u8(buf);
+
+	err = cache_uuid_decode(buf, &type);
+	if (err) {
+		return err;
+	}
+
+	if (!bt_uuid_cmp(attr.uuid, BT_UUID_GATT_PRIMARY) ||
+	    !bt_uuid_cmp(attr.uuid, BT_UUID_GATT_SECONDARY)) {
+		struct bt_gatt_service_val *service_val;
+
+		if (buf->len < sizeof(uint16_t)) {
+			return -EINVAL;
+		}
+
+		cur_attr = attr_store(dm, &attr, sizeof(*service_val));
+		if (!cur_attr) {
+			return -ENOMEM;
+		}
+
+		service_val = bt_gatt_dm_attr_service_val(cur_attr);
+		service_val->end_handle = net_buf_simple_pull_le16(buf);
+
+		err = cache_uuid_decode(buf, &uuid);
+		if (err) {
+			return err;
+		}
+
+		service_val->uuid = uuid_store(dm, &uuid.uuid);
+		if (!service_val->uuid) {
+			return -ENOMEM;
+		}
+	} else if (!bt_uuid_cmp(attr.uuid, BT_UUID_GATT_CHRC)) {
+		struct bt_gatt_chrc *chrc;
+
+		if (buf->len < sizeof(uint16_t) + sizeof(uint8_t)) {
+			return -EINVAL;
+		}
+
+		cur_attr = attr_store(dm, &attr, sizeof(*chrc));
+		if (!cur_attr) {
+			return -ENOMEM;
+		}
+
+		chrc = bt_gatt_dm_attr_chrc_val(cur_attr);
+		chrc->value_handle = net_buf_simple_pull_le16(buf);
+		chrc->properties = net_buf_simple_pull_u8(buf);
+
+		err = cache_uuid_decode(buf, &uuid);
+		if (err) {
+			return err;
+		}
+
+		chrc->uuid = uuid_store(dm, &uuid.uuid);
+		if (!chrc->uuid) {
+			return -ENOMEM;
+		}
+	} else {
+		cur_attr = attr_store(dm, &attr, 0);
+		if (!cur_attr) {
+			return -ENOMEM;
+		}
+	}
+
+	return 0;
+}
+
+static void cache_store_work_handler(struct k_work *work)
+{
+	struct bt_gatt_dm *dm = &bt_gatt_dm_inst;
+	int err;
+
+	err = settings_save_one(dm->store_key, dm->store_data, dm->store_len);
+	if (err) {
+		LOG_WRN("Failed to store %s (err %d)", dm->store_key, err);
+	} else {
+		LOG_DBG("Stored %s (%zu bytes)", dm->store_key, dm->store_len);
+	}
+
+	k_free(dm->store_data);
+	dm->store_data = NULL;
+	atomic_clear_bit(dm->state_flags, STATE_CACHE_STORE_PENDING);
+}
+
+/* Serializes the discovered service while its attributes are still valid, as
+ * the application may release them in the completion callback. Writing to the
+ * settings is left to the workqueue.
+ */
+static void cache_discovery_store(struct bt_gatt_dm *dm)
+{
+	struct net_buf_simple buf;
+	uint8_t *data;
+
+	if (!dm->hash_valid || dm->cache_hit) {
+		return;
+	}
+
+	if (atomic_test_and_set_bit(dm->state_flags, STATE_CACHE_STORE_PENDING)) {
+		LOG_DBG("Previous result still being stored");
+		return;
+	}
+
+	data = k_malloc(CACHE_RECORD_LEN_MAX);
+	if (!data) {
+		LOG_WRN("No memory for the cache record");
+		atomic_clear_bit(dm->state_flags, STATE_CACHE_STORE_PENDING);
+		return;
+	}
+
+	net_buf_simple_init_with_data(&buf, data, CACHE_RECORD_LEN_MAX);
+	net_buf_simple_reset(&buf);
+
+	net_buf_simple_add_mem(&buf, dm->db_hash, sizeof(dm->db_hash));
+	net_buf_simple_add_u8(&buf, dm->cur_attr_id);
+
+	for (size_t i = 0; i < dm->cur_attr_id; i++) {
+		cache_attr_encode(&buf, &dm->attrs[i]);
+	}
+
+	dm->store_data = data;
+	dm->store_len = buf.len;
+	cache_key_get(dm, dm->store_key, sizeof(dm->store_key));
+
+	cache_work_submit(&cache_store_work);
+}
+
+struct cache_load_ctx {
+	struct bt_gatt_dm *dm;
+	int err;
+};
+
+static int cache_load_cb(const char *key, size_t len, settings_read_cb read_cb,
+			 void *cb_arg, void *param)
+{
+	struct cache_load_ctx *ctx = param;
+	struct bt_gatt_dm *dm = ctx->dm;
+	struct net_buf_simple buf;
+	uint8_t *data;
+	uint8_t attr_cnt;
+	ssize_t rc;
+
+	/* Only the exact key is of interest */
+	if (key) {
+		return 0;
+	}
+
+	if (len < GATT_DB_HASH_LEN + sizeof(attr_cnt) || len > CACHE_RECORD_LEN_MAX) {
+		ctx->err = -EINVAL;
+		return 1;
+	}
+
+	data = k_malloc(len);
+	if (!data) {
+		ctx->err = -ENOMEM;
+		return 1;
+	}
+
+	rc = read_cb(cb_arg, data, len);
+	if (rc != len) {
+		ctx->err = rc < 0 ? rc : -EIO;
+		goto out;
+	}
+
+	net_buf_simple_init_with_data(&buf, data, len);
+
+	if (memcmp(net_buf_simple_pull_mem(&buf, GATT_DB_HASH_LEN), dm->db_hash,
+		   GATT_DB_HASH_LEN)) {
+		LOG_DBG("Database Hash changed");
+		ctx->err = -ESTALE;
+		goto out;
+	}
+
+	attr_cnt = net_buf_simple_pull_u8(&buf);
+	ctx->err = 0;
+
+	for (uint8_t i = 0; i < attr_cnt && !ctx->err; i++) {
+		ctx->err = cache_attr_decode(dm, &buf);
+	}
+
+	if (!ctx->err && (!dm->cur_attr_id || buf.len)) {
+		ctx->err = -EINVAL;
+	}
+
+out:
+	k_free(data);
+	return 1;
+}
+
+static int cache_load(struct bt_gatt_dm *dm)
+{
+	char key[CACHE_KEY_LEN];
+	struct cache_load_ctx ctx = {
+		.dm = dm,
+		.err = -ENOENT,
+	};
+	struct bt_gatt_service_val *service_val;
+	int err;
+
+	cache_key_get(dm, key, sizeof(key));
+
+	err = settings_load_subtree_direct(key, cache_load_cb, &ctx);
+	if (err) {
+		return err;
+	}
+
+	if (ctx.err) {
+		LOG_DBG("No valid cache entry for %s (err %d)", key, ctx.err);
+		svc_attr_memory_release(dm);
+		return ctx.err;
+	}
+
+	service_val = bt_gatt_dm_attr_service_val(&dm->attrs[0]);
+	if (!service_val) {
+		svc_attr_memory_release(dm);
+		return -EINVAL;
+	}
+
+	/* Continue the procedure after the cached service. As in the discovery,
+	 * the service UUID is only dropped if the service has any attributes.
+	 */
+	dm->discover_params.end_handle = service_val->end_handle;
+	if (dm->attrs[0].handle != service_val->end_handle) {
+		dm->discover_params.uuid = NULL;
+	}
+
+	return 0;
+}
+
+static void cache_lookup_work(struct k_work *work)
+{
+	struct bt_gatt_dm *dm = CONTAINER_OF(work, struct bt_gatt_dm, cache_work);
+	int err;
+
+	if (!atomic_test_bit(dm->state_flags, STATE_ATTRS_LOCKED)) {
+		LOG_WRN("Attributes not locked");
+		return;
+	}
+
+	if (dm->hash_valid && !cache_load(dm)) {
+		LOG_DBG("Service served from the cache");
+		dm->cache_hit = true;
+		discovery_complete(dm);
+		return;
+	}
+
+	dm->cache_hit = false;
+
+	err = bt_gatt_discover(dm->conn, &dm->discover_params);
+	if (err) {
+		LOG_ERR("GATT discover failed, error: %d.", err);
+		discovery_complete_error(dm, err);
+	}
+}
+
+static uint8_t db_hash_read_cb(struct bt_conn *conn, uint8_t err,
+			       struct bt_gatt_read_params *params,
+			       const void *data, uint16_t length)
+{
+	struct bt_gatt_dm *dm = CONTAINER_OF(params, struct bt_gatt_dm, read_params);
+
+	if (err) {
+		LOG_DBG("Database Hash not available (err %u)", err);
+	} else if (data && length == GATT_DB_HASH_LEN) {
+		memcpy(dm->db_hash, data, GATT_DB_HASH_LEN);
+		dm->hash_valid = true;
+	}
+
+	/* Stopping on the first value also skips the end of procedure
+	 * callback, so the lookup is submitted exactly once.
+	 */
+	cache_work_submit(&dm->cache_work);
+
+	return BT_GATT_ITER_STOP;
+}
+
+/* Reads the Database Hash of a bonded peer before the discovery. Returns 0 if
+ * the lookup is pending, and a negative error if the service must be
+ * discovered directly.
+ */
+static int cache_lookup_start(struct bt_gatt_dm *dm)
+{
+	struct bt_conn_info info;
+	int err;
+
+	dm->hash_valid = false;
+	dm->cache_hit = false;
+	dm->search_start = dm->discover_params.start_handle;
+
+	err = bt_conn_get_info(dm->conn, &info);
+	if (err) {
+		return err;
+	}
+
+	if (info.type != BT_CONN_TYPE_LE || !bt_le_bond_exists(info.id, info.le.dst)) {
+		return -ENOENT;
+	}
+
+	bt_addr_le_copy(&dm->peer, info.le.dst);
+
+	dm->read_params.func = db_hash_read_cb;
+	dm->read_params.handle_count = 0;
+	dm->read_params.by_uuid.start_handle = BT_ATT_FIRST_ATTRIBUTE_HANDLE;
+	dm->read_params.by_uuid.end_handle = BT_ATT_LAST_ATTRIBUTE_HANDLE;
+	dm->read_params.by_uuid.uuid = BT_UUID_GATT_DB_HASH;
+
+	return bt_gatt_read(dm->conn, &dm->read_params);
+}
+
+struct cache_clear_ctx {
+	const char *subtree;
+	int err;
+};
+
+static int cache_clear_cb(const char *key, size_t len, settings_read_cb read_cb,
+			  void *cb_arg, void *param)
+{
+	struct cache_clear_ctx *ctx = param;
+	char name[CACHE_KEY_LEN];
+	int err;
+
+	if (!key) {
+		return 0;
+	}
+
+	snprintk(name, sizeof(name), "%s/%s", ctx->subtree, key);
+
+	err = settings_delete(name);
+	if (err) {
+		LOG_WRN("Failed to delete %s (err %d)", name, err);
+		ctx->err = err;
+	}
+
+	return 0;
+}
+
+int bt_gatt_dm_cache_clear(const bt_addr_le_t *peer)
+{
+	char subtree[CACHE_KEY_LEN] = CACHE_SUBTREE;
+	struct cache_clear_ctx ctx = {
+		.subtree = subtree,
+	};
+	int err;
+
+	if (peer) {
+		size_t len = strlen(subtree);
+
+		subtree[len++] = '/';
+		bin2hex((const uint8_t *)peer, sizeof(*peer), &subtree[len],
+			sizeof(subtree) - len);
+	}
+
+	err = settings_load_subtree_direct(subtree, cache_clear_cb, &ctx);
+
+	return err ? err : ctx.err;
+}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 int bt_gatt_dm_start(struct bt_conn *conn,
 		     const struct bt_uuid *svc_uuid,
 		     const struct bt_gatt_dm_cb *cb,
@@ -679,6 +1221,17 @@ int bt_gatt_dm_start(struct bt_conn *conn,
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
 	k_work_init(&dm->discover_work, gatt_discover_work);
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	k_work_init(&dm->cache_work, cache_lookup_work);
+
+	err = cache_lookup_start(dm);
+	if (!err) {
+		return 0;
+	}
+
+	LOG_DBG("Discovering without the cache (err %d)", err);
+#endif
+
 	err = bt_gatt_discover(conn, &dm->discover_params);
 	if (err) {
 		LOG_ERR("Discover failed, error: %d.", err);
@@ -722,6 +1275,15 @@ int bt_gatt_dm_continue(struct bt_gatt_dm *dm, void *context)
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
 	dm->discover_params.uuid = dm->search_svc_by_uuid ? &dm->svc_uuid.uuid : NULL;
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	if (dm->hash_valid) {
+		/* The Database Hash read at the start is still valid */
+		dm->search_start = dm->discover_params.start_handle;
+		cache_work_submit(&dm->cache_work);
+		return 0;
+	}
+#endif
+
 	err = bt_gatt_discover(dm->conn, &dm->discover_params);
 	if (err) {
 		LOG_ERR("Discover failed, error: %d.", err);
@@ -76,6 +76,26 @@ static void cadence_store(struct bt_mesh_sensor_srv *srv)
 }
 
 
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_VALUE_CACHE)
+static struct k_spinlock cache_lock;
+
+static bool cache_get(struct bt_mesh_sensor *sensor,
+		      struct bt_mesh_sensor_value *value)
+{
+	k_spinlock_key_t key = k_spin_lock(&cache_lock);
+	bool cached = sensor->state.cached;
+
+	if (cached) {
+		memcpy(value, sensor->state.cache,
+		       sizeof(value[0]) * sensor->type->channel_count);
+	}
+
+	k_spin_unlock(&cache_lock, key);
+
+	return cached;
+}
+#endif
+
 static int value_get(struct bt_mesh_sensor_srv *srv,
 		     struct bt_mesh_sensor *sensor,
 		     struct bt_mesh_msg_ctx *ctx,
@@ -83,6 +103,13 @@ static int value_get(struct bt_mesh_sensor_srv *srv,
 {
 	int err;
 
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_VALUE_CACHE)
+	if (cache_get(sensor, value)) {
+		sensor_cadence_update(sensor, value);
+		return 0;
+	}
+#endif
+
 	if (!sensor->get) {
 		return -ENOTSUP;
 	}
@@ -565,6 +592,10 @@ static int cadence_set(const struct bt_mesh_model *model, struct bt_mesh_msg_ctx
 	sensor->state.pub_div = period_div;
 	sensor->state.threshold = threshold;
 	sensor->state.configured = true;
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_VALUE_CACHE)
+	/* The cached value must be checked against the new thresholds. */
+	sensor->state.dirty = true;
+#endif
 
 	/** Reschedule publication timer if the cadence increased. */
 	if (period_div > srv->pub.period_div) {
@@ -870,47 +901,136 @@ static uint16_t min_int_get(const struct bt_mesh_sensor *sensor,
 	return DIV_ROUND_UP(min_int, pub_int);
 }
 
+/** @brief Get the length of a sensor's Marshalled Sensor Data.
+ *
+ *  @param type Sensor type.
+ *
+ *  @return The length of the sensor's entry in a Sensor Status message.
+ */
+static uint8_t status_len(const struct bt_mesh_sensor_type *type)
+{
+	uint8_t len = sensor_value_len(type);
+
+	/* Format A header if the value fits, see sensor_status_id_encode(). */
+	return len + ((len > 0 && len <= 16 && type->id < 2048) ? 2 : 3);
+}
+
+/** @brief Get the maximum length of a periodic publication.
+ *
+ *  The publication must fit into a single access message, including the
+ *  transport MIC.
+ *
+ *  @param srv Server sending the publication.
+ *
+ *  @return The maximum length of the Sensor Status message.
+ */
+static uint16_t pub_len_max(const struct bt_mesh_sensor_srv *srv)
+{
+	return MIN(BT_MESH_TX_SDU_MAX, srv->pub.msg->size) - BT_MESH_MIC_SHORT;
+}
+
+/** @brief Check whether a sensor value fits into a publication.
+ *
+ *  @param srv Server sending the publication.
+ *  @param s   Sensor instance.
+ *
+ *  @return true if the sensor value fits into an otherwise empty Sensor
+ *          Status message.
+ */
+static bool pub_fits(const struct bt_mesh_sensor_srv *srv, const struct bt_mesh_sensor *s)
+{
+	return BT_MESH_MODEL_OP_LEN(BT_MESH_SENSOR_OP_STATUS) + status_len(s->type) <=
+	       pub_len_max(srv);
+}
+
+/** @brief Check whether a sensor value needs to be evaluated for publication.
+ *
+ *  A cached value that has been evaluated before, and hasn't changed since,
+ *  can't trigger a delta threshold publication.
+ *
+ *  @param s     Sensor instance.
+ *  @param clear Mark the current value as evaluated.
+ *
+ *  @return true if the sensor value must be checked against the sensor's
+ *          delta thresholds.
+ */
+static bool value_changed(struct bt_mesh_sensor *s, bool clear)
+{
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_VALUE_CACHE)
+	k_spinlock_key_t key = k_spin_lock(&cache_lock);
+	bool changed = !s->state.cached || s->state.dirty;
+
+	if (clear) {
+		s->state.dirty = false;
+	}
+
+	k_spin_unlock(&cache_lock, key);
+
+	return changed;
+#else
+	return true;
+#endif
+}
+
 /** @brief Conditionally add a sensor value to a publication.
  *
  *  A sensor message will be added to the publication if its minimum interval
  *  has expired and the value is outside its delta threshold or the
  *  publication interval has expired.
  *
+ *  Sensor values that don't fit into a single access message are deferred to
+ *  the next publication. Deferred sensor values are published without checking
+ *  their cadence again, and the space they need is reserved in the
+ *  publication until they have been added.
+ *
  *  @param srv         Server sending the publication.
  *  @param s           Sensor to add data of.
  *  @param period_div  Server's original period divisor.
  *  @param base_period Server's original base period.
+ *  @param reserved    Length reserved for deferred sensor values not yet
+ *                     added to the publication.
  */
 static void pub_msg_add(struct bt_mesh_sensor_srv *srv,
 			struct bt_mesh_sensor *s, uint8_t period_div,
-			uint32_t base_period)
+			uint32_t base_period, uint16_t *reserved)
 {
 	struct net_buf_simple_state state;
 	uint16_t min_int = min_int_get(s, period_div, base_period);
 	uint16_t delta = srv->seq - s->state.seq;
+	uint8_t len = status_len(s->type);
+	bool deferred = s->state.deferred;
 	int err;
 
-	if (delta < min_int) {
+	/* Deferring a value that never fits would block the sensors after it. */
+	if (!pub_fits(srv, s)) {
 		return;
 	}
 
-	if (!s->state.configured &&
-	    (delta < (1 << period_div))) {
+	if (deferred) {
+		*reserved -= len;
+	} else if (delta < min_int) {
+		return;
+	} else if (!s->state.configured &&
+		   (delta < (1 << period_div))) {
 		/** Don't publish a sensor value with not configured sensor cadence state more
 		 * frequently than base periodic publication.
 		 */
 		return;
+	} else if (s->state.configured && !value_changed(s, false) &&
+		   delta < pub_int_get(s, period_div)) {
+		return;
 	}
 
 	struct bt_mesh_sensor_value value[CONFIG_BT_MESH_SENSOR_CHANNELS_MAX] = {};
+	bool changed = value_changed(s, true);
 
 	err = value_get(srv, s, NULL, value);
 	if (err) {
 		return;
 	}
 
-	if (s->state.configured) {
-		bool delta_triggered = bt_mesh_sensor_delta_threshold(s, value);
+	if (!deferred && s->state.configured) {
+		bool delta_triggered = changed && bt_mesh_sensor_delta_threshold(s, value);
 		uint16_t interval = pub_int_get(s, period_div);
 
 		if (!delta_triggered && delta < interval) {
@@ -918,6 +1038,12 @@ static void pub_msg_add(struct bt_mesh_sensor_srv *srv,
 		}
 	}
 
+	if (srv->pub.msg->len + len + (deferred ? 0 : *reserved) > pub_len_max(srv)) {
+		LOG_DBG("Deferring 0x%04x", s->type->id);
+		s->state.deferred = true;
+		return;
+	}
+
 	net_buf_simple_save(srv->pub.msg, &state);
 	err = sensor_status_encode(srv->pub.msg, s, value);
 	if (err) {
@@ -928,12 +1054,23 @@ static void pub_msg_add(struct bt_mesh_sensor_srv *srv,
 
 	s->state.prev = value[0];
 	s->state.seq = srv->seq;
+	s->state.deferred = false;
+
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_VALUE_CACHE)
+	/* An unchanged cached value is not read again, so the cadence must be
+	 * updated against the new previously published value right away.
+	 */
+	if (s->state.cached) {
+		sensor_cadence_update(s, value);
+	}
+#endif
 }
 
 static int update_handler(const struct bt_mesh_model *model)
 {
 	struct bt_mesh_sensor_srv *srv = model->rt->user_data;
 	struct bt_mesh_sensor *s;
+	uint16_t reserved = 0;
 
 	bt_mesh_model_msg_init(srv->pub.msg, BT_MESH_SENSOR_OP_STATUS);
 
@@ -956,7 +1093,14 @@ static int update_handler(const struct bt_mesh_model *model)
 
 	SENSOR_FOR_EACH(&srv->sensors, s)
 	{
-		pub_msg_add(srv, s, period_div, base_period);
+		if (s->state.deferred) {
+			reserved += status_len(s->type);
+		}
+	}
+
+	SENSOR_FOR_EACH(&srv->sensors, s)
+	{
+		pub_msg_add(srv, s, period_div, base_period, &reserved);
 
 		/** Update the publication divisor to a new value. This is needed to take new
 		 * changes in a sensor cadence state, .e.g. when the cadence decreased.
@@ -1024,6 +1168,13 @@ static int sensor_srv_init(const struct bt_mesh_model *model)
 	net_buf_simple_init_with_data(&srv->setup_pub_buf, srv->setup_pub_data,
 				      sizeof(srv->setup_pub_data));
 
+	for (int i = 0; i < srv->sensor_count; ++i) {
+		if (!pub_fits(srv, srv->sensor_array[i])) {
+			LOG_ERR("Sensor 0x%04x too long to be published",
+				srv->sensor_array[i]->type->id);
+		}
+	}
+
 	return 0;
 }
 
@@ -1040,6 +1191,7 @@ static void sensor_srv_reset(const struct bt_mesh_model *model)
 		s->state.pub_div = 0;
 		s->state.min_int = 0;
 		s->state.configured = false;
+		s->state.deferred = false;
 		memset(&s->state.threshold, 0, sizeof(s->state.threshold));
 	}
 
@@ -1186,3 +1338,33 @@ int bt_mesh_sensor_srv_sample(struct bt_mesh_sensor_srv *srv,
 
 	return bt_mesh_sensor_srv_pub(srv, NULL, sensor, value);
 }
+
+int bt_mesh_sensor_srv_value_update(struct bt_mesh_sensor_srv *srv,
+				    struct bt_mesh_sensor *sensor,
+				    const struct bt_mesh_sensor_value *value)
+{
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_VALUE_CACHE)
+	size_t size = sizeof(value[0]) * sensor->type->channel_count;
+	k_spinlock_key_t key;
+
+	for (uint32_t i = 0; i < sensor->type->channel_count; ++i) {
+		if (value[i].format != sensor->type->channels[i].format) {
+			return -EINVAL;
+		}
+	}
+
+	key = k_spin_lock(&cache_lock);
+
+	if (!sensor->state.cached || memcmp(sensor->state.cache, value, size)) {
+		memcpy(sensor->state.cache, value, size);
+		sensor->state.cached = true;
+		sensor->state.dirty = true;
+	}
+
+	k_spin_unlock(&cache_lock, key);
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
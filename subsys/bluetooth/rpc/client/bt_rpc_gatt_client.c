@@ -9,10 +9,13 @@
 
 #include <sys/types.h>
 
+#include <zephyr/kernel.h>
 #include <zephyr/bluetooth/bluetooth.h>
 #include <zephyr/bluetooth/att.h>
 #include <zephyr/bluetooth/gatt.h>
 
+#include <bluetooth/bt_rpc.h>
+
 #include "bt_rpc_common.h"
 #include "bt_rpc_gatt_common.h"
 #include <nrf_rpc/nrf_rpc_serialize.h>
@@ -799,6 +802,244 @@ int bt_gatt_notify_multiple(struct bt_conn *conn, uint16_t num_params,
 }
 #endif /* CONFIG_BT_GATT_NOTIFY_MULTIPLE */
 
+#if defined(CONFIG_BT_RPC_GATT_NOTIFY_ASYNC)
+/* Queued notification, followed by its data in the batch buffer. */
+struct notify_async_entry {
+	struct bt_conn *conn;
+	bt_rpc_gatt_notify_done_t done;
+	void *user_data;
+	uint32_t attr_index;
+	uint16_t len;
+	uint8_t data[];
+};
+
+/* Notification taken from the batch buffer, completed after the lock is released. */
+struct notify_async_sent {
+	struct bt_conn *conn;
+	bt_rpc_gatt_notify_done_t done;
+	void *user_data;
+};
+
+static void notify_async_flush_work_handler(struct k_work *work);
+
+static K_MUTEX_DEFINE(notify_async_lock);
+static K_WORK_DELAYABLE_DEFINE(notify_async_flush_work, notify_async_flush_work_handler);
+static uint8_t notify_async_buf[CONFIG_BT_RPC_GATT_NOTIFY_ASYNC_BUF_SIZE] __aligned(sizeof(void *));
+static size_t notify_async_used;
+static size_t notify_async_count;
+
+static size_t notify_async_entry_size(uint16_t len)
+{
+	return ROUND_UP(sizeof(struct notify_async_entry) + len, sizeof(void *));
+}
+
+static int notify_async_flush_locked(struct notify_async_sent *sent, size_t *sent_count)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+	size_t buffer_size_max = 5;
+	size_t offset;
+	size_t i;
+
+	*sent_count = 0;
+
+	if (notify_async_count == 0) {
+		return 0;
+	}
+
+	(void)k_work_cancel_delayable(&notify_async_flush_work);
+
+	for (offset = 0; offset < notify_async_used;) {
+		const struct notify_async_entry *entry =
+			(const struct notify_async_entry *)&notify_async_buf[offset];
+
+		buffer_size_max += 28 + entry->len;
+		offset += notify_async_entry_size(entry->len);
+	}
+
+	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
+	nrf_rpc_encode_uint(&ctx, notify_async_count);
+
+	for (offset = 0, i = 0; offset < notify_async_used; i++) {
+		const struct notify_async_entry *entry =
+			(const struct notify_async_entry *)&notify_async_buf[offset];
+
+		bt_rpc_encode_bt_conn(&ctx, entry->conn);
+		nrf_rpc_encode_uint(&ctx, entry->attr_index);
+		nrf_rpc_encode_buffer(&ctx, entry->data, entry->len);
+		nrf_rpc_encode_uint(&ctx, (uintptr_t)entry->done);
+		nrf_rpc_encode_uint(&ctx, (uintptr_t)entry->user_data);
+		/* Returned by the host with the result, to release the connection reference */
+		nrf_rpc_encode_uint(&ctx, (uintptr_t)entry->conn);
+
+		sent[i].conn = entry->conn;
+		sent[i].done = entry->done;
+		sent[i].user_data = entry->user_data;
+
+		offset += notify_async_entry_size(entry->len);
+	}
+
+	*sent_count = notify_async_count;
+	notify_async_used = 0;
+	notify_async_count = 0;
+
+	return nrf_rpc_cbor_evt(&bt_rpc_grp, BT_RPC_GATT_NOTIFY_ASYNC_RPC_EVT, &ctx);
+}
+
+/* Releases the notifications taken from the batch buffer. The ones with a completion
+ * callback keep the connection reference until the host reports the result, unless
+ * the batch could not be sent.
+ */
+static void notify_async_sent_release(const struct notify_async_sent *sent, size_t sent_count,
+				      int err)
+{
+	for (size_t i = 0; i < sent_count; i++) {
+		if (err && sent[i].done) {
+			sent[i].done(sent[i].conn, err, sent[i].user_data);
+		}
+
+		if (err || !sent[i].done) {
+			bt_conn_unref(sent[i].conn);
+		}
+	}
+}
+
+static int notify_async_flush(void)
+{
+	struct notify_async_sent sent[CONFIG_BT_RPC_GATT_NOTIFY_ASYNC_MAX_COUNT];
+	size_t sent_count;
+	int err;
+
+	k_mutex_lock(&notify_async_lock, K_FOREVER);
+	err = notify_async_flush_locked(sent, &sent_count);
+	k_mutex_unlock(&notify_async_lock);
+
+	notify_async_sent_release(sent, sent_count, err);
+
+	return err;
+}
+
+static void notify_async_flush_work_handler(struct k_work *work)
+{
+	int err;
+
+	err = notify_async_flush();
+	if (err) {
+		LOG_ERR("Failed to send notification batch: %d", err);
+	}
+}
+
+int bt_rpc_gatt_notify_async(struct bt_conn *conn, const struct bt_gatt_attr *attr,
+			     const void *data, uint16_t len, bt_rpc_gatt_notify_done_t done,
+			     void *user_data)
+{
+	struct notify_async_sent sent[CONFIG_BT_RPC_GATT_NOTIFY_ASYNC_MAX_COUNT];
+	size_t sent_count = 0;
+	struct notify_async_entry *entry;
+	const size_t entry_size = notify_async_entry_size(len);
+	uint32_t attr_index;
+	int err;
+
+	/* A notification to all connections would complete once per connection */
+	if (!conn || !attr) {
+		return -EINVAL;
+	}
+
+	if (entry_size > sizeof(notify_async_buf)) {
+		return -EMSGSIZE;
+	}
+
+	err = bt_rpc_gatt_attr_to_index(attr, &attr_index);
+	if (err) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&notify_async_lock, K_FOREVER);
+
+	/* Fewer than CONFIG_BT_RPC_GATT_NOTIFY_ASYNC_MAX_COUNT notifications are queued
+	 * here, so at most one of the batches below is sent.
+	 */
+	if (notify_async_used + entry_size > sizeof(notify_async_buf)) {
+		err = notify_async_flush_locked(sent, &sent_count);
+		if (err) {
+			goto unlock;
+		}
+	}
+
+	entry = (struct notify_async_entry *)&notify_async_buf[notify_async_used];
+	entry->conn = bt_conn_ref(conn);
+	entry->done = done;
+	entry->user_data = user_data;
+	entry->attr_index = attr_index;
+	entry->len = len;
+	memcpy(entry->data, data, len);
+
+	notify_async_used += entry_size;
+	notify_async_count++;
+
+	if (notify_async_count >= CONFIG_BT_RPC_GATT_NOTIFY_ASYNC_MAX_COUNT) {
+		err = notify_async_flush_locked(sent, &sent_count);
+	} else if (notify_async_count == 1) {
+		(void)k_work_schedule(&notify_async_flush_work,
+				      K_MSEC(CONFIG_BT_RPC_GATT_NOTIFY_ASYNC_LATENCY_MS));
+	}
+
+unlock:
+	k_mutex_unlock(&notify_async_lock);
+
+	notify_async_sent_release(sent, sent_count, err);
+
+	return err;
+}
+
+int bt_rpc_gatt_notify_flush(void)
+{
+	return notify_async_flush();
+}
+
+static void bt_rpc_gatt_notify_async_done_rpc_handler(const struct nrf_rpc_group *group,
+						      struct nrf_rpc_cbor_ctx *ctx,
+						      void *handler_data)
+{
+	struct {
+		struct bt_conn *conn;
+		int err;
+		bt_rpc_gatt_notify_done_t done;
+		void *user_data;
+	} results[BT_RPC_GATT_NOTIFY_ASYNC_DONE_MAX];
+	uint32_t count;
+
+	count = nrf_rpc_decode_uint(ctx);
+	if (count > ARRAY_SIZE(results)) {
+		nrf_rpc_decoder_invalid(ctx, ZCBOR_ERR_UNKNOWN);
+		count = 0;
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		results[i].conn = (struct bt_conn *)nrf_rpc_decode_uint(ctx);
+		results[i].err = nrf_rpc_decode_int(ctx);
+		results[i].done = (bt_rpc_gatt_notify_done_t)nrf_rpc_decode_uint(ctx);
+		results[i].user_data = (void *)nrf_rpc_decode_uint(ctx);
+	}
+
+	if (!nrf_rpc_decoding_done_and_check(group, ctx)) {
+		goto decoding_error;
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		results[i].done(results[i].conn, results[i].err, results[i].user_data);
+		bt_conn_unref(results[i].conn);
+	}
+
+	return;
+decoding_error:
+	report_decoding_error(BT_RPC_GATT_NOTIFY_ASYNC_DONE_RPC_EVT, handler_data);
+}
+
+NRF_RPC_CBOR_EVT_DECODER(bt_rpc_grp, bt_rpc_gatt_notify_async_done,
+			 BT_RPC_GATT_NOTIFY_ASYNC_DONE_RPC_EVT,
+			 bt_rpc_gatt_notify_async_done_rpc_handler, NULL);
+#endif /* CONFIG_BT_RPC_GATT_NOTIFY_ASYNC */
+
 static size_t bt_gatt_indicate_params_sp_size(const struct bt_gatt_indicate_params *data)
 {
 	size_t scratchpad_size = 0;
@@ -12,6 +12,8 @@
 #include <nrf_rpc/nrf_rpc_ipc.h>
 #elif CONFIG_NRF_RPC_UART_TRANSPORT
 #include <nrf_rpc/nrf_rpc_uart.h>
+#elif CONFIG_MOCK_NRF_RPC_TRANSPORT
+#include <mock_nrf_rpc_transport.h>
 #endif
 #include <nrf_rpc_cbor.h>
 
@@ -26,6 +28,8 @@ BUILD_ASSERT(!IS_ENABLED(CONFIG_BT_BREDR), "BT_RPC does not support BR/EDR");
 NRF_RPC_IPC_TRANSPORT(bt_rpc_tr, DEVICE_DT_GET(DT_NODELABEL(ipc0)), "bt_rpc_ept");
 #elif defined(CONFIG_NRF_RPC_UART_TRANSPORT)
 #define bt_rpc_tr NRF_RPC_UART_TRANSPORT(DT_CHOSEN(nordic_rpc_uart))
+#elif defined(CONFIG_MOCK_NRF_RPC_TRANSPORT)
+#define bt_rpc_tr mock_nrf_rpc_tr
 #endif
 NRF_RPC_GROUP_DEFINE(bt_rpc_grp, "bt_rpc", &bt_rpc_tr, NULL, NULL, NULL);
 
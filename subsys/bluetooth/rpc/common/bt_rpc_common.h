@@ -146,6 +146,14 @@ enum bt_rpc_cmd_from_cli_to_host {
 	BT_HCI_CMD_SEND_SYNC_RPC_CMD,
 };
 
+/** @brief Client events IDs used in bluetooth API serialization.
+ *         Those events are sent from the client to the host.
+ */
+enum bt_rpc_evt_from_cli_to_host {
+	/* bt_rpc.h API */
+	BT_RPC_GATT_NOTIFY_ASYNC_RPC_EVT,
+};
+
 /** @brief Host commands IDs used in bluetooth API serialization.
  *         Those commands are sent from the host to the client.
  */
@@ -208,8 +216,15 @@ enum bt_rpc_cmd_from_host_to_cli {
 enum bt_rpc_evt_from_host_to_cli {
 	/* bluetooth.h API */
 	BT_READY_CB_T_CALLBACK_RPC_EVT,
+	/* bt_rpc.h API */
+	BT_RPC_GATT_NOTIFY_ASYNC_DONE_RPC_EVT,
 };
 
+/** @brief Maximum number of notification results reported in a single
+ *         BT_RPC_GATT_NOTIFY_ASYNC_DONE_RPC_EVT event.
+ */
+#define BT_RPC_GATT_NOTIFY_ASYNC_DONE_MAX 16
+
 /** @brief Pairing flags IDs. Those flags are used to setup valid callback sets on
  *         the host side.
  */
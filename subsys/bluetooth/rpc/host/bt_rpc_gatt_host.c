@@ -815,6 +815,187 @@ decoding_error:
 NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_notify_cb, BT_GATT_NOTIFY_CB_RPC_CMD,
 			 bt_gatt_notify_cb_rpc_handler, NULL);
 
+#if defined(CONFIG_BT_RPC_GATT_NOTIFY_ASYNC)
+/* Maximum encoded size of a single notification result. */
+#define NOTIFY_ASYNC_RESULT_SIZE 20
+
+/* Completion of a notification queued by bt_rpc_gatt_notify_async() on the client.
+ * The connection, callback and user data are the client values, returned unchanged.
+ */
+struct bt_rpc_gatt_notify_async_result {
+	sys_snode_t node;
+	uint32_t conn;
+	int err;
+	uint32_t done;
+	uint32_t user_data;
+};
+
+static void notify_async_done_work_handler(struct k_work *work);
+
+static K_WORK_DEFINE(notify_async_done_work, notify_async_done_work_handler);
+static sys_slist_t notify_async_results = SYS_SLIST_STATIC_INIT(&notify_async_results);
+static struct k_spinlock notify_async_results_lock;
+
+static void notify_async_result_add(struct bt_rpc_gatt_notify_async_result *result)
+{
+	k_spinlock_key_t key = k_spin_lock(&notify_async_results_lock);
+
+	sys_slist_append(&notify_async_results, &result->node);
+	k_spin_unlock(&notify_async_results_lock, key);
+
+	k_work_submit(&notify_async_done_work);
+}
+
+static struct bt_rpc_gatt_notify_async_result *notify_async_result_get(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&notify_async_results_lock);
+	sys_snode_t *node = sys_slist_get(&notify_async_results);
+
+	k_spin_unlock(&notify_async_results_lock, key);
+
+	return node ? CONTAINER_OF(node, struct bt_rpc_gatt_notify_async_result, node) : NULL;
+}
+
+static void notify_async_result_encode(struct nrf_rpc_cbor_ctx *ctx, uint32_t conn, int err,
+				       uint32_t done, uint32_t user_data)
+{
+	nrf_rpc_encode_uint(ctx, conn);
+	nrf_rpc_encode_int(ctx, err);
+	nrf_rpc_encode_uint(ctx, done);
+	nrf_rpc_encode_uint(ctx, user_data);
+}
+
+/* Reports a failure without allocating a result, so it cannot fail on low memory. */
+static void notify_async_error_send(uint32_t conn, int err, uint32_t done, uint32_t user_data)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+
+	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, 5 + NOTIFY_ASYNC_RESULT_SIZE);
+	nrf_rpc_encode_uint(&ctx, 1);
+	notify_async_result_encode(&ctx, conn, err, done, user_data);
+
+	nrf_rpc_cbor_evt_no_err(&bt_rpc_grp, BT_RPC_GATT_NOTIFY_ASYNC_DONE_RPC_EVT, &ctx);
+}
+
+static void notify_async_done_work_handler(struct k_work *work)
+{
+	struct bt_rpc_gatt_notify_async_result *results[BT_RPC_GATT_NOTIFY_ASYNC_DONE_MAX];
+	struct nrf_rpc_cbor_ctx ctx;
+	size_t count;
+
+	/* Report the completions collected so far in as few events as possible */
+	do {
+		for (count = 0; count < ARRAY_SIZE(results); count++) {
+			results[count] = notify_async_result_get();
+			if (!results[count]) {
+				break;
+			}
+		}
+
+		if (count == 0) {
+			break;
+		}
+
+		NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, 5 + count * NOTIFY_ASYNC_RESULT_SIZE);
+		nrf_rpc_encode_uint(&ctx, count);
+
+		for (size_t i = 0; i < count; i++) {
+			notify_async_result_encode(&ctx, results[i]->conn, results[i]->err,
+						   results[i]->done, results[i]->user_data);
+			k_free(results[i]);
+		}
+
+		nrf_rpc_cbor_evt_no_err(&bt_rpc_grp, BT_RPC_GATT_NOTIFY_ASYNC_DONE_RPC_EVT, &ctx);
+	} while (count == ARRAY_SIZE(results));
+}
+
+static void notify_async_sent(struct bt_conn *conn, void *user_data)
+{
+	notify_async_result_add(user_data);
+}
+
+static void bt_rpc_gatt_notify_async_rpc_handler(const struct nrf_rpc_group *group,
+						 struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
+{
+	struct bt_gatt_notify_params params = {0};
+	struct bt_rpc_gatt_notify_async_result *result;
+	struct bt_conn *conn;
+	uint32_t count;
+	uint32_t done;
+	uint32_t user_data;
+	uint32_t client_conn;
+	size_t len;
+	int err;
+
+	count = nrf_rpc_decode_uint(ctx);
+
+	/* The notification data is used directly from the received packet, so each
+	 * notification is passed to the stack before decoding the next one.
+	 */
+	for (uint32_t i = 0; i < count && nrf_rpc_decode_valid(ctx); i++) {
+		conn = bt_rpc_decode_bt_conn(ctx);
+		params.attr = bt_rpc_decode_gatt_attr(ctx);
+		params.data = nrf_rpc_decode_buffer_ptr_and_size(ctx, &len);
+		params.len = len;
+		done = nrf_rpc_decode_uint(ctx);
+		user_data = nrf_rpc_decode_uint(ctx);
+		client_conn = nrf_rpc_decode_uint(ctx);
+
+		if (!nrf_rpc_decode_valid(ctx)) {
+			break;
+		}
+
+		if (!conn) {
+			LOG_WRN("Dropping notification for unknown connection");
+
+			if (done) {
+				notify_async_error_send(client_conn, -ENOTCONN, done, user_data);
+			}
+
+			continue;
+		}
+
+		result = NULL;
+
+		if (done) {
+			result = k_malloc(sizeof(*result));
+			if (!result) {
+				LOG_ERR("No memory for notification result");
+				notify_async_error_send(client_conn, -ENOMEM, done, user_data);
+				continue;
+			}
+
+			result->conn = client_conn;
+			result->err = 0;
+			result->done = done;
+			result->user_data = user_data;
+		}
+
+		params.func = result ? notify_async_sent : NULL;
+		params.user_data = result;
+
+		err = bt_gatt_notify_cb(conn, &params);
+
+		if (err && result) {
+			result->err = err;
+			notify_async_result_add(result);
+		}
+	}
+
+	if (!nrf_rpc_decoding_done_and_check(group, ctx)) {
+		goto decoding_error;
+	}
+
+	return;
+decoding_error:
+	report_decoding_error(BT_RPC_GATT_NOTIFY_ASYNC_RPC_EVT, handler_data);
+}
+
+NRF_RPC_CBOR_EVT_DECODER(bt_rpc_grp, bt_rpc_gatt_notify_async,
+			 BT_RPC_GATT_NOTIFY_ASYNC_RPC_EVT,
+			 bt_rpc_gatt_notify_async_rpc_handler, NULL);
+#endif /* CONFIG_BT_RPC_GATT_NOTIFY_ASYNC */
+
 static void bt_gatt_indicate_params_dec(struct nrf_rpc_scratchpad *scratchpad,
 					struct bt_gatt_indicate_params *data)
 {
@@ -14,6 +14,13 @@ LOG_MODULE_REGISTER(nrf_bt_scan, CONFIG_BT_SCAN_LOG_LEVEL);
 
 #define BT_SCAN_UUID_128_SIZE 16
 
+/* Sizes of the filter hash tables, at most half full */
+#define ADDR_HASH_SIZE (2 * CONFIG_BT_SCAN_ADDRESS_CNT + 1)
+#define UUID_HASH_SIZE (2 * CONFIG_BT_SCAN_UUID_CNT + 1)
+
+/* Bitmap of the first characters of the names in a filter */
+#define NAME_CHAR_MAP_LEN (BIT(8) / 32)
+
 #define MODE_CHECK (BT_SCAN_NAME_FILTER | BT_SCAN_ADDR_FILTER | \
 	BT_SCAN_SHORT_NAME_FILTER | BT_SCAN_APPEARANCE_FILTER | \
 	BT_SCAN_UUID_FILTER | BT_SCAN_MANUFACTURER_DATA_FILTER)
@@ -55,6 +62,9 @@ struct bt_scan_name_filter {
 	 */
 	char target_name[CONFIG_BT_SCAN_NAME_CNT][CONFIG_BT_SCAN_NAME_MAX_LEN];
 
+	/* First characters of the target names. */
+	uint32_t first_char[NAME_CHAR_MAP_LEN];
+
 	/* Name filter counter. */
 	uint8_t cnt;
 
@@ -76,6 +86,9 @@ struct bt_scan_short_name_filter {
 		uint8_t min_len;
 	} name[CONFIG_BT_SCAN_SHORT_NAME_CNT];
 
+	/* First characters of the target short names. */
+	uint32_t first_char[NAME_CHAR_MAP_LEN];
+
 	/* Short name filter counter. */
 	uint8_t cnt;
 
@@ -89,6 +102,9 @@ struct bt_scan_addr_filter {
 	/* Addresses advertised by the peripherals. */
 	bt_addr_le_t target_addr[CONFIG_BT_SCAN_ADDRESS_CNT];
 
+	/* Hash table of the target addresses. */
+	uint8_t hash[ADDR_HASH_SIZE];
+
 	/* Address filter counter. */
 	uint8_t cnt;
 
@@ -120,6 +136,12 @@ struct bt_scan_uuid_filter {
 	 */
 	struct bt_scan_uuid uuid[CONFIG_BT_SCAN_UUID_CNT];
 
+	/* UUIDs converted to 128-bit, as compared by the hash table. */
+	uint8_t key[CONFIG_BT_SCAN_UUID_CNT][BT_SCAN_UUID_128_SIZE];
+
+	/* Hash table of the target UUIDs. */
+	uint8_t hash[UUID_HASH_SIZE];
+
 	/* UUID filter counter. */
 	uint8_t cnt;
 
@@ -266,10 +288,64 @@ static struct bt_scan {
 	struct conn_blocklist blocklist;
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
+#if CONFIG_BT_SCAN_STATS
+	/* Filter statistics. */
+	struct bt_scan_stats stats;
+#endif /* CONFIG_BT_SCAN_STATS */
+
 } bt_scan;
 
+/* The Bluetooth Base UUID, used for converting UUIDs to 128-bit. */
+static const uint8_t uuid_base[BT_SCAN_UUID_128_SIZE] = {
+	0xfb, 0x34, 0x9b, 0x5f, 0x80, 0x00, 0x00, 0x80,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static sys_slist_t callback_list;
 
+/* FNV-1a hash of the filter data. */
+static uint32_t filter_hash(const uint8_t *data, size_t len)
+{
+	uint32_t hash = 2166136261U;
+
+	for (size_t i = 0; i < len; i++) {
+		hash ^= data[i];
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+/* The filter hash tables use open addressing. Each bucket holds the filter
+ * index increased by one, and zero marks an empty bucket.
+ */
+static void filter_hash_insert(uint8_t *table, size_t size, uint32_t hash,
+			       uint8_t idx)
+{
+	hash %= size;
+
+	for (size_t i = 0; i < size; i++) {
+		uint8_t *bucket = &table[(hash + i) % size];
+
+		if (!*bucket) {
+			*bucket = idx + 1;
+			return;
+		}
+	}
+
+	__ASSERT(false, "Filter hash table full");
+}
+
+static void char_map_set(uint32_t *map, uint8_t c)
+{
+	map[c / 32] |= BIT(c % 32);
+}
+
+static bool char_map_test(const uint32_t *map, uint8_t c)
+{
+	return (map[c / 32] & BIT(c % 32)) != 0;
+}
+
 void bt_scan_cb_register(struct bt_scan_cb *cb)
 {
 	if (!cb) {
@@ -509,13 +585,22 @@ static void scan_connect_with_target(struct bt_scan_control *control,
 static bool adv_addr_compare(const bt_addr_le_t *target_addr,
 			     struct bt_scan_control *control)
 {
-	const bt_addr_le_t *addr =
-			bt_scan.scan_filters.addr.target_addr;
-	uint8_t counter = bt_scan.scan_filters.addr.cnt;
+	const struct bt_scan_addr_filter *addr_filter =
+			&bt_scan.scan_filters.addr;
+	uint32_t hash = filter_hash((const uint8_t *)target_addr,
+				    sizeof(*target_addr)) % ADDR_HASH_SIZE;
 
-	for (size_t i = 0; i < counter; i++) {
-		if (bt_addr_le_cmp(target_addr, &addr[i]) == 0) {
-			control->filter_status.addr.addr = &addr[i];
+	for (size_t i = 0; i < ARRAY_SIZE(addr_filter->hash); i++) {
+		uint8_t bucket = addr_filter->hash[(hash + i) % ADDR_HASH_SIZE];
+
+		if (!bucket) {
+			break;
+		}
+
+		if (bt_addr_le_cmp(target_addr,
+				   &addr_filter->target_addr[bucket - 1]) == 0) {
+			control->filter_status.addr.addr =
+				&addr_filter->target_addr[bucket - 1];
 
 			return true;
 		}
@@ -564,6 +649,10 @@ static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 
 	/* Add target address to filter. */
 	bt_addr_le_copy(&addr_filter[counter], target_addr);
+	filter_hash_insert(bt_scan.scan_filters.addr.hash, ADDR_HASH_SIZE,
+			   filter_hash((const uint8_t *)target_addr,
+				       sizeof(*target_addr)),
+			   counter);
 
 	LOG_DBG("Filter set on address type %i",
 		addr_filter[counter].type);
@@ -593,6 +682,11 @@ static bool adv_name_compare(const struct bt_data *data,
 	uint8_t counter = bt_scan.scan_filters.name.cnt;
 	uint8_t data_len = data->data_len;
 
+	/* Skip the names that cannot match any of the filters. */
+	if (data_len && !char_map_test(name_filter->first_char, data->data[0])) {
+		return false;
+	}
+
 	/* Compare the name found with the name filter. */
 	for (size_t i = 0; i < counter; i++) {
 		if (adv_name_cmp(data->data,
@@ -656,6 +750,7 @@ static int scan_name_filter_add(const char *name)
 	/* Add name to filter. */
 	memcpy(bt_scan.scan_filters.name.target_name[counter],
 	       name, name_len);
+	char_map_set(bt_scan.scan_filters.name.first_char, name[0]);
 
 	bt_scan.scan_filters.name.cnt++;
 
@@ -685,6 +780,11 @@ static bool adv_short_name_compare(const struct bt_data *data,
 	uint8_t counter = bt_scan.scan_filters.short_name.cnt;
 	uint8_t data_len = data->data_len;
 
+	/* Skip the names that cannot match any of the filters. */
+	if (data_len && !char_map_test(name_filter->first_char, data->data[0])) {
+		return false;
+	}
+
 	/* Compare the name found with the name filters. */
 	for (size_t i = 0; i < counter; i++) {
 		if (adv_short_name_cmp(data->data,
@@ -756,6 +856,7 @@ static int scan_short_name_filter_add(const struct bt_scan_short_name *short_nam
 	memcpy(short_name_filter->name[counter].target_name,
 	       short_name->name,
 	       name_len);
+	char_map_set(short_name_filter->first_char, short_name->name[0]);
 
 	bt_scan.scan_filters.short_name.cnt++;
 
@@ -764,11 +865,48 @@ static int scan_short_name_filter_add(const struct bt_scan_short_name *short_nam
 	return 0;
 }
 
-static bool find_uuid(const uint8_t *data,
-		      uint8_t data_len,
-		      uint8_t uuid_type,
-		      const struct bt_scan_uuid *target_uuid)
+/* Converts the UUID value to 128-bit, as done by bt_uuid_cmp(). */
+static void uuid_key_set(uint8_t *key, const uint8_t *data, uint8_t uuid_len)
 {
+	if (uuid_len == BT_SCAN_UUID_128_SIZE) {
+		memcpy(key, data, BT_SCAN_UUID_128_SIZE);
+	} else {
+		memcpy(key, uuid_base, BT_SCAN_UUID_128_SIZE);
+		memcpy(&key[12], data, uuid_len);
+	}
+}
+
+static int uuid_filter_find(const uint8_t *key)
+{
+	const struct bt_scan_uuid_filter *uuid_filter =
+			&bt_scan.scan_filters.uuid;
+	uint32_t hash = filter_hash(key, BT_SCAN_UUID_128_SIZE) % UUID_HASH_SIZE;
+
+	for (size_t i = 0; i < ARRAY_SIZE(uuid_filter->hash); i++) {
+		uint8_t bucket = uuid_filter->hash[(hash + i) % UUID_HASH_SIZE];
+
+		if (!bucket) {
+			break;
+		}
+
+		if (!memcmp(key, uuid_filter->key[bucket - 1], BT_SCAN_UUID_128_SIZE)) {
+			return bucket - 1;
+		}
+	}
+
+	return -ENOENT;
+}
+
+static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
+			     struct bt_scan_control *control)
+{
+	const struct bt_scan_uuid_filter *uuid_filter =
+			&bt_scan.scan_filters.uuid;
+	const bool all_filters_mode = bt_scan.scan_filters.all_mode;
+	const uint8_t counter = bt_scan.scan_filters.uuid.cnt;
+	uint8_t data_len = data->data_len;
+	uint8_t uuid_match_cnt = 0;
+	bool found[MAX(CONFIG_BT_SCAN_UUID_CNT, 1)] = {};
 	uint8_t uuid_len;
 
 	switch (uuid_type) {
@@ -788,35 +926,22 @@ static bool find_uuid(const uint8_t *data,
 		return false;
 	}
 
-	for (size_t i = 0; i < data_len; i += uuid_len) {
-		struct bt_uuid_128 uuid;
+	/* Look up each advertised UUID once. */
+	for (size_t i = 0; i + uuid_len <= data_len; i += uuid_len) {
+		uint8_t key[BT_SCAN_UUID_128_SIZE];
+		int idx;
 
-		if (!bt_uuid_create(&uuid.uuid, &data[i], uuid_len)) {
-			return false;
-		}
+		uuid_key_set(key, &data->data[i], uuid_len);
 
-		if (bt_uuid_cmp(&uuid.uuid, target_uuid->uuid) == 0) {
-			return true;
+		idx = uuid_filter_find(key);
+		if (idx >= 0) {
+			found[idx] = true;
 		}
 	}
 
-	return false;
-}
-
-static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
-			     struct bt_scan_control *control)
-{
-	const struct bt_scan_uuid_filter *uuid_filter =
-			&bt_scan.scan_filters.uuid;
-	const bool all_filters_mode = bt_scan.scan_filters.all_mode;
-	const uint8_t counter = bt_scan.scan_filters.uuid.cnt;
-	uint8_t data_len = data->data_len;
-	uint8_t uuid_match_cnt = 0;
-
 	for (size_t i = 0; i < counter; i++) {
 
-		if (find_uuid(data->data, data_len, uuid_type,
-			      &uuid_filter->uuid[i])) {
+		if (found[i]) {
 			control->filter_status.uuid.uuid[uuid_match_cnt] =
 				uuid_filter->uuid[i].uuid;
 
@@ -874,12 +999,16 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 	struct bt_uuid_16 *uuid_16;
 	struct bt_uuid_32 *uuid_32;
 	struct bt_uuid_128 *uuid_128;
+	uint8_t *key;
+	uint8_t uuid_value[sizeof(uint32_t)];
 
 	/* If no memory. */
 	if (counter >= CONFIG_BT_SCAN_UUID_CNT) {
 		return -ENOMEM;
 	}
 
+	key = bt_scan.scan_filters.uuid.key[counter];
+
 	/* Check for duplicated filter. */
 	for (size_t i = 0; i < counter; i++) {
 		if (bt_uuid_cmp(uuid_filter[i].uuid, uuid) == 0) {
@@ -917,6 +1046,25 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		return -EINVAL;
 	}
 
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		sys_put_le16(BT_UUID_16(uuid)->val, uuid_value);
+		uuid_key_set(key, uuid_value, sizeof(uint16_t));
+		break;
+
+	case BT_UUID_TYPE_32:
+		sys_put_le32(BT_UUID_32(uuid)->val, uuid_value);
+		uuid_key_set(key, uuid_value, sizeof(uint32_t));
+		break;
+
+	default:
+		uuid_key_set(key, BT_UUID_128(uuid)->val, BT_SCAN_UUID_128_SIZE);
+		break;
+	}
+
+	filter_hash_insert(bt_scan.scan_filters.uuid.hash, UUID_HASH_SIZE,
+			   filter_hash(key, BT_SCAN_UUID_128_SIZE), counter);
+
 	bt_scan.scan_filters.uuid.cnt++;
 	LOG_DBG("Added filter on UUID type %x", uuid->type);
 
@@ -1221,18 +1369,23 @@ void bt_scan_filter_remove_all(void)
 	struct bt_scan_name_filter *name_filter =
 			&bt_scan.scan_filters.name;
 	name_filter->cnt = 0;
+	memset(name_filter->first_char, 0, sizeof(name_filter->first_char));
 
 	struct bt_scan_short_name_filter *short_name_filter =
 			&bt_scan.scan_filters.short_name;
 	short_name_filter->cnt = 0;
+	memset(short_name_filter->first_char, 0,
+	       sizeof(short_name_filter->first_char));
 
 	struct bt_scan_addr_filter *addr_filter =
 			&bt_scan.scan_filters.addr;
 	addr_filter->cnt = 0;
+	memset(addr_filter->hash, 0, sizeof(addr_filter->hash));
 
 	struct bt_scan_uuid_filter *uuid_filter =
 			&bt_scan.scan_filters.uuid;
 	uuid_filter->cnt = 0;
+	memset(uuid_filter->hash, 0, sizeof(uuid_filter->hash));
 
 	struct bt_scan_appearance_filter *appearance_filter =
 			&bt_scan.scan_filters.appearance;
@@ -1458,6 +1611,22 @@ static bool adv_data_found(struct bt_data *data, void *user_data)
 	return true;
 }
 
+#if CONFIG_BT_SCAN_STATS
+static void stats_update(const struct bt_scan_control *control)
+{
+	const struct bt_scan_filter_match *status = &control->filter_status;
+	struct bt_scan_stats *stats = &bt_scan.stats;
+
+	stats->reports++;
+	stats->addr_matches += status->addr.match;
+	stats->name_matches += status->name.match;
+	stats->short_name_matches += status->short_name.match;
+	stats->uuid_matches += status->uuid.match;
+	stats->appearance_matches += status->appearance.match;
+	stats->manufacturer_data_matches += status->manufacturer_data.match;
+}
+#endif /* CONFIG_BT_SCAN_STATS */
+
 static void filter_state_check(struct bt_scan_control *control,
 			       const bt_addr_le_t *addr)
 {
@@ -1467,6 +1636,9 @@ static void filter_state_check(struct bt_scan_control *control,
 
 	if (control->all_mode &&
 	    (control->filter_match_cnt == control->filter_cnt)) {
+#if CONFIG_BT_SCAN_STATS
+		bt_scan.stats.filter_matches++;
+#endif /* CONFIG_BT_SCAN_STATS */
 		notify_filter_matched(&control->device_info,
 				      &control->filter_status,
 				      control->connectable);
@@ -1479,6 +1651,9 @@ static void filter_state_check(struct bt_scan_control *control,
 	 * needed to generate the notification to the main application.
 	 */
 	else if ((!control->all_mode) && control->filter_match) {
+#if CONFIG_BT_SCAN_STATS
+		bt_scan.stats.filter_matches++;
+#endif /* CONFIG_BT_SCAN_STATS */
 		notify_filter_matched(&control->device_info,
 				      &control->filter_status,
 				      control->connectable);
@@ -1486,6 +1661,9 @@ static void filter_state_check(struct bt_scan_control *control,
 		scan_connect_with_target(control, addr);
 #endif /* CONFIG_BT_CENTRAL */
 	} else {
+#if CONFIG_BT_SCAN_STATS
+		bt_scan.stats.filter_no_matches++;
+#endif /* CONFIG_BT_SCAN_STATS */
 		notify_filter_no_match(&control->device_info,
 				       control->connectable);
 	}
@@ -1521,6 +1699,10 @@ static void scan_recv(const struct bt_le_scan_recv_info *info,
 	scan_control.device_info.conn_param = &bt_scan.conn_param;
 	scan_control.device_info.adv_data = ad;
 
+#if CONFIG_BT_SCAN_STATS
+	stats_update(&scan_control);
+#endif /* CONFIG_BT_SCAN_STATS */
+
 	/* In the multifilter mode, the number of the active filters must equal
 	 * the number of the filters matched to generate the notification.
 	 * If the event handler is not NULL, notify the main application.
@@ -1631,6 +1813,24 @@ void bt_scan_conn_attempts_filter_clear(void)
 }
 #endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
 
+#if CONFIG_BT_SCAN_STATS
+int bt_scan_stats_get(struct bt_scan_stats *stats)
+{
+	if (!stats) {
+		return -EINVAL;
+	}
+
+	*stats = bt_scan.stats;
+
+	return 0;
+}
+
+void bt_scan_stats_reset(void)
+{
+	memset(&bt_scan.stats, 0, sizeof(bt_scan.stats));
+}
+#endif /* CONFIG_BT_SCAN_STATS */
+
 #if CONFIG_BT_CENTRAL
 void bt_scan_update_connect_if_match(bool connect_if_match)
 {
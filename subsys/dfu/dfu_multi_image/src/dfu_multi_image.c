@@ -5,6 +5,7 @@
  */
 
 #include <dfu/dfu_multi_image.h>
+#include <zephyr/kernel.h>
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/util.h>
 #include <zcbor_decode.h>
@@ -27,6 +28,15 @@ struct header {
 	size_t image_count;
 };
 
+/* Timings are kept in ticks to not lose the time of short writer calls */
+struct image_stats {
+	size_t bytes_written;
+	int64_t prepare_ticks;
+	int64_t write_ticks;
+	int64_t open_time;
+	int64_t close_time;
+};
+
 struct dfu_multi_image_ctx {
 	/* User configuration */
 	uint8_t *buffer;
@@ -36,6 +46,9 @@ struct dfu_multi_image_ctx {
 
 	/* Parsed header */
 	struct header header;
+#ifdef CONFIG_DFU_MULTI_IMAGE_STATS
+	struct image_stats stats[CONFIG_DFU_MULTI_IMAGE_MAX_IMAGE_COUNT];
+#endif
 
 	/* Current parser state */
 	int cur_image_no;
@@ -46,6 +59,20 @@ struct dfu_multi_image_ctx {
 
 static struct dfu_multi_image_ctx ctx;
 
+static struct image_stats *image_stats(int image_no)
+{
+#ifdef CONFIG_DFU_MULTI_IMAGE_STATS
+	return &ctx.stats[image_no];
+#else
+	return NULL;
+#endif
+}
+
+static int64_t stats_time(void)
+{
+	return IS_ENABLED(CONFIG_DFU_MULTI_IMAGE_STATS) ? k_uptime_ticks() : 0;
+}
+
 static int parse_fixed_header(void)
 {
 	ctx.cur_item_size += sys_get_le16(ctx.buffer);
@@ -94,10 +121,10 @@ static int parse_cbor_header(void)
 	return 0;
 }
 
-static const struct dfu_image_writer *current_image_writer(void)
+static const struct dfu_image_writer *image_writer(int image_no)
 {
-	if (ctx.cur_image_no >= 0 && (size_t)ctx.cur_image_no < ctx.header.image_count) {
-		const int image_id = ctx.header.images[ctx.cur_image_no].id;
+	if (image_no >= 0 && (size_t)image_no < ctx.header.image_count) {
+		const int image_id = ctx.header.images[image_no].id;
 
 		for (size_t i = 0; i < ctx.writer_count; i++) {
 			if (ctx.writers[i].image_id == image_id) {
@@ -109,6 +136,37 @@ static const struct dfu_image_writer *current_image_writer(void)
 	return NULL;
 }
 
+static const struct dfu_image_writer *current_image_writer(void)
+{
+	return image_writer(ctx.cur_image_no);
+}
+
+static int prepare_images(void)
+{
+	for (int i = 0; i < ctx.header.image_count; i++) {
+		const struct dfu_image_writer *writer = image_writer(i);
+		int64_t start;
+		int err;
+
+		if (writer == NULL || writer->prepare == NULL) {
+			continue;
+		}
+
+		start = stats_time();
+		err = writer->prepare(writer->image_id, ctx.header.images[i].size);
+
+		if (err) {
+			return err;
+		}
+
+		if (IS_ENABLED(CONFIG_DFU_MULTI_IMAGE_STATS)) {
+			image_stats(i)->prepare_ticks = stats_time() - start;
+		}
+	}
+
+	return 0;
+}
+
 static void select_next_image(void)
 {
 	ctx.cur_item_offset = 0;
@@ -139,10 +197,15 @@ static int process_current_item(const uint8_t *chunk, size_t chunk_size)
 			} else {
 				err = parse_cbor_header();
 			}
+
+			if (!err && ctx.cur_image_no == IMAGE_NO_CBOR_HEADER) {
+				err = prepare_images();
+			}
 		}
 	} else {
 		/* Image data */
 		const struct dfu_image_writer *writer = current_image_writer();
+		const int64_t start = stats_time();
 
 		if (!writer) {
 			err = -ESPIPE;
@@ -151,6 +214,10 @@ static int process_current_item(const uint8_t *chunk, size_t chunk_size)
 		if (!err && ctx.cur_item_offset == 0) {
 			err = writer->open(writer->image_id,
 					   ctx.header.images[ctx.cur_image_no].size);
+
+			if (IS_ENABLED(CONFIG_DFU_MULTI_IMAGE_STATS)) {
+				image_stats(ctx.cur_image_no)->open_time = start;
+			}
 		}
 
 		if (!err) {
@@ -160,6 +227,18 @@ static int process_current_item(const uint8_t *chunk, size_t chunk_size)
 		if (!err && ctx.cur_item_offset + chunk_size == ctx.cur_item_size) {
 			err = writer->close(true);
 		}
+
+		if (!err && IS_ENABLED(CONFIG_DFU_MULTI_IMAGE_STATS)) {
+			struct image_stats *stats = image_stats(ctx.cur_image_no);
+			const int64_t now = stats_time();
+
+			stats->bytes_written += chunk_size;
+			stats->write_ticks += now - start;
+
+			if (stats->bytes_written == ctx.cur_item_size) {
+				stats->close_time = now;
+			}
+		}
 	}
 
 	if (err) {
@@ -254,3 +333,39 @@ int dfu_multi_image_done(bool success)
 
 	return err;
 }
+
+int dfu_multi_image_stats_get(size_t image_no, struct dfu_image_stats *stats)
+{
+	const struct image_stats *image;
+	int64_t close_time;
+
+	if (!IS_ENABLED(CONFIG_DFU_MULTI_IMAGE_STATS)) {
+		return -ENOTSUP;
+	}
+
+	if (stats == NULL) {
+		return -EINVAL;
+	}
+
+	if (image_no >= ctx.header.image_count) {
+		return -ENOENT;
+	}
+
+	image = image_stats(image_no);
+	close_time = image->close_time;
+
+	/* Report the time elapsed so far for the image being written */
+	if (image->bytes_written < ctx.header.images[image_no].size) {
+		close_time = stats_time();
+	}
+
+	stats->image_id = ctx.header.images[image_no].id;
+	stats->image_size = ctx.header.images[image_no].size;
+	stats->bytes_written = image->bytes_written;
+	stats->prepare_time_us = k_ticks_to_us_floor32(image->prepare_ticks);
+	stats->write_time_us = k_ticks_to_us_floor32(image->write_ticks);
+	stats->elapsed_time_us = (image->bytes_written > 0) ?
+				 k_ticks_to_us_floor32(close_time - image->open_time) : 0;
+
+	return 0;
+}
@@ -26,6 +26,10 @@ DEF_DFU_TARGET(modem_delta);
 #include "dfu/dfu_target_mcuboot.h"
 DEF_DFU_TARGET(mcuboot);
 #endif
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA
+#include "dfu/dfu_target_mcuboot_delta.h"
+DEF_DFU_TARGET(mcuboot_delta);
+#endif
 #ifdef CONFIG_DFU_TARGET_FULL_MODEM
 #include "dfu/dfu_target_full_modem.h"
 DEF_DFU_TARGET(full_modem);
@@ -56,6 +60,11 @@ enum dfu_target_image_type dfu_target_img_type(const void *const buf, size_t len
 		return DFU_TARGET_IMAGE_TYPE_MCUBOOT;
 	}
 #endif
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA
+	if (dfu_target_mcuboot_delta_identify(buf)) {
+		return DFU_TARGET_IMAGE_TYPE_MCUBOOT_DELTA;
+	}
+#endif
 #ifdef CONFIG_DFU_TARGET_MODEM_DELTA
 	if (dfu_target_modem_delta_identify(buf)) {
 		return DFU_TARGET_IMAGE_TYPE_MODEM_DELTA;
@@ -93,6 +102,16 @@ int dfu_target_init(int img_type, int img_num, size_t file_size, dfu_target_call
 		new_target = &dfu_target_mcuboot;
 	}
 #endif
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA
+	if (img_type == DFU_TARGET_IMAGE_TYPE_MCUBOOT_DELTA) {
+		new_target = &dfu_target_mcuboot_delta;
+	}
+#else
+	if (img_type == DFU_TARGET_IMAGE_TYPE_MCUBOOT_DELTA) {
+		LOG_ERR("MCUBoot delta patches are not supported");
+		return -ENOTSUP;
+	}
+#endif
 #ifdef CONFIG_DFU_TARGET_MODEM_DELTA
 	if (img_type == DFU_TARGET_IMAGE_TYPE_MODEM_DELTA) {
 		new_target = &dfu_target_modem_delta;
@@ -0,0 +1,560 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <dfu/dfu_target.h>
+#include <dfu/dfu_target_mcuboot.h>
+#include <dfu/dfu_target_mcuboot_delta.h>
+
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA_LZMA
+#include <nrf_compress/implementation.h>
+#endif
+
+LOG_MODULE_REGISTER(dfu_target_mcuboot_delta, CONFIG_DFU_TARGET_LOG_LEVEL);
+
+/* The patch is applied against the image running from the primary slot. */
+#define SOURCE_PARTITION_ID FIXED_PARTITION_ID(slot0_partition)
+#define TARGET_PARTITION_SIZE FIXED_PARTITION_SIZE(slot1_partition)
+
+enum patch_state {
+	STATE_HEADER,
+	STATE_DIFF_LEN,
+	STATE_DIFF,
+	STATE_EXTRA_LEN,
+	STATE_EXTRA,
+	STATE_ADJUST,
+	STATE_ERROR,
+};
+
+static struct {
+	enum patch_state state;
+	struct dfu_target_mcuboot_delta_header header;
+	/* Bytes of the header or of the record field being received. */
+	uint8_t field[sizeof(struct dfu_target_mcuboot_delta_header)];
+	size_t field_bytes;
+	/* Bytes left of the current diff or extra block. */
+	size_t remaining;
+	/* Offset within the source image of the next byte to patch. */
+	size_t source_offset;
+	/* Number of bytes of the target image produced so far. */
+	size_t target_bytes;
+	/* Number of patch bytes processed so far. */
+	size_t patch_bytes;
+	const struct flash_area *source;
+} ctx;
+
+static uint8_t work_buf[CONFIG_DFU_TARGET_MCUBOOT_DELTA_BUF_SIZE];
+
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA_LZMA
+static struct nrf_compress_implementation *decompressor;
+static uint8_t compressed_buf[2 * CONFIG_NRF_COMPRESS_CHUNK_SIZE];
+static size_t compressed_bytes;
+#endif
+
+bool dfu_target_mcuboot_delta_identify(const void *const buf)
+{
+	return sys_get_le32(buf) == DFU_TARGET_MCUBOOT_DELTA_MAGIC;
+}
+
+/**
+ * @brief Collect the bytes of a fixed size field which may be split across
+ *	  several writes.
+ *
+ * @return true when all @p size bytes of the field are in ctx.field.
+ */
+static bool field_collect(const uint8_t **data, size_t *len, size_t size)
+{
+	size_t chunk = MIN(*len, size - ctx.field_bytes);
+
+	memcpy(&ctx.field[ctx.field_bytes], *data, chunk);
+	ctx.field_bytes += chunk;
+	*data += chunk;
+	*len -= chunk;
+
+	if (ctx.field_bytes < size) {
+		return false;
+	}
+
+	ctx.field_bytes = 0;
+
+	return true;
+}
+
+static int target_write(const uint8_t *data, size_t len)
+{
+	int err;
+
+	if (len > ctx.header.target_size - ctx.target_bytes) {
+		LOG_ERR("Patch exceeds the target image size");
+		return -EINVAL;
+	}
+
+	err = dfu_target_mcuboot_write(data, len);
+	if (err != 0) {
+		return err;
+	}
+
+	ctx.target_bytes += len;
+
+	return 0;
+}
+
+static int diff_apply(const uint8_t *diff, size_t len)
+{
+	int err;
+
+	if (len > ctx.header.source_size - ctx.source_offset) {
+		LOG_ERR("Patch exceeds the source image size");
+		return -EINVAL;
+	}
+
+	while (len > 0) {
+		size_t chunk = MIN(len, sizeof(work_buf));
+
+		err = flash_area_read(ctx.source, ctx.source_offset, work_buf, chunk);
+		if (err != 0) {
+			LOG_ERR("Unable to read source image (err %d)", err);
+			return err;
+		}
+
+		for (size_t i = 0; i < chunk; i++) {
+			work_buf[i] += diff[i];
+		}
+
+		err = target_write(work_buf, chunk);
+		if (err != 0) {
+			return err;
+		}
+
+		ctx.source_offset += chunk;
+		diff += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
+
+static int source_adjust(int32_t adjust)
+{
+	int64_t offset = (int64_t)ctx.source_offset + adjust;
+
+	if (offset < 0 || offset > ctx.header.source_size) {
+		LOG_ERR("Invalid source offset adjustment %d", adjust);
+		return -EINVAL;
+	}
+
+	ctx.source_offset = offset;
+
+	return 0;
+}
+
+/**
+ * @brief Process the uncompressed patch payload.
+ */
+static int payload_process(const uint8_t *data, size_t len)
+{
+	int err = 0;
+	size_t chunk;
+
+	while (len > 0 && err == 0) {
+		switch (ctx.state) {
+		case STATE_DIFF_LEN:
+			if (field_collect(&data, &len, sizeof(uint32_t))) {
+				ctx.remaining = sys_get_le32(ctx.field);
+				ctx.state = ctx.remaining ? STATE_DIFF : STATE_EXTRA_LEN;
+			}
+			break;
+		case STATE_DIFF:
+			chunk = MIN(len, ctx.remaining);
+			err = diff_apply(data, chunk);
+			data += chunk;
+			len -= chunk;
+			ctx.remaining -= chunk;
+			if (ctx.remaining == 0) {
+				ctx.state = STATE_EXTRA_LEN;
+			}
+			break;
+		case STATE_EXTRA_LEN:
+			if (field_collect(&data, &len, sizeof(uint32_t))) {
+				ctx.remaining = sys_get_le32(ctx.field);
+				ctx.state = ctx.remaining ? STATE_EXTRA : STATE_ADJUST;
+			}
+			break;
+		case STATE_EXTRA:
+			chunk = MIN(len, ctx.remaining);
+			err = target_write(data, chunk);
+			data += chunk;
+			len -= chunk;
+			ctx.remaining -= chunk;
+			if (ctx.remaining == 0) {
+				ctx.state = STATE_ADJUST;
+			}
+			break;
+		case STATE_ADJUST:
+			if (field_collect(&data, &len, sizeof(int32_t))) {
+				err = source_adjust((int32_t)sys_get_le32(ctx.field));
+				ctx.state = STATE_DIFF_LEN;
+			}
+			break;
+		default:
+			err = -EINVAL;
+			break;
+		}
+	}
+
+	return err;
+}
+
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA_LZMA
+static int decompress_chunk(size_t len, bool last_part, uint32_t *consumed)
+{
+	int err;
+	uint8_t *output = NULL;
+	size_t output_size = 0;
+
+	*consumed = 0;
+
+	err = decompressor->decompress(NULL, compressed_buf, len, last_part, consumed,
+				       &output, &output_size);
+	if (err != 0) {
+		LOG_ERR("Decompression failed (err %d)", err);
+		return err;
+	}
+
+	if (*consumed > compressed_bytes) {
+		return -EINVAL;
+	}
+
+	compressed_bytes -= *consumed;
+	memmove(compressed_buf, &compressed_buf[*consumed], compressed_bytes);
+
+	if (output_size > 0) {
+		err = payload_process(output, output_size);
+	}
+
+	return err;
+}
+
+static int decompress_write(const uint8_t *data, size_t len)
+{
+	int err;
+	uint32_t consumed;
+
+	while (len > 0) {
+		size_t chunk = MIN(len, sizeof(compressed_buf) - compressed_bytes);
+
+		memcpy(&compressed_buf[compressed_bytes], data, chunk);
+		compressed_bytes += chunk;
+		data += chunk;
+		len -= chunk;
+
+		/* Keep some input back, so that the final call to the
+		 * decompressor, which flushes its output, has data to work on.
+		 */
+		while (compressed_bytes > decompressor->decompress_bytes_needed(NULL)) {
+			err = decompress_chunk(decompressor->decompress_bytes_needed(NULL),
+					       false, &consumed);
+			if (err != 0) {
+				return err;
+			}
+
+			if (consumed == 0) {
+				break;
+			}
+		}
+
+		if (compressed_bytes == sizeof(compressed_buf)) {
+			LOG_ERR("Decompressor does not consume input");
+			return -EINVAL;
+		}
+	}
+
+	return 0;
+}
+
+static int decompress_finish(void)
+{
+	int err;
+	uint32_t consumed;
+
+	while (compressed_bytes > 0) {
+		err = decompress_chunk(compressed_bytes, true, &consumed);
+		if (err != 0) {
+			return err;
+		}
+
+		if (consumed == 0) {
+			return -EINVAL;
+		}
+	}
+
+	return 0;
+}
+
+static void decompress_release(void)
+{
+	if (decompressor != NULL) {
+		(void)decompressor->deinit(NULL);
+		decompressor = NULL;
+	}
+
+	compressed_bytes = 0;
+}
+#endif /* CONFIG_DFU_TARGET_MCUBOOT_DELTA_LZMA */
+
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA_VERIFY_SOURCE
+static int source_verify(void)
+{
+	int err;
+	uint32_t crc = 0;
+
+	for (size_t offset = 0; offset < ctx.header.source_size; offset += sizeof(work_buf)) {
+		size_t len = MIN(sizeof(work_buf), ctx.header.source_size - offset);
+
+		err = flash_area_read(ctx.source, offset, work_buf, len);
+		if (err != 0) {
+			LOG_ERR("Unable to read source image (err %d)", err);
+			return err;
+		}
+
+		crc = crc32_ieee_update(crc, work_buf, len);
+	}
+
+	if (crc != ctx.header.source_crc) {
+		LOG_ERR("Patch does not apply to the running image");
+		return -EINVAL;
+	}
+
+	return 0;
+}
+#endif
+
+static int header_parse(void)
+{
+	const uint8_t *field = ctx.field;
+
+	ctx.header.magic = sys_get_le32(&field[0]);
+	ctx.header.version = field[4];
+	ctx.header.compression = field[5];
+	ctx.header.reserved = sys_get_le16(&field[6]);
+	ctx.header.source_size = sys_get_le32(&field[8]);
+	ctx.header.source_crc = sys_get_le32(&field[12]);
+	ctx.header.target_size = sys_get_le32(&field[16]);
+
+	if (ctx.header.magic != DFU_TARGET_MCUBOOT_DELTA_MAGIC ||
+	    ctx.header.version != DFU_TARGET_MCUBOOT_DELTA_VERSION) {
+		LOG_ERR("Unsupported patch format");
+		return -ENOTSUP;
+	}
+
+	if (ctx.header.source_size > ctx.source->fa_size ||
+	    ctx.header.target_size > TARGET_PARTITION_SIZE) {
+		LOG_ERR("Patch image sizes do not fit the slots");
+		return -EFBIG;
+	}
+
+	switch (ctx.header.compression) {
+	case DFU_TARGET_MCUBOOT_DELTA_COMPRESSION_NONE:
+		break;
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA_LZMA
+	case DFU_TARGET_MCUBOOT_DELTA_COMPRESSION_LZMA2: {
+		int err;
+
+		decompressor = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZMA);
+		if (decompressor == NULL) {
+			return -ENOTSUP;
+		}
+
+		err = decompressor->init(NULL);
+		if (err != 0) {
+			LOG_ERR("Unable to initialize decompressor (err %d)", err);
+			decompressor = NULL;
+			return err;
+		}
+		break;
+	}
+#endif
+	default:
+		LOG_ERR("Unsupported patch compression %d", ctx.header.compression);
+		return -ENOTSUP;
+	}
+
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA_VERIFY_SOURCE
+	return source_verify();
+#else
+	return 0;
+#endif
+}
+
+static void source_close(void)
+{
+	if (ctx.source != NULL) {
+		flash_area_close(ctx.source);
+		ctx.source = NULL;
+	}
+}
+
+static void state_reset(void)
+{
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA_LZMA
+	decompress_release();
+#endif
+	ctx.state = STATE_HEADER;
+	ctx.field_bytes = 0;
+	ctx.remaining = 0;
+	ctx.source_offset = 0;
+	ctx.target_bytes = 0;
+	ctx.patch_bytes = 0;
+}
+
+int dfu_target_mcuboot_delta_init(size_t file_size, int img_num, dfu_target_callback_t cb)
+{
+	int err;
+	size_t offset;
+
+	if (img_num != 0) {
+		LOG_ERR("Delta updates are only supported for image 0");
+		return -ENOTSUP;
+	}
+
+	/* The decompressor and patch state cannot be restored, so every
+	 * download starts from the beginning of the patch.
+	 */
+	state_reset();
+
+	if (ctx.source == NULL) {
+		err = flash_area_open(SOURCE_PARTITION_ID, &ctx.source);
+		if (err != 0) {
+			LOG_ERR("Unable to open source slot (err %d)", err);
+			return err;
+		}
+	}
+
+	/* The size of the resulting image is only known from the patch
+	 * header, it is checked against the slot size once received.
+	 */
+	err = dfu_target_mcuboot_init(0, img_num, cb);
+	if (err != 0) {
+		source_close();
+		return err;
+	}
+
+	/* Progress stored by the MCUBoot target from an earlier download
+	 * cannot be continued either.
+	 */
+	err = dfu_target_mcuboot_offset_get(&offset);
+	if (err == 0 && offset != 0) {
+		err = dfu_target_mcuboot_reset();
+		if (err == 0) {
+			err = dfu_target_mcuboot_init(0, img_num, cb);
+		}
+	}
+
+	if (err != 0) {
+		source_close();
+	}
+
+	return err;
+}
+
+int dfu_target_mcuboot_delta_offset_get(size_t *out)
+{
+	*out = ctx.patch_bytes;
+
+	return 0;
+}
+
+int dfu_target_mcuboot_delta_write(const void *const buf, size_t len)
+{
+	int err = 0;
+	const uint8_t *data = buf;
+	size_t data_len = len;
+
+	if (ctx.state == STATE_ERROR || ctx.source == NULL) {
+		return -EINVAL;
+	}
+
+	if (ctx.state == STATE_HEADER) {
+		if (!field_collect(&data, &data_len, sizeof(ctx.header))) {
+			ctx.patch_bytes += len;
+			return 0;
+		}
+
+		err = header_parse();
+		ctx.state = STATE_DIFF_LEN;
+	}
+
+	if (err == 0 && data_len > 0) {
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA_LZMA
+		if (decompressor != NULL) {
+			err = decompress_write(data, data_len);
+		} else {
+			err = payload_process(data, data_len);
+		}
+#else
+		err = payload_process(data, data_len);
+#endif
+	}
+
+	if (err != 0) {
+		/* The patch cannot be continued, the target must be reset. */
+		ctx.state = STATE_ERROR;
+		return err;
+	}
+
+	ctx.patch_bytes += len;
+
+	return 0;
+}
+
+int dfu_target_mcuboot_delta_done(bool successful)
+{
+	int err = 0;
+
+	if (successful) {
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA_LZMA
+		if (decompressor != NULL && ctx.state != STATE_ERROR) {
+			err = decompress_finish();
+		}
+#endif
+		if (err == 0 && (ctx.state != STATE_DIFF_LEN || ctx.field_bytes != 0 ||
+				 ctx.target_bytes != ctx.header.target_size)) {
+			LOG_ERR("Incomplete patch, %zu of %u bytes produced",
+				ctx.target_bytes, ctx.header.target_size);
+			err = -EINVAL;
+		}
+
+		if (err != 0) {
+			ctx.state = STATE_ERROR;
+			source_close();
+			(void)dfu_target_mcuboot_done(false);
+			return err;
+		}
+	}
+
+	state_reset();
+	source_close();
+
+	return dfu_target_mcuboot_done(successful);
+}
+
+int dfu_target_mcuboot_delta_schedule_update(int img_num)
+{
+	return dfu_target_mcuboot_schedule_update(img_num);
+}
+
+int dfu_target_mcuboot_delta_reset(void)
+{
+	state_reset();
+	source_close();
+
+	return dfu_target_mcuboot_reset();
+}
@@ -7,7 +7,9 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/storage/stream_flash.h>
+#include <zephyr/drivers/flash.h>
 #include <stdio.h>
+#include <string.h>
 #include <dfu/dfu_target_stream.h>
 #include <dfu_stream_flatten.h>
 
@@ -17,11 +19,242 @@
 #include <zephyr/settings/settings.h>
 #endif /* CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS */
 
+#ifdef CONFIG_DFU_TARGET_STREAM_HASH
+#include <psa/crypto.h>
+#endif /* CONFIG_DFU_TARGET_STREAM_HASH */
+
+/* Chunk size used when reading back flash contents for hashing or comparing. */
+#define FLASH_READ_CHUNK 64
+
 LOG_MODULE_REGISTER(dfu_target_stream, CONFIG_DFU_TARGET_LOG_LEVEL);
 
 static struct stream_flash_ctx stream;
 static const char *current_id;
 
+#ifdef CONFIG_DFU_TARGET_STREAM_HASH
+static psa_hash_operation_t hash_op;
+static bool hash_active;
+static bool hash_ready;
+static uint8_t hash_digest[DFU_TARGET_STREAM_HASH_SIZE];
+
+static void hash_abort(void)
+{
+	if (hash_active) {
+		(void)psa_hash_abort(&hash_op);
+		hash_active = false;
+	}
+}
+
+/**
+ * @brief Start hashing the stream. The part of the image which is already
+ *	  in flash, in case a download is resumed, is read back and hashed.
+ */
+static int hash_start(void)
+{
+	psa_status_t status;
+	uint8_t chunk[FLASH_READ_CHUNK];
+	size_t written = stream_flash_bytes_written(&stream);
+
+	hash_abort();
+	hash_ready = false;
+
+	status = psa_crypto_init();
+	if (status != PSA_SUCCESS) {
+		LOG_ERR("psa_crypto_init failed (err %d)", status);
+		return -EIO;
+	}
+
+	hash_op = psa_hash_operation_init();
+	status = psa_hash_setup(&hash_op, PSA_ALG_SHA_256);
+	if (status != PSA_SUCCESS) {
+		LOG_ERR("psa_hash_setup failed (err %d)", status);
+		return -EIO;
+	}
+
+	hash_active = true;
+
+	for (size_t pos = 0; pos < written; pos += sizeof(chunk)) {
+		size_t len = MIN(sizeof(chunk), written - pos);
+		int err = flash_read(stream.fdev, stream.offset + pos, chunk, len);
+
+		if (err != 0) {
+			LOG_ERR("Unable to read back written data (err %d)", err);
+			hash_abort();
+			return err;
+		}
+
+		status = psa_hash_update(&hash_op, chunk, len);
+		if (status != PSA_SUCCESS) {
+			LOG_ERR("psa_hash_update failed (err %d)", status);
+			hash_abort();
+			return -EIO;
+		}
+	}
+
+	return 0;
+}
+
+static void hash_update(const uint8_t *buf, size_t len)
+{
+	if (!hash_active || len == 0) {
+		return;
+	}
+
+	if (psa_hash_update(&hash_op, buf, len) != PSA_SUCCESS) {
+		/* The digest can no longer be trusted, but the download itself
+		 * is not affected.
+		 */
+		LOG_WRN("Unable to hash stream data, digest will be unavailable");
+		hash_abort();
+	}
+}
+
+static void hash_finish(void)
+{
+	size_t hash_len;
+	psa_status_t status;
+
+	if (!hash_active) {
+		return;
+	}
+
+	status = psa_hash_finish(&hash_op, hash_digest, sizeof(hash_digest), &hash_len);
+	hash_active = false;
+	if (status != PSA_SUCCESS) {
+		LOG_ERR("psa_hash_finish failed (err %d)", status);
+		return;
+	}
+
+	hash_ready = true;
+}
+#endif /* CONFIG_DFU_TARGET_STREAM_HASH */
+
+#ifdef CONFIG_DFU_TARGET_STREAM_SKIP_UNCHANGED
+/* The flash page currently being received. A page is staged in RAM only if
+ * it is received in full from its start, otherwise the data is passed
+ * directly to stream_flash.
+ */
+static struct {
+	uint8_t buf[CONFIG_DFU_TARGET_STREAM_SKIP_UNCHANGED_BUF_SIZE];
+	size_t len;
+	size_t received;
+	bool staged;
+	size_t skipped;
+} page;
+
+static int page_open(void)
+{
+	int err;
+	struct flash_pages_info info;
+	size_t pos = stream.offset + stream.bytes_written + stream.buf_bytes;
+	size_t end = stream.offset + stream.available;
+
+	if (pos >= end) {
+		return -ENOMEM;
+	}
+
+	err = flash_get_page_info_by_offs(stream.fdev, pos, &info);
+	if (err != 0) {
+		LOG_ERR("Error %d while getting page info", err);
+		return err;
+	}
+
+	page.len = MIN(info.start_offset + info.size, end) - pos;
+	page.received = 0;
+	page.staged = pos == info.start_offset && page.len == info.size &&
+		      stream.buf_bytes == 0 && info.size <= sizeof(page.buf);
+
+	return 0;
+}
+
+static bool page_unchanged(void)
+{
+	uint8_t chunk[FLASH_READ_CHUNK];
+	size_t pos = stream.offset + stream.bytes_written;
+
+	for (size_t i = 0; i < page.len; i += sizeof(chunk)) {
+		size_t len = MIN(sizeof(chunk), page.len - i);
+
+		if (flash_read(stream.fdev, pos + i, chunk, len) != 0 ||
+		    memcmp(chunk, &page.buf[i], len) != 0) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief Finish the current page. A complete staged page which matches the
+ *	  flash contents is skipped, any other data is flushed to flash.
+ */
+static int page_close(void)
+{
+	int err;
+
+	if (page.staged && page.received == page.len && page_unchanged()) {
+		stream.bytes_written += page.len;
+		page.skipped++;
+		err = 0;
+	} else if (page.staged) {
+		err = stream_flash_buffered_write(&stream, page.buf, page.received, true);
+	} else {
+		err = stream_flash_buffered_write(&stream, NULL, 0, true);
+	}
+
+	page.len = 0;
+	page.received = 0;
+
+	return err;
+}
+
+static int page_write(const uint8_t *buf, size_t len)
+{
+	int err;
+
+	while (len > 0) {
+		size_t chunk;
+
+		if (page.len == 0) {
+			err = page_open();
+			if (err != 0) {
+				return err;
+			}
+		}
+
+		chunk = MIN(len, page.len - page.received);
+
+		if (page.staged) {
+			memcpy(&page.buf[page.received], buf, chunk);
+		} else {
+			err = stream_flash_buffered_write(&stream, buf, chunk, false);
+			if (err != 0) {
+				return err;
+			}
+		}
+
+		page.received += chunk;
+		buf += chunk;
+		len -= chunk;
+
+		if (page.received == page.len) {
+			err = page_close();
+			if (err != 0) {
+				return err;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static void page_discard(void)
+{
+	page.len = 0;
+	page.received = 0;
+}
+#endif /* CONFIG_DFU_TARGET_STREAM_SKIP_UNCHANGED */
+
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
 
 static char current_name_key[32];
@@ -152,6 +385,19 @@ int dfu_target_stream_init(const struct dfu_target_stream_init *init)
 	}
 #endif /* CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS */
 
+#ifdef CONFIG_DFU_TARGET_STREAM_SKIP_UNCHANGED
+	page_discard();
+	page.skipped = 0;
+#endif
+
+#ifdef CONFIG_DFU_TARGET_STREAM_HASH
+	err = hash_start();
+	if (err) {
+		/* The download can proceed, only the digest is unavailable. */
+		LOG_WRN("Unable to start hashing the stream (err %d)", err);
+	}
+#endif
+
 	return 0;
 }
 
@@ -164,13 +410,27 @@ int dfu_target_stream_offset_get(size_t *out)
 
 int dfu_target_stream_write(const uint8_t *buf, size_t len)
 {
+#ifdef CONFIG_DFU_TARGET_STREAM_SKIP_UNCHANGED
+	int err = page_write(buf, len);
+#else
 	int err = stream_flash_buffered_write(&stream, buf, len, false);
+#endif
 
 	if (err != 0) {
 		LOG_ERR("stream_flash_buffered_write error %d", err);
+#ifdef CONFIG_DFU_TARGET_STREAM_HASH
+		/* Part of the data may have been written, the digest would
+		 * no longer match the stream.
+		 */
+		hash_abort();
+#endif
 		return err;
 	}
 
+#ifdef CONFIG_DFU_TARGET_STREAM_HASH
+	hash_update(buf, len);
+#endif
+
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
 	err = store_progress();
 	if (err != 0) {
@@ -189,10 +449,26 @@ int dfu_target_stream_done(bool successful)
 	int err = 0;
 
 	if (successful) {
+#ifdef CONFIG_DFU_TARGET_STREAM_SKIP_UNCHANGED
+		if (page.len != 0) {
+			err = page_close();
+		}
+		if (err == 0) {
+			err = stream_flash_buffered_write(&stream, NULL, 0, true);
+		}
+#else
 		err = stream_flash_buffered_write(&stream, NULL, 0, true);
+#endif
 		if (err != 0) {
 			LOG_ERR("stream_flash_buffered_write error %d", err);
 		}
+#ifdef CONFIG_DFU_TARGET_STREAM_HASH
+		if (err == 0) {
+			hash_finish();
+		} else {
+			hash_abort();
+		}
+#endif
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
 		/* Delete state so that a new call to 'init' will
 		 * start with offset 0.
@@ -213,6 +489,18 @@ int dfu_target_stream_done(bool successful)
 #endif
 	}
 
+	if (!successful) {
+		/* Data which has not reached flash yet is downloaded again
+		 * when the stream is resumed.
+		 */
+#ifdef CONFIG_DFU_TARGET_STREAM_SKIP_UNCHANGED
+		page_discard();
+#endif
+#ifdef CONFIG_DFU_TARGET_STREAM_HASH
+		hash_abort();
+#endif
+	}
+
 	current_id = NULL;
 
 	return err;
@@ -225,6 +513,14 @@ int dfu_target_stream_reset(void)
 	stream.buf_bytes = 0;
 	stream.bytes_written = 0;
 
+#ifdef CONFIG_DFU_TARGET_STREAM_SKIP_UNCHANGED
+	page_discard();
+#endif
+#ifdef CONFIG_DFU_TARGET_STREAM_HASH
+	hash_abort();
+	hash_ready = false;
+#endif
+
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
 	err = settings_delete(current_name_key);
 	if (err != 0) {
@@ -246,3 +542,34 @@ int dfu_target_stream_reset(void)
 
 	return err;
 }
+
+int dfu_target_stream_hash_get(uint8_t *hash, size_t hash_len)
+{
+#ifdef CONFIG_DFU_TARGET_STREAM_HASH
+	if (hash == NULL || hash_len < sizeof(hash_digest)) {
+		return -ENOMEM;
+	}
+
+	if (!hash_ready) {
+		return -ENODATA;
+	}
+
+	memcpy(hash, hash_digest, sizeof(hash_digest));
+
+	return 0;
+#else
+	ARG_UNUSED(hash);
+	ARG_UNUSED(hash_len);
+
+	return -ENOTSUP;
+#endif
+}
+
+size_t dfu_target_stream_skipped_pages_get(void)
+{
+#ifdef CONFIG_DFU_TARGET_STREAM_SKIP_UNCHANGED
+	return page.skipped;
+#else
+	return 0;
+#endif
+}
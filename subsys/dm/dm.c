@@ -330,6 +330,7 @@ static int timeslot_request(uint32_t distance_from_last)
 static void dm_start_ranging(void)
 {
 	struct timeslot_request *req;
+	size_t missed;
 	int err;
 
 	k_mutex_lock(&ranging_mtx, K_FOREVER);
@@ -349,6 +350,11 @@ static void dm_start_ranging(void)
 		goto out;
 	}
 
+	missed = timeslot_queue_expire(time_now());
+	if (missed) {
+		LOG_DBG("%zu timeslots missed", missed);
+	}
+
 	req = timeslot_queue_peek();
 	if (!req) {
 		goto out;
@@ -357,7 +363,8 @@ static void dm_start_ranging(void)
 	memcpy(&timeslot_ctx.curr_req, req, sizeof(timeslot_ctx.curr_req));
 	timeslot_queue_remove_first();
 
-	uint32_t distance = time_distance_get(timeslot_ctx.last_start, req->start_time);
+	uint32_t distance = time_distance_get(timeslot_ctx.last_start,
+					      timeslot_ctx.curr_req.start_time);
 
 	atomic_set(&timeslot_ctx.state, TIMESLOT_STATE_PENDING);
 	err = timeslot_request(TICKS_TO_US(distance));
@@ -440,6 +447,8 @@ static void dm_thread(void)
 				dm_start_ranging();
 				break;
 			case TIMESLOT_NORMAL_END:
+				timeslot_queue_result_report(&timeslot_ctx.curr_req.dm_req.bt_addr,
+					dm_context.nrf_dm_status == NRF_DM_STATUS_SUCCESS);
 				dm_reschedule();
 				if (dm_context.nrf_dm_status == NRF_DM_STATUS_SUCCESS) {
 					calculation();
@@ -486,6 +495,14 @@ int dm_request_add(struct dm_request *req)
 	return err;
 }
 
+int dm_peer_stats_get(const bt_addr_le_t *bt_addr, struct dm_peer_stats *stats)
+{
+	if (!bt_addr || !stats) {
+		return -EINVAL;
+	}
+
+	return timeslot_queue_peer_stats_get(bt_addr, stats);
+}
 
 int dm_init(struct dm_init_param *init_param)
 {
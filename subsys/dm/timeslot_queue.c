@@ -10,19 +10,50 @@
 
 #define TIMESLOT_QUEUE_LENGTH            CONFIG_DM_TIMESLOT_QUEUE_LENGTH
 #define TIMESLOT_QUEUE_COUNT_SAME_PEER   CONFIG_DM_TIMESLOT_QUEUE_COUNT_SAME_PEER
+#define TIMESLOT_PEER_COUNT              CONFIG_DM_TIMESLOT_PEER_COUNT
+#define PEER_MIN_INTERVAL_MS             CONFIG_DM_TIMESLOT_PEER_MIN_INTERVAL_MS
 
 #define MIN_TIME_BETWEEN_TIMESLOTS_US    CONFIG_DM_MIN_TIME_BETWEEN_TIMESLOTS_US
 #define RANGING_OFFSET_US                CONFIG_DM_RANGING_OFFSET_US
 
-static K_MUTEX_DEFINE(list_mtx);
-static sys_slist_t timeslot_list = SYS_SLIST_STATIC_INIT(&timeslot_list);
+/* Two time ticks can be ordered if they are less than half of the counter range apart. */
+#define TIME_HALF_RANGE                  (RTC_COUNTER_MAX / 2)
+/* Time after which the start time of the last timeslot of a peer is no longer comparable. */
+#define PEER_LAST_START_VALID_MS         (TICKS_TO_US(TIME_HALF_RANGE / 2) / USEC_PER_MSEC)
+
+struct timeslot_peer {
+	struct dm_peer_stats stats;
+
+	/* Number of timeslots of the peer in the queue */
+	uint8_t queued;
+
+	/* Start time of the last timeslot scheduled for the peer */
+	uint32_t last_start;
+
+	/* Uptime when the last timeslot was scheduled */
+	uint32_t last_scheduled_ms;
+
+	/* Uptime of the first and the last successful ranging */
+	uint32_t first_completed_ms;
+	uint32_t last_completed_ms;
+};
 
 struct timeslot_entry {
 	struct timeslot_request timeslot_req;
+	struct timeslot_peer *peer;
 	sys_snode_t node;
 };
 
-static K_HEAP_DEFINE(heap, TIMESLOT_QUEUE_LENGTH * sizeof(struct timeslot_entry));
+static K_MUTEX_DEFINE(list_mtx);
+
+/* Scheduled timeslots, ordered by the start time */
+static sys_slist_t timeslot_list = SYS_SLIST_STATIC_INIT(&timeslot_list);
+static sys_slist_t free_list = SYS_SLIST_STATIC_INIT(&free_list);
+static struct timeslot_entry entries[TIMESLOT_QUEUE_LENGTH];
+static bool entries_initialized;
+
+static struct timeslot_peer peers[TIMESLOT_PEER_COUNT];
+static size_t peer_count;
 
 static void list_lock(void)
 {
@@ -34,89 +65,185 @@ static void list_unlock(void)
 	k_mutex_unlock(&list_mtx);
 }
 
-static size_t get_list_size(void)
+static void queue_reset(void)
 {
-	size_t ret = 0;
-	sys_snode_t *node, *tmp;
+	sys_slist_init(&timeslot_list);
+	sys_slist_init(&free_list);
 
-	SYS_SLIST_FOR_EACH_NODE_SAFE(&timeslot_list, node, tmp) {
-		ret++;
+	for (size_t i = 0; i < ARRAY_SIZE(entries); i++) {
+		sys_slist_append(&free_list, &entries[i].node);
 	}
 
-	return ret;
+	memset(peers, 0, sizeof(peers));
+	peer_count = 0;
+	entries_initialized = true;
 }
 
-static bool is_request_exist(struct dm_request *req)
+static bool time_before(uint32_t t1, uint32_t t2)
 {
-	uint8_t cnt = 0;
-	sys_snode_t *node, *tmp;
-	struct timeslot_entry *item;
+	uint32_t distance = time_distance_get(t1, t2);
+
+	return (distance != 0) && (distance < TIME_HALF_RANGE);
+}
+
+static bool timeslot_gap_fits(uint32_t start_time, uint32_t length_us, uint32_t next_start_time)
+{
+	return time_distance_get(start_time, next_start_time) >=
+	       US_TO_RTC_TICKS(length_us + MIN_TIME_BETWEEN_TIMESLOTS_US);
+}
+
+static struct timeslot_peer *peer_find(const bt_addr_le_t *bt_addr)
+{
+	for (size_t i = 0; i < peer_count; i++) {
+		if (bt_addr_le_eq(&peers[i].stats.bt_addr, bt_addr)) {
+			return &peers[i];
+		}
+	}
+
+	return NULL;
+}
 
-	SYS_SLIST_FOR_EACH_NODE_SAFE(&timeslot_list, node, tmp) {
-		item = CONTAINER_OF(node, struct timeslot_entry, node);
-		if (bt_addr_le_cmp(&item->timeslot_req.dm_req.bt_addr, &req->bt_addr) == 0) {
-			cnt++;
+static struct timeslot_peer *peer_get(const bt_addr_le_t *bt_addr)
+{
+	struct timeslot_peer *peer = peer_find(bt_addr);
+
+	if (peer) {
+		return peer;
+	}
+
+	if (peer_count < ARRAY_SIZE(peers)) {
+		peer = &peers[peer_count++];
+	} else {
+		/* Reuse the peer without scheduled timeslots that was scheduled the longest ago. */
+		uint32_t now_ms = k_uptime_get_32();
+
+		for (size_t i = 0; i < ARRAY_SIZE(peers); i++) {
+			if (peers[i].queued != 0) {
+				continue;
+			}
+
+			if (!peer || ((now_ms - peers[i].last_scheduled_ms) >
+				      (now_ms - peer->last_scheduled_ms))) {
+				peer = &peers[i];
+			}
+		}
+
+		if (!peer) {
+			return NULL;
 		}
 	}
 
-	return cnt >= TIMESLOT_QUEUE_COUNT_SAME_PEER;
+	memset(peer, 0, sizeof(*peer));
+	bt_addr_le_copy(&peer->stats.bt_addr, bt_addr);
+
+	return peer;
+}
+
+static bool peer_rate_allowed(const struct timeslot_peer *peer, uint32_t start_time)
+{
+	if ((PEER_MIN_INTERVAL_MS == 0) || (peer->stats.scheduled == 0)) {
+		return true;
+	}
+
+	if ((k_uptime_get_32() - peer->last_scheduled_ms) >= PEER_LAST_START_VALID_MS) {
+		return true;
+	}
+
+	if (time_before(start_time, peer->last_start)) {
+		return false;
+	}
+
+	return time_distance_get(peer->last_start, start_time) >=
+	       US_TO_RTC_TICKS(PEER_MIN_INTERVAL_MS * USEC_PER_MSEC);
+}
+
+static void entry_free(struct timeslot_entry *item)
+{
+	item->peer->queued--;
+	sys_slist_prepend(&free_list, &item->node);
 }
 
 int timeslot_queue_append(struct dm_request *req, uint32_t start_ref_tick,
 			  uint32_t window_len_us, uint32_t timeslot_len_us)
 {
+	int err = 0;
 	uint32_t start_time;
 	uint32_t delay;
-	size_t list_size;
-	struct timeslot_entry *last, *item;
+	struct timeslot_peer *peer;
+	struct timeslot_entry *prev = NULL;
+	struct timeslot_entry *next = NULL;
+	struct timeslot_entry *item;
 
 	delay = req->start_delay_us + RANGING_OFFSET_US;
 	start_time = (start_ref_tick + US_TO_RTC_TICKS(delay)) % RTC_COUNTER_MAX;
 
-	list_size = get_list_size();
-	if (list_size >= TIMESLOT_QUEUE_LENGTH) {
-		return -ENOMEM;
+	list_lock();
+
+	if (!entries_initialized) {
+		queue_reset();
 	}
 
-	if (list_size != 0) {
-		if (is_request_exist(req)) {
-			return -EAGAIN;
-		}
+	peer = peer_get(&req->bt_addr);
+	if (!peer) {
+		err = -ENOMEM;
+		goto out;
+	}
 
-		/* Check that the new timeslot does not overlap with a previous one.
-		 * Timeslots are added with a fixed distance from "now" and are therefore
-		 * always appended to the end of the queue. This means that we only
-		 * need to check that the start of the new timeslot does not fall into
-		 * the last timeslot in the queue.
-		 */
-		list_lock();
-		last = SYS_SLIST_PEEK_TAIL_CONTAINER(&timeslot_list, last, node);
-		list_unlock();
-
-		if (start_time < last->timeslot_req.start_time +
-					 US_TO_RTC_TICKS(last->timeslot_req.timeslot_length_us +
-							 MIN_TIME_BETWEEN_TIMESLOTS_US)) {
-			return -EBUSY;
+	if (sys_slist_is_empty(&free_list)) {
+		err = -ENOMEM;
+		goto rejected;
+	}
+
+	if ((peer->queued >= TIMESLOT_QUEUE_COUNT_SAME_PEER) ||
+	    !peer_rate_allowed(peer, start_time)) {
+		err = -EAGAIN;
+		goto rejected;
+	}
+
+	/* Find the gap the new timeslot falls into. The timeslot must not overlap
+	 * with the previous and the next one, but it does not have to be the last one.
+	 */
+	SYS_SLIST_FOR_EACH_CONTAINER(&timeslot_list, item, node) {
+		if (time_before(start_time, item->timeslot_req.start_time)) {
+			next = item;
+			break;
 		}
+
+		prev = item;
 	}
 
-	item = k_heap_alloc(&heap, sizeof(struct timeslot_entry), K_NO_WAIT);
-	if (!item) {
-		return -ENOMEM;
+	if ((prev && !timeslot_gap_fits(prev->timeslot_req.start_time,
+					prev->timeslot_req.timeslot_length_us, start_time)) ||
+	    (next && !timeslot_gap_fits(start_time, timeslot_len_us,
+					next->timeslot_req.start_time))) {
+		err = -EBUSY;
+		goto rejected;
 	}
 
+	item = CONTAINER_OF(sys_slist_get_not_empty(&free_list), struct timeslot_entry, node);
+
 	item->timeslot_req.start_time = start_time;
 	item->timeslot_req.timeslot_length_us = timeslot_len_us;
 	item->timeslot_req.window_length_us = window_len_us;
+	item->peer = peer;
 	req->rng_seed++;
 
 	memcpy(&item->timeslot_req.dm_req, req, sizeof(item->timeslot_req.dm_req));
 
-	list_lock();
-	sys_slist_append(&timeslot_list, &item->node);
+	sys_slist_insert(&timeslot_list, prev ? &prev->node : NULL, &item->node);
+
+	peer->queued++;
+	peer->last_start = start_time;
+	peer->last_scheduled_ms = k_uptime_get_32();
+	peer->stats.scheduled++;
+	goto out;
+
+rejected:
+	peer->stats.rejected++;
+out:
 	list_unlock();
 
-	return 0;
+	return err;
 }
 
 struct timeslot_request *timeslot_queue_peek(void)
@@ -137,16 +264,89 @@ struct timeslot_request *timeslot_queue_peek(void)
 void timeslot_queue_remove_first(void)
 {
 	sys_snode_t *node;
-	struct timeslot_entry *item;
 
 	list_lock();
 	node = sys_slist_get(&timeslot_list);
+	if (node) {
+		entry_free(CONTAINER_OF(node, struct timeslot_entry, node));
+	}
+	list_unlock();
+}
+
+size_t timeslot_queue_expire(uint32_t now)
+{
+	size_t cnt = 0;
+	struct timeslot_entry *item;
+
+	list_lock();
+
+	while ((item = SYS_SLIST_PEEK_HEAD_CONTAINER(&timeslot_list, item, node)) != NULL) {
+		if (!time_before(item->timeslot_req.start_time, now)) {
+			break;
+		}
+
+		(void)sys_slist_get_not_empty(&timeslot_list);
+		item->peer->stats.missed++;
+		entry_free(item);
+		cnt++;
+	}
+
 	list_unlock();
 
-	if (!node) {
-		return;
+	return cnt;
+}
+
+void timeslot_queue_result_report(const bt_addr_le_t *bt_addr, bool success)
+{
+	struct timeslot_peer *peer;
+
+	list_lock();
+
+	peer = peer_find(bt_addr);
+	if (peer) {
+		if (success) {
+			peer->last_completed_ms = k_uptime_get_32();
+			if (peer->stats.completed == 0) {
+				peer->first_completed_ms = peer->last_completed_ms;
+			}
+			peer->stats.completed++;
+		} else {
+			peer->stats.failed++;
+		}
+	}
+
+	list_unlock();
+}
+
+int timeslot_queue_peer_stats_get(const bt_addr_le_t *bt_addr, struct dm_peer_stats *stats)
+{
+	struct timeslot_peer *peer;
+	uint32_t elapsed_ms;
+
+	list_lock();
+
+	peer = peer_find(bt_addr);
+	if (peer) {
+		*stats = peer->stats;
+
+		/* Rate of the successful rangings between the first and the last one. */
+		elapsed_ms = peer->last_completed_ms - peer->first_completed_ms;
+		if ((stats->completed > 1) && (elapsed_ms > 0)) {
+			stats->rate_mhz = ((uint64_t)(stats->completed - 1) * MSEC_PER_SEC *
+					   MSEC_PER_SEC) / elapsed_ms;
+		} else {
+			stats->rate_mhz = 0;
+		}
 	}
 
-	item = CONTAINER_OF(node, struct timeslot_entry, node);
-	k_heap_free(&heap, item);
+	list_unlock();
+
+	return peer ? 0 : -ENOENT;
+}
+
+void timeslot_queue_reset(void)
+{
+	list_lock();
+	queue_reset();
+	list_unlock();
 }
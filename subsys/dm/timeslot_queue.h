@@ -29,7 +29,11 @@ struct timeslot_request {
 	uint32_t window_length_us;
 };
 
-/** @brief Append an element to the end of a queue.
+/** @brief Schedule a timeslot.
+ *
+ *  The queue is ordered by the start time of the timeslots, so the timeslot with the earliest
+ *  start time is always at the head. A new timeslot can be placed in any gap between
+ *  the already scheduled timeslots that is long enough to hold it.
  *
  *  @param req Address of the structure with request parameters.
  *  @param start_ref_tick Reference start time tick.
@@ -37,7 +41,8 @@ struct timeslot_request {
  *  @param timeslot_len Timeslot length.
  *
  *  @retval -ENOMEM when the tiemslot queue is full or a memory allocation error.
- *  @retval -EAGAIN when a single peer has a maximum number of timeslots scheduled.
+ *  @retval -EAGAIN when a single peer has a maximum number of timeslots scheduled,
+ *                  or the peer was ranged too recently.
  *  @retval -EBUSY when the timeslot cannot be scheduled due to time restrictions.
  */
 int timeslot_queue_append(struct dm_request *req, uint32_t start_ref_tick,
@@ -57,6 +62,39 @@ struct timeslot_request *timeslot_queue_peek(void);
  */
 void timeslot_queue_remove_first(void);
 
+/** @brief Remove the timeslots that start before the given time.
+ *
+ *  The removed timeslots are counted as missed in the peer statistics.
+ *
+ *  @param now Current time tick.
+ *
+ *  @retval Number of removed timeslots.
+ */
+size_t timeslot_queue_expire(uint32_t now);
+
+/** @brief Report the result of a ranging.
+ *
+ *  @param bt_addr Address of the peer.
+ *  @param success True if the ranging was successful.
+ */
+void timeslot_queue_result_report(const bt_addr_le_t *bt_addr, bool success);
+
+/** @brief Get the statistics of a peer.
+ *
+ *  @param bt_addr Address of the peer.
+ *  @param stats Statistics of the peer.
+ *
+ *  @retval 0 if the operation was successful.
+ *  @retval -ENOENT when the peer is not known.
+ */
+int timeslot_queue_peer_stats_get(const bt_addr_le_t *bt_addr, struct dm_peer_stats *stats);
+
+/** @brief Remove all timeslots and peer statistics.
+ *
+ *  @param None
+ */
+void timeslot_queue_reset(void);
+
 #ifdef __cplusplus
 }
 #endif
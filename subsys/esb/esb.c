@@ -272,6 +272,9 @@ static const struct mbox_dt_spec off_channel =
 static esb_event_handler event_handler;
 static struct esb_payload *current_payload;
 
+/* Set when the back of the TX FIFO is reserved for in-place filling. */
+static bool tx_reserved;
+
 /* FIFOs and buffers */
 static struct payload_tx_fifo tx_fifo;
 static struct payload_rx_fifo rx_fifo;
@@ -995,6 +998,8 @@ static bool update_radio_parameters(void)
 
 static void reset_fifos(void)
 {
+	tx_reserved = false;
+
 	tx_fifo.back = 0;
 	tx_fifo.front = 0;
 	tx_fifo.count = 0;
@@ -2031,6 +2036,23 @@ static struct payload_wrap *find_free_payload_cont(void)
 	return 0;
 }
 
+static bool payload_length_valid(uint32_t length)
+{
+	return (length > 0) && (length <= CONFIG_ESB_MAX_PAYLOAD_LENGTH) &&
+	       ((esb_cfg.protocol != ESB_PROTOCOL_ESB) || (length <= esb_cfg.payload_length));
+}
+
+static void tx_auto_start(void)
+{
+	if (esb_cfg.mode == ESB_MODE_PTX &&
+	    esb_cfg.tx_mode == ESB_TXMODE_AUTO &&
+	    (esb_state == ESB_STATE_IDLE ||
+	     (IS_ENABLED(CONFIG_ESB_NEVER_DISABLE_TX) ?
+	      esb_state == ESB_STATE_PTX_TXIDLE : 0))) {
+		start_tx_transaction();
+	}
+}
+
 int esb_write_payload(const struct esb_payload *payload)
 {
 	if (!esb_initialized) {
@@ -2041,9 +2063,7 @@ int esb_write_payload(const struct esb_payload *payload)
 		return -EINVAL;
 	}
 
-	if ((payload->length == 0) || (payload->length > CONFIG_ESB_MAX_PAYLOAD_LENGTH) ||
-	    ((esb_cfg.protocol == ESB_PROTOCOL_ESB) &&
-	     (payload->length > esb_cfg.payload_length))) {
+	if (!payload_length_valid(payload->length)) {
 		return -EMSGSIZE;
 	}
 
@@ -2055,6 +2075,10 @@ int esb_write_payload(const struct esb_payload *payload)
 		return -EINVAL;
 	}
 
+	if (tx_reserved) {
+		return -EBUSY;
+	}
+
 	unsigned int key = irq_lock();
 
 	if (esb_cfg.mode == ESB_MODE_PTX) {
@@ -2095,17 +2119,87 @@ int esb_write_payload(const struct esb_payload *payload)
 
 	irq_unlock(key);
 
-	if (esb_cfg.mode == ESB_MODE_PTX &&
-	    esb_cfg.tx_mode == ESB_TXMODE_AUTO &&
-	    (esb_state == ESB_STATE_IDLE ||
-	     (IS_ENABLED(CONFIG_ESB_NEVER_DISABLE_TX) ?
-	      esb_state == ESB_STATE_PTX_TXIDLE : 0))) {
-		start_tx_transaction();
+	tx_auto_start();
+
+	return 0;
+}
+
+int esb_tx_payload_reserve(struct esb_payload **payload)
+{
+	int err = 0;
+
+	if (!esb_initialized) {
+		return -EACCES;
 	}
 
+	if (payload == NULL) {
+		return -EINVAL;
+	}
+
+	if (esb_cfg.mode != ESB_MODE_PTX) {
+		return -ENOTSUP;
+	}
+
+	unsigned int key = irq_lock();
+
+	if (tx_reserved) {
+		err = -EBUSY;
+	} else if (tx_fifo.count >= CONFIG_ESB_TX_FIFO_SIZE) {
+		err = -ENOMEM;
+	} else {
+		*payload = tx_fifo.payload[tx_fifo.back];
+		tx_reserved = true;
+	}
+
+	irq_unlock(key);
+
+	return err;
+}
+
+int esb_tx_payload_commit(struct esb_payload *payload)
+{
+	if (!esb_initialized) {
+		return -EACCES;
+	}
+
+	if (!tx_reserved || (payload != tx_fifo.payload[tx_fifo.back])) {
+		return -EINVAL;
+	}
+
+	if (!payload_length_valid(payload->length)) {
+		tx_reserved = false;
+		return -EMSGSIZE;
+	}
+
+	if (payload->pipe >= CONFIG_ESB_PIPE_COUNT) {
+		tx_reserved = false;
+		return -EINVAL;
+	}
+
+	unsigned int key = irq_lock();
+
+	pids[payload->pipe] = (pids[payload->pipe] + 1) % (PID_MAX + 1);
+	payload->pid = pids[payload->pipe];
+
+	if (++tx_fifo.back >= CONFIG_ESB_TX_FIFO_SIZE) {
+		tx_fifo.back = 0;
+	}
+
+	tx_fifo.count++;
+	tx_reserved = false;
+
+	irq_unlock(key);
+
+	tx_auto_start();
+
 	return 0;
 }
 
+uint32_t esb_tx_fifo_count(void)
+{
+	return tx_fifo.count;
+}
+
 int esb_read_rx_payload(struct esb_payload *payload)
 {
 	if (!esb_initialized) {
@@ -2140,6 +2234,48 @@ int esb_read_rx_payload(struct esb_payload *payload)
 	return 0;
 }
 
+int esb_rx_payload_get(const struct esb_payload **payload)
+{
+	if (!esb_initialized) {
+		return -EACCES;
+	}
+
+	if (payload == NULL) {
+		return -EINVAL;
+	}
+
+	if (rx_fifo.count == 0) {
+		return -ENODATA;
+	}
+
+	*payload = rx_fifo.payload[rx_fifo.front];
+
+	return 0;
+}
+
+int esb_rx_payload_release(void)
+{
+	if (!esb_initialized) {
+		return -EACCES;
+	}
+
+	if (rx_fifo.count == 0) {
+		return -ENODATA;
+	}
+
+	unsigned int key = irq_lock();
+
+	if (++rx_fifo.front >= CONFIG_ESB_RX_FIFO_SIZE) {
+		rx_fifo.front = 0;
+	}
+
+	rx_fifo.count--;
+
+	irq_unlock(key);
+
+	return 0;
+}
+
 int esb_start_tx(void)
 {
 	if (esb_state != ESB_STATE_IDLE) {
@@ -2235,6 +2371,7 @@ int esb_flush_tx(void)
 
 	unsigned int key = irq_lock();
 
+	tx_reserved = false;
 	tx_fifo.count = 0;
 	tx_fifo.back = 0;
 	tx_fifo.front = 0;
@@ -2433,6 +2570,23 @@ int esb_get_rf_channel(uint32_t *channel)
 	return 0;
 }
 
+int esb_get_max_payload_length(uint32_t *length)
+{
+	if (!esb_initialized) {
+		return -EACCES;
+	}
+
+	if (length == NULL) {
+		return -EINVAL;
+	}
+
+	*length = (esb_cfg.protocol == ESB_PROTOCOL_ESB) ?
+		  MIN(esb_cfg.payload_length, CONFIG_ESB_MAX_PAYLOAD_LENGTH) :
+		  CONFIG_ESB_MAX_PAYLOAD_LENGTH;
+
+	return 0;
+}
+
 int esb_set_tx_power(int8_t tx_output_power)
 {
 	if (esb_state != ESB_STATE_IDLE) {
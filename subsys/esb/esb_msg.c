@@ -0,0 +1,507 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <esb.h>
+#include <esb_msg.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_REGISTER(esb_msg, CONFIG_ESB_LOG_LEVEL);
+
+#define FRAG_MAX_CNT DIV_ROUND_UP(CONFIG_ESB_MSG_MAX_SIZE, ESB_MSG_FRAG_DATA_LEN)
+#define TX_WINDOW    CONFIG_ESB_MSG_TX_WINDOW
+
+BUILD_ASSERT(CONFIG_ESB_MAX_PAYLOAD_LENGTH > ESB_MSG_FRAG_HDR_LEN,
+	     "Payload too short to carry message fragments");
+
+/* Fragment header, placed at the beginning of every payload. */
+struct frag_hdr {
+	uint8_t msg_id;		/* Message ID, incremented for every message on a pipe. */
+	uint16_t frag_idx;	/* Fragment index, little endian. */
+	uint16_t msg_len;	/* Message length, little endian. */
+} __packed;
+
+BUILD_ASSERT(sizeof(struct frag_hdr) == ESB_MSG_FRAG_HDR_LEN);
+
+/* Message being sent on a pipe. */
+struct tx_msg {
+	const uint8_t *data;
+	uint16_t len;
+	uint16_t frag_cnt;
+	uint16_t next_frag;	/* Next fragment to be queued in the TX FIFO. */
+	uint16_t acked_frag;	/* Number of acknowledged fragments. */
+	uint8_t msg_id;
+	uint8_t retries;	/* Transmission restarts of the oldest queued fragment. */
+	bool active;
+};
+
+/* Messages finished while holding the lock, reported after it is released. */
+struct tx_report {
+	uint32_t pipes;
+	int err[CONFIG_ESB_PIPE_COUNT];
+};
+
+/* Message being reassembled. */
+struct rx_slot {
+	uint8_t buf[CONFIG_ESB_MSG_MAX_SIZE];
+	uint32_t received[DIV_ROUND_UP(FRAG_MAX_CNT, 32)];
+	uint32_t last_update;
+	uint32_t last_time;	/* Uptime of the last update, in milliseconds. */
+	uint16_t len;
+	uint16_t frag_cnt;
+	uint16_t received_cnt;
+	uint8_t pipe;
+	uint8_t msg_id;
+	bool in_use;
+};
+
+static struct k_spinlock lock;
+static const struct esb_msg_cb *callbacks;
+static struct esb_msg_stats stats;
+
+static struct tx_msg tx_msgs[CONFIG_ESB_PIPE_COUNT];
+static uint8_t tx_next_pipe;
+
+/* Pipes of the fragments queued in the TX FIFO, in transmission order. */
+static uint8_t inflight_pipe[TX_WINDOW];
+static uint8_t inflight_head;
+static uint8_t inflight_cnt;
+
+static struct rx_slot rx_slots[CONFIG_ESB_MSG_RX_SLOT_COUNT];
+static uint32_t rx_seq;
+/* ID of the last message received on each pipe, used to drop late duplicates.
+ * Cleared when a fragment of another message is received, as the sender does not
+ * transmit the completed message anymore. The record also expires after the
+ * reassembly timeout, so that a restarted sender reusing the ID is not ignored.
+ */
+static int16_t rx_last_msg_id[CONFIG_ESB_PIPE_COUNT];
+static uint16_t rx_last_msg_len[CONFIG_ESB_PIPE_COUNT];
+static uint32_t rx_last_msg_time[CONFIG_ESB_PIPE_COUNT];
+
+static uint16_t frag_len(uint16_t msg_len, uint16_t frag_idx)
+{
+	return MIN(msg_len - frag_idx * ESB_MSG_FRAG_DATA_LEN, ESB_MSG_FRAG_DATA_LEN);
+}
+
+static void tx_msg_finish(struct tx_report *report, uint8_t pipe, int err)
+{
+	tx_msgs[pipe].active = false;
+
+	report->pipes |= BIT(pipe);
+	report->err[pipe] = err;
+
+	if (err) {
+		stats.tx_failed++;
+	} else {
+		stats.tx_msgs++;
+	}
+}
+
+static void tx_report_send(const struct tx_report *report)
+{
+	for (uint8_t pipe = 0; pipe < CONFIG_ESB_PIPE_COUNT; pipe++) {
+		if ((report->pipes & BIT(pipe)) && callbacks && callbacks->sent) {
+			callbacks->sent(pipe, report->err[pipe]);
+		}
+	}
+}
+
+static int frag_queue(struct tx_msg *msg, uint8_t pipe)
+{
+	struct esb_payload *payload;
+	uint16_t len = frag_len(msg->len, msg->next_frag);
+	struct frag_hdr hdr = {
+		.msg_id = msg->msg_id,
+		.frag_idx = sys_cpu_to_le16(msg->next_frag),
+		.msg_len = sys_cpu_to_le16(msg->len),
+	};
+	int err;
+
+	/* The fragment is written directly to the TX FIFO entry. */
+	err = esb_tx_payload_reserve(&payload);
+	if (err) {
+		return err;
+	}
+
+	memcpy(payload->data, &hdr, sizeof(hdr));
+	memcpy(&payload->data[sizeof(hdr)],
+	       &msg->data[msg->next_frag * ESB_MSG_FRAG_DATA_LEN], len);
+	payload->pipe = pipe;
+	payload->length = sizeof(hdr) + len;
+	payload->noack = false;
+
+	err = esb_tx_payload_commit(payload);
+	if (err) {
+		return err;
+	}
+
+	inflight_pipe[(inflight_head + inflight_cnt) % TX_WINDOW] = pipe;
+	inflight_cnt++;
+	msg->next_frag++;
+
+	return 0;
+}
+
+/* Queue fragments of all messages, taking one fragment from each pipe in turn. */
+static void tx_fill(struct tx_report *report)
+{
+	size_t idle = 0;
+	int err;
+
+	while ((inflight_cnt < TX_WINDOW) && (idle < CONFIG_ESB_PIPE_COUNT)) {
+		uint8_t pipe = tx_next_pipe;
+		struct tx_msg *msg = &tx_msgs[pipe];
+
+		tx_next_pipe = (tx_next_pipe + 1) % CONFIG_ESB_PIPE_COUNT;
+
+		if (!msg->active || (msg->next_frag >= msg->frag_cnt)) {
+			idle++;
+			continue;
+		}
+
+		err = frag_queue(msg, pipe);
+		if ((err == -ENOMEM) || (err == -EBUSY)) {
+			/* Retried when the TX FIFO is emptied. */
+			break;
+		} else if (err) {
+			LOG_ERR("Cannot queue fragment: %d", err);
+			tx_msg_finish(report, pipe, err);
+		}
+
+		idle = 0;
+	}
+
+	if ((inflight_cnt > 0) && esb_is_idle()) {
+		(void)esb_start_tx();
+	}
+}
+
+/* Drop all queued fragments. Fragments that were not acknowledged are queued again. */
+static void tx_rewind(void)
+{
+	(void)esb_flush_tx();
+
+	inflight_head = 0;
+	inflight_cnt = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(tx_msgs); i++) {
+		tx_msgs[i].next_frag = tx_msgs[i].acked_frag;
+	}
+}
+
+static void tx_process(bool failed, struct tx_report *report)
+{
+	uint32_t queued = esb_tx_fifo_count();
+	uint32_t delivered = (inflight_cnt > queued) ? (inflight_cnt - queued) : 0;
+
+	/* The TX FIFO is emptied in order, so the oldest fragments are the acknowledged ones. */
+	while (delivered-- > 0) {
+		uint8_t pipe = inflight_pipe[inflight_head];
+		struct tx_msg *msg = &tx_msgs[pipe];
+
+		inflight_head = (inflight_head + 1) % TX_WINDOW;
+		inflight_cnt--;
+		stats.tx_frags++;
+
+		if (!msg->active) {
+			continue;
+		}
+
+		msg->acked_frag++;
+		msg->retries = 0;
+
+		if (msg->acked_frag == msg->frag_cnt) {
+			tx_msg_finish(report, pipe, 0);
+		}
+	}
+
+	/* The fragment that failed stays at the front of the TX FIFO and is transmitted
+	 * again, together with the fragments queued after it.
+	 */
+	if (failed && (inflight_cnt > 0)) {
+		uint8_t pipe = inflight_pipe[inflight_head];
+
+		stats.tx_retransmits++;
+
+		if (++tx_msgs[pipe].retries > CONFIG_ESB_MSG_TX_RETRY_COUNT) {
+			LOG_WRN("Message on pipe %u not delivered", pipe);
+			tx_rewind();
+			tx_msg_finish(report, pipe, -EIO);
+		}
+	}
+
+	tx_fill(report);
+}
+
+static struct rx_slot *rx_slot_get(uint8_t pipe, uint8_t msg_id, uint16_t msg_len,
+				   uint32_t now)
+{
+	struct rx_slot *slot = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(rx_slots); i++) {
+		if (rx_slots[i].in_use && (rx_slots[i].pipe == pipe)) {
+			slot = &rx_slots[i];
+
+			if ((slot->msg_id == msg_id) && (slot->len == msg_len) &&
+			    ((now - slot->last_time) < CONFIG_ESB_MSG_RX_TIMEOUT_MS)) {
+				return slot;
+			}
+
+			/* The sender gave up the previous message, or stopped sending it. */
+			stats.rx_dropped++;
+			break;
+		}
+	}
+
+	for (size_t i = 0; (i < ARRAY_SIZE(rx_slots)) && !slot; i++) {
+		if (!rx_slots[i].in_use) {
+			slot = &rx_slots[i];
+		}
+	}
+
+	if (!slot) {
+		/* Drop the message that was not updated for the longest time. */
+		slot = &rx_slots[0];
+
+		for (size_t i = 1; i < ARRAY_SIZE(rx_slots); i++) {
+			if ((rx_seq - rx_slots[i].last_update) > (rx_seq - slot->last_update)) {
+				slot = &rx_slots[i];
+			}
+		}
+
+		stats.rx_dropped++;
+	}
+
+	memset(slot->received, 0, sizeof(slot->received));
+	slot->len = msg_len;
+	slot->frag_cnt = DIV_ROUND_UP(msg_len, ESB_MSG_FRAG_DATA_LEN);
+	slot->received_cnt = 0;
+	slot->pipe = pipe;
+	slot->msg_id = msg_id;
+	slot->in_use = true;
+
+	return slot;
+}
+
+/* Returns the slot if the fragment completes the message. */
+static struct rx_slot *rx_frag_handle(const struct esb_payload *payload)
+{
+	struct frag_hdr hdr;
+	struct rx_slot *slot;
+	uint32_t now = k_uptime_get_32();
+	uint16_t frag_idx;
+	uint16_t msg_len;
+	uint16_t len;
+
+	if ((payload->length <= sizeof(hdr)) || (payload->pipe >= CONFIG_ESB_PIPE_COUNT)) {
+		stats.rx_invalid++;
+		return NULL;
+	}
+
+	memcpy(&hdr, payload->data, sizeof(hdr));
+	frag_idx = sys_le16_to_cpu(hdr.frag_idx);
+	msg_len = sys_le16_to_cpu(hdr.msg_len);
+
+	if ((msg_len == 0) || (msg_len > CONFIG_ESB_MSG_MAX_SIZE) ||
+	    (frag_idx >= DIV_ROUND_UP(msg_len, ESB_MSG_FRAG_DATA_LEN))) {
+		stats.rx_invalid++;
+		return NULL;
+	}
+
+	len = frag_len(msg_len, frag_idx);
+	if ((payload->length - sizeof(hdr)) < len) {
+		stats.rx_invalid++;
+		return NULL;
+	}
+
+	stats.rx_frags++;
+
+	if ((rx_last_msg_id[payload->pipe] == hdr.msg_id) &&
+	    (rx_last_msg_len[payload->pipe] == msg_len) &&
+	    ((now - rx_last_msg_time[payload->pipe]) < CONFIG_ESB_MSG_RX_TIMEOUT_MS)) {
+		/* Fragment retransmitted after the message was completed. */
+		return NULL;
+	}
+
+	rx_last_msg_id[payload->pipe] = -1;
+
+	slot = rx_slot_get(payload->pipe, hdr.msg_id, msg_len, now);
+	slot->last_update = ++rx_seq;
+	slot->last_time = now;
+
+	if (slot->received[frag_idx / 32] & BIT(frag_idx % 32)) {
+		return NULL;
+	}
+
+	memcpy(&slot->buf[frag_idx * ESB_MSG_FRAG_DATA_LEN], &payload->data[sizeof(hdr)], len);
+	slot->received[frag_idx / 32] |= BIT(frag_idx % 32);
+	slot->received_cnt++;
+
+	if (slot->received_cnt < slot->frag_cnt) {
+		return NULL;
+	}
+
+	rx_last_msg_id[payload->pipe] = hdr.msg_id;
+	rx_last_msg_len[payload->pipe] = msg_len;
+	rx_last_msg_time[payload->pipe] = now;
+	stats.rx_msgs++;
+
+	return slot;
+}
+
+static void rx_process(void)
+{
+	const struct esb_payload *payload;
+	struct rx_slot *slot;
+	k_spinlock_key_t key;
+
+	while (esb_rx_payload_get(&payload) == 0) {
+		key = k_spin_lock(&lock);
+		slot = rx_frag_handle(payload);
+		k_spin_unlock(&lock, key);
+
+		(void)esb_rx_payload_release();
+
+		if (slot) {
+			/* Reassembly slots are modified only in the event handler context. */
+			if (callbacks && callbacks->received) {
+				callbacks->received(slot->pipe, slot->buf, slot->len);
+			}
+
+			slot->in_use = false;
+		}
+	}
+}
+
+int esb_msg_init(const struct esb_msg_cb *cb)
+{
+	uint32_t max_payload_len;
+	int err;
+
+	err = esb_get_max_payload_length(&max_payload_len);
+	if (err) {
+		return err;
+	}
+
+	/* Fragments use the whole payload. */
+	if (max_payload_len < CONFIG_ESB_MAX_PAYLOAD_LENGTH) {
+		LOG_ERR("Payload length %u shorter than %u", max_payload_len,
+			CONFIG_ESB_MAX_PAYLOAD_LENGTH);
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (inflight_cnt > 0) {
+		(void)esb_flush_tx();
+	}
+
+	memset(tx_msgs, 0, sizeof(tx_msgs));
+	tx_next_pipe = 0;
+	inflight_head = 0;
+	inflight_cnt = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(rx_slots); i++) {
+		rx_slots[i].in_use = false;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(rx_last_msg_id); i++) {
+		rx_last_msg_id[i] = -1;
+	}
+
+	rx_seq = 0;
+	memset(&stats, 0, sizeof(stats));
+	callbacks = cb;
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+int esb_msg_send(uint8_t pipe, const uint8_t *data, size_t len)
+{
+	struct tx_report report = {0};
+	struct tx_msg *msg;
+	int err = 0;
+
+	if ((pipe >= CONFIG_ESB_PIPE_COUNT) || (data == NULL) || (len == 0)) {
+		return -EINVAL;
+	}
+
+	if (len > CONFIG_ESB_MSG_MAX_SIZE) {
+		return -EMSGSIZE;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	msg = &tx_msgs[pipe];
+
+	if (msg->active) {
+		err = -EBUSY;
+	} else {
+		msg->data = data;
+		msg->len = len;
+		msg->frag_cnt = DIV_ROUND_UP(len, ESB_MSG_FRAG_DATA_LEN);
+		msg->next_frag = 0;
+		msg->acked_frag = 0;
+		msg->retries = 0;
+		msg->msg_id++;
+		msg->active = true;
+
+		tx_fill(&report);
+
+		/* Errors of the new message are returned instead of being reported. */
+		if (report.pipes & BIT(pipe)) {
+			err = report.err[pipe];
+			report.pipes &= ~BIT(pipe);
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	tx_report_send(&report);
+
+	return err;
+}
+
+void esb_msg_event_handle(const struct esb_evt *event)
+{
+	struct tx_report report = {0};
+	k_spinlock_key_t key;
+
+	switch (event->evt_id) {
+	case ESB_EVENT_TX_SUCCESS:
+	case ESB_EVENT_TX_FAILED:
+		key = k_spin_lock(&lock);
+		tx_process(event->evt_id == ESB_EVENT_TX_FAILED, &report);
+		k_spin_unlock(&lock, key);
+
+		tx_report_send(&report);
+		break;
+
+	case ESB_EVENT_RX_RECEIVED:
+		rx_process();
+		break;
+
+	default:
+		break;
+	}
+}
+
+void esb_msg_stats_get(struct esb_msg_stats *stats_out)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	*stats_out = stats;
+
+	k_spin_unlock(&lock, key);
+}
@@ -6,11 +6,14 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/spinlock.h>
+#include <zephyr/sys/ring_buffer.h>
 #include <app_event_manager.h>
 #include <event_manager_proxy.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/ipc/ipc_service.h>
 
+#include "event_manager_proxy_protocol.h"
+
 LOG_MODULE_REGISTER(event_manager_proxy, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
 
 
@@ -27,30 +30,6 @@ extern struct event_type *event_manager_proxy_array[];
 extern struct event_type *_event_manager_proxy_array_list_end[];
 
 
-/** @brief Command codes used by the proxy. */
-enum emp_cmd_code {
-	EMP_CMD_SUBSCRIBE,
-	EMP_CMD_START,
-	EMP_CMD_COUNT,
-	EMP_CMD_FORCE_INT_SIZE = INT_MAX
-};
-
-/**
- * @brief The command base structure.
- */
-struct emp_cmd {
-	enum emp_cmd_code code;
-};
-
-/**
- * @brief The command structure used to subscribe.
- */
-struct emp_cmd_subscribe {
-	enum emp_cmd_code code;
-	const struct event_type *id;
-	char name[];
-};
-
 /** @brief Inter-core communication data. */
 struct emp_ipc_data {
 	struct ipc_ept ept;
@@ -59,8 +38,39 @@ struct emp_ipc_data {
 	bool started;
 	struct k_event bound;
 	const struct event_type **event_type_map;
+	/* Frame being filled with events, NULL if there is none. */
+	uint8_t *frame;
+	/* Size of the frame buffer. */
+	uint32_t frame_size;
+	/* Length of the data in the frame. */
+	uint32_t frame_len;
+	/* Number of events in the frame. */
+	uint32_t frame_events;
+	/* The backend does not support no-copy sending, frames are copied from copy_buf. */
+	bool copy_mode;
+	uint32_t copy_buf[CONFIG_EVENT_MANAGER_PROXY_FRAME_SIZE / sizeof(uint32_t)];
+	/* Events waiting for a free transmission buffer, stored as frame records. */
+	struct ring_buf pending;
+	uint8_t pending_buf[CONFIG_EVENT_MANAGER_PROXY_PENDING_SIZE];
+#if CONFIG_EVENT_MANAGER_PROXY_STATS
+	struct event_manager_proxy_stats stats;
+#endif
 };
 
+#if CONFIG_EVENT_MANAGER_PROXY_STATS
+static struct k_spinlock emp_stats_lock;
+
+#define STATS_ADD(_ipc, _field, _val)					\
+	do {								\
+		k_spinlock_key_t _key = k_spin_lock(&emp_stats_lock);	\
+									\
+		(_ipc)->stats._field += (_val);				\
+		k_spin_unlock(&emp_stats_lock, _key);			\
+	} while (0)
+#else
+#define STATS_ADD(_ipc, _field, _val)
+#endif
+
 
 /** @brief True if proxy was started. */
 static bool emp_started;
@@ -151,12 +161,37 @@ static void handle_ipc_endpoint_bound(void *priv)
 	k_event_set(&ipc->bound, 0x1);
 }
 
-static void handle_remote_event(struct emp_ipc_data *ipc, const void *data, size_t len)
+static void handle_remote_frame(struct emp_ipc_data *ipc, const void *data, size_t len)
 {
-	void *event = app_event_manager_alloc(len);
+	const uint8_t *pos = data;
+
+	while (len > 0) {
+		struct emp_frame_record rec;
+		void *event;
+
+		if (len < sizeof(rec)) {
+			LOG_ERR("Malformed frame from ipc %zu", ipc2idx(ipc));
+			break;
+		}
+
+		memcpy(&rec, pos, sizeof(rec));
+
+		if ((rec.len < sizeof(struct app_event_header)) || (rec.len > len) ||
+		    (emp_frame_record_size(rec.len) > len)) {
+			LOG_ERR("Malformed frame from ipc %zu", ipc2idx(ipc));
+			break;
+		}
 
-	memcpy(event, data, len);
-	_event_submit(event);
+		event = app_event_manager_alloc(rec.len);
+		memcpy(event, pos + sizeof(rec), rec.len);
+		_event_submit(event);
+
+		pos += emp_frame_record_size(rec.len);
+		len -= emp_frame_record_size(rec.len);
+		STATS_ADD(ipc, rx_events, 1);
+	}
+
+	STATS_ADD(ipc, rx_frames, 1);
 }
 
 static void handle_remote_command_subscribe(struct emp_ipc_data *ipc, const void *data, size_t len)
@@ -256,7 +291,7 @@ static void handle_ipc_data_receive(const void *data, size_t len, void *priv)
 	__ASSERT_NO_MSG(!k_is_in_isr());
 
 	if (ipc->started && emp_started) {
-		handle_remote_event(ipc, data, len);
+		handle_remote_frame(ipc, data, len);
 	} else {
 		handle_remote_command(ipc, data, len);
 	}
@@ -274,54 +309,272 @@ static void handle_ipc_endpoint_error(const char *message, void *priv)
 	__ASSERT_NO_MSG(false);
 }
 
-static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh)
+static void emp_flush_work_handler(struct k_work *work);
+
+/** @brief Work sending the filled frames and the pending events. */
+static K_WORK_DELAYABLE_DEFINE(emp_flush_work, emp_flush_work_handler);
+
+/**
+ * @brief Open a new frame.
+ *
+ * The frame is placed directly in the transmission buffer of the IPC service. If the backend
+ * does not support no-copy sending, the frame is placed in the local buffer and copied on send.
+ *
+ * @param ipc The remote to open the frame for.
+ *
+ * @retval 0 On success.
+ * @retval other errno code if no transmission buffer is available.
+ */
+static int frame_open(struct emp_ipc_data *ipc)
 {
-	const struct event_type *remote_ev = ipc->event_type_map[et2idx(eh->type_id)];
+	void *data;
+	uint32_t size = CONFIG_EVENT_MANAGER_PROXY_FRAME_SIZE;
 	int ret;
 
+	if (!ipc->copy_mode) {
+		ret = ipc_service_get_tx_buffer(&ipc->ept, &data, &size, K_NO_WAIT);
+		if ((ret == -ENOMEM) && (size > 0) && (size < CONFIG_EVENT_MANAGER_PROXY_FRAME_SIZE)) {
+			/* Backend buffers are smaller than the frame. */
+			ret = ipc_service_get_tx_buffer(&ipc->ept, &data, &size, K_NO_WAIT);
+		}
+
+		if ((ret == -EIO) || (ret == -ENOTSUP)) {
+			LOG_DBG("No-copy sending not supported on ipc %zu", ipc2idx(ipc));
+			ipc->copy_mode = true;
+		} else if (ret < 0) {
+			return ret;
+		} else {
+			ipc->frame = data;
+			ipc->frame_size = size;
+		}
+	}
+
+	if (ipc->copy_mode) {
+		ipc->frame = (uint8_t *)ipc->copy_buf;
+		ipc->frame_size = sizeof(ipc->copy_buf);
+	}
+
+	ipc->frame_len = 0;
+	ipc->frame_events = 0;
+
+	return 0;
+}
+
+/**
+ * @brief Send the frame to the remote.
+ *
+ * If sending fails, the frame is kept and sending is retried later.
+ *
+ * @param ipc The remote to send the frame to.
+ *
+ * @retval 0 On success.
+ * @retval other errno code from the IPC service.
+ */
+static int frame_send(struct emp_ipc_data *ipc)
+{
+	int ret;
+
+	__ASSERT_NO_MSG(ipc->frame);
+
+	if (ipc->copy_mode) {
+		ret = ipc_service_send(&ipc->ept, ipc->frame, ipc->frame_len);
+	} else {
+		ret = ipc_service_send_nocopy(&ipc->ept, ipc->frame, ipc->frame_len);
+	}
+
+	if (ret < 0) {
+		LOG_DBG("Cannot send frame to ipc %zu, err: %d", ipc2idx(ipc), ret);
+		return ret;
+	}
+
+	STATS_ADD(ipc, tx_frames, 1);
+	STATS_ADD(ipc, tx_events, ipc->frame_events);
+	STATS_ADD(ipc, tx_bytes, ipc->frame_len);
+
+	ipc->frame = NULL;
+
+	return 0;
+}
+
+/**
+ * @brief Make space for a record in the frame.
+ *
+ * Sends the frame if the record does not fit in it and opens a new one if needed.
+ *
+ * @param ipc      The remote.
+ * @param rec_size Size of the record.
+ *
+ * @retval 0         The record fits in the frame.
+ * @retval -EMSGSIZE The record is bigger than a frame.
+ * @retval other errno code if the frame cannot be sent or opened.
+ */
+static int frame_reserve(struct emp_ipc_data *ipc, size_t rec_size)
+{
+	int ret;
+
+	if (rec_size > CONFIG_EVENT_MANAGER_PROXY_FRAME_SIZE) {
+		return -EMSGSIZE;
+	}
+
+	if (ipc->frame && ((ipc->frame_len + rec_size) > ipc->frame_size)) {
+		ret = frame_send(ipc);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	if (!ipc->frame) {
+		ret = frame_open(ipc);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	if (rec_size > ipc->frame_size) {
+		return -EMSGSIZE;
+	}
+
+	return 0;
+}
+
+static void drop_event(struct emp_ipc_data *ipc, const struct app_event_header *eh)
+{
+	LOG_WRN("Event %s to ipc %zu dropped", eh->type_id->name, ipc2idx(ipc));
+	STATS_ADD(ipc, tx_dropped, 1);
+}
+
+static void send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh)
+{
+	const struct event_type *remote_ev = ipc->event_type_map[et2idx(eh->type_id)];
+	const size_t type_off = offsetof(struct app_event_header, type_id);
+	const size_t type_end = type_off + sizeof(remote_ev);
+	static const uint8_t padding[sizeof(uint32_t)];
+
 	if (remote_ev == NULL) {
-		return 0;
+		return;
 	}
 
-	size_t size = app_event_manager_event_size(eh);
-	uint32_t buffer[DIV_ROUND_UP(size, sizeof(uint32_t))];
-	struct app_event_header *remote_eh = (struct app_event_header *)buffer;
+	struct emp_frame_record rec = {
+		.len = app_event_manager_event_size(eh),
+	};
+	size_t rec_size = emp_frame_record_size(rec.len);
+	size_t pad_len = rec_size - sizeof(rec) - rec.len;
 
-	memcpy(buffer, eh, sizeof(buffer));
-	remote_eh->type_id = remote_ev;
+	/* Pending events go first to keep the order. */
+	if (ring_buf_is_empty(&ipc->pending)) {
+		int ret = frame_reserve(ipc, rec_size);
 
-	for (size_t cnt = CONFIG_EVENT_MANAGER_PROXY_SEND_RETRIES + 1; cnt > 0; --cnt) {
-		ret = ipc_service_send(&ipc->ept, buffer, sizeof(buffer));
-		if (ret >= 0) {
-			break;
+		if (!ret) {
+			uint8_t *dst = &ipc->frame[ipc->frame_len];
+
+			memcpy(dst, &rec, sizeof(rec));
+			dst += sizeof(rec);
+			memcpy(dst, eh, rec.len);
+			/* The event ID is replaced by the ID requested by the remote. */
+			memcpy(dst + type_off, &remote_ev, sizeof(remote_ev));
+			memset(dst + rec.len, 0, pad_len);
+
+			ipc->frame_len += rec_size;
+			ipc->frame_events++;
+
+			k_work_schedule(&emp_flush_work, K_NO_WAIT);
+			return;
+		}
+
+		if (ret == -EMSGSIZE) {
+			drop_event(ipc, eh);
+			return;
 		}
-		k_usleep(1);
 	}
 
-	if (ret < 0) {
-		LOG_ERR("Cannot send event to remote %p, err: %d", ipc, ret);
-		__ASSERT_NO_MSG(false);
+	if (ring_buf_space_get(&ipc->pending) < rec_size) {
+		drop_event(ipc, eh);
+		return;
 	}
 
-	return ret;
+	ring_buf_put(&ipc->pending, (const uint8_t *)&rec, sizeof(rec));
+	ring_buf_put(&ipc->pending, (const uint8_t *)eh, type_off);
+	ring_buf_put(&ipc->pending, (const uint8_t *)&remote_ev, sizeof(remote_ev));
+	ring_buf_put(&ipc->pending, (const uint8_t *)eh + type_end, rec.len - type_end);
+	ring_buf_put(&ipc->pending, padding, pad_len);
+
+	k_work_schedule(&emp_flush_work, K_NO_WAIT);
 }
 
-static void event_manager_proxy_on_event_process(const struct app_event_header *eh)
+/**
+ * @brief Send the pending events and the frame to the remote.
+ *
+ * @param ipc The remote.
+ *
+ * @retval 0 All events were sent.
+ * @retval other errno code if some events are still waiting.
+ */
+static int flush_remote(struct emp_ipc_data *ipc)
 {
-	int ret = 0;
+	struct emp_frame_record rec;
+	int ret;
+
+	while (ring_buf_peek(&ipc->pending, (uint8_t *)&rec, sizeof(rec)) == sizeof(rec)) {
+		size_t rec_size = emp_frame_record_size(rec.len);
+
+		ret = frame_reserve(ipc, rec_size);
+		if (ret == -EMSGSIZE) {
+			LOG_WRN("Pending event to ipc %zu dropped", ipc2idx(ipc));
+			ring_buf_get(&ipc->pending, NULL, rec_size);
+			STATS_ADD(ipc, tx_dropped, 1);
+			continue;
+		} else if (ret) {
+			return ret;
+		}
+
+		ring_buf_get(&ipc->pending, &ipc->frame[ipc->frame_len], rec_size);
+		ipc->frame_len += rec_size;
+		ipc->frame_events++;
+	}
+
+	if (ipc->frame && (ipc->frame_len > 0)) {
+		return frame_send(ipc);
+	}
 
+	return 0;
+}
+
+static void emp_flush_work_handler(struct k_work *work)
+{
+	bool retry = false;
+
+	for (size_t i = 0; i < ARRAY_SIZE(emp_ipc_data); ++i) {
+		struct emp_ipc_data *ipc = &emp_ipc_data[i];
+
+		if (!ipc->used || !ipc->started) {
+			continue;
+		}
+
+		if (flush_remote(ipc)) {
+			retry = true;
+		}
+	}
+
+	if (retry) {
+		k_work_schedule(&emp_flush_work,
+				K_MSEC(CONFIG_EVENT_MANAGER_PROXY_RETRY_INTERVAL_MS));
+	}
+}
+
+static void event_manager_proxy_on_event_process(const struct app_event_header *eh)
+{
 	if (!emp_started) {
 		return;
 	}
 
-	for (size_t i = 0; (i < ARRAY_SIZE(emp_ipc_data)) && !ret; ++i) {
+	for (size_t i = 0; i < ARRAY_SIZE(emp_ipc_data); ++i) {
 		struct emp_ipc_data *ipc = &emp_ipc_data[i];
 
 		if (!ipc->used || !ipc->started) {
 			continue;
 		}
 
-		ret = send_event_to_remote(ipc, eh);
+		send_event_to_remote(ipc, eh);
 	}
 }
 APP_EVENT_HOOK_POSTPROCESS_REGISTER(event_manager_proxy_on_event_process);
@@ -355,6 +608,9 @@ static int add_ipc_instace(struct emp_ipc_data *ipc, const struct device *instan
 	memset(ipc->event_type_map, 0, event_type_count * sizeof(ipc->event_type_map[0]));
 
 	k_event_init(&ipc->bound);
+	ring_buf_init(&ipc->pending, sizeof(ipc->pending_buf), ipc->pending_buf);
+	ipc->frame = NULL;
+	ipc->copy_mode = false;
 
 	ret = ipc_service_register_endpoint(instance, &ipc->ept, &ipc->ept_cfg);
 	if (ret) {
@@ -479,3 +735,38 @@ int event_manager_proxy_wait_for_remotes(k_timeout_t timeout)
 
 	return 0;
 }
+
+#if CONFIG_EVENT_MANAGER_PROXY_STATS
+int event_manager_proxy_stats_get(const struct device *instance,
+				  struct event_manager_proxy_stats *stats)
+{
+	struct emp_ipc_data *ipc = find_ipc_by_instance(instance);
+	k_spinlock_key_t key;
+
+	if (!ipc) {
+		return -ENOENT;
+	}
+
+	key = k_spin_lock(&emp_stats_lock);
+	*stats = ipc->stats;
+	k_spin_unlock(&emp_stats_lock, key);
+
+	return 0;
+}
+
+int event_manager_proxy_stats_reset(const struct device *instance)
+{
+	struct emp_ipc_data *ipc = find_ipc_by_instance(instance);
+	k_spinlock_key_t key;
+
+	if (!ipc) {
+		return -ENOENT;
+	}
+
+	key = k_spin_lock(&emp_stats_lock);
+	memset(&ipc->stats, 0, sizeof(ipc->stats));
+	k_spin_unlock(&emp_stats_lock, key);
+
+	return 0;
+}
+#endif /* CONFIG_EVENT_MANAGER_PROXY_STATS */
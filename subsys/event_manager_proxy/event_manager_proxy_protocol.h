@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/**
+ * @file
+ * @brief Event manager proxy inter-core protocol.
+ *
+ * Before the proxy is started, every IPC message carries a single command.
+ * After the proxy is started, every IPC message is a frame that carries one or
+ * more events. Every event in the frame is preceded by @ref emp_frame_record
+ * and padded to the 4-byte boundary.
+ */
+#ifndef _EVENT_MANAGER_PROXY_PROTOCOL_H_
+#define _EVENT_MANAGER_PROXY_PROTOCOL_H_
+
+#include <limits.h>
+#include <zephyr/types.h>
+#include <zephyr/sys/util.h>
+#include <app_event_manager.h>
+
+/** @brief Command codes used by the proxy. */
+enum emp_cmd_code {
+	EMP_CMD_SUBSCRIBE,
+	EMP_CMD_START,
+	EMP_CMD_COUNT,
+	EMP_CMD_FORCE_INT_SIZE = INT_MAX
+};
+
+/**
+ * @brief The command base structure.
+ */
+struct emp_cmd {
+	enum emp_cmd_code code;
+};
+
+/**
+ * @brief The command structure used to subscribe.
+ */
+struct emp_cmd_subscribe {
+	enum emp_cmd_code code;
+	const struct event_type *id;
+	char name[];
+};
+
+/**
+ * @brief The header of an event within a frame.
+ */
+struct emp_frame_record {
+	/** Size of the event that follows the header, without padding. */
+	uint32_t len;
+};
+
+/**
+ * @brief Get the space taken by an event in a frame.
+ *
+ * @param event_size Size of the event.
+ *
+ * @return Size of the record header and the padded event.
+ */
+static inline size_t emp_frame_record_size(size_t event_size)
+{
+	return sizeof(struct emp_frame_record) + ROUND_UP(event_size, sizeof(uint32_t));
+}
+
+#endif /* _EVENT_MANAGER_PROXY_PROTOCOL_H_ */
@@ -293,6 +293,12 @@ int fota_download_util_dfu_target_init(enum dfu_target_image_type dfu_target_typ
 		break;
 #endif
 
+#if defined(CONFIG_DFU_TARGET_MCUBOOT_DELTA)
+	case DFU_TARGET_IMAGE_TYPE_MCUBOOT_DELTA:
+		ret = fota_download_mcuboot_target_init();
+		break;
+#endif
+
 #if defined(CONFIG_DFU_TARGET_FULL_MODEM)
 	case DFU_TARGET_IMAGE_TYPE_FULL_MODEM:
 		ret = fota_download_full_modem_pre_init();
@@ -381,6 +387,11 @@ int fota_download_util_apply_update(enum dfu_target_image_type dfu_target_type)
 		ret = 0;
 		break;
 #endif
+#if defined(CONFIG_DFU_TARGET_MCUBOOT_DELTA)
+	case DFU_TARGET_IMAGE_TYPE_MCUBOOT_DELTA:
+		ret = 0;
+		break;
+#endif
 #if defined(CONFIG_DFU_TARGET_FULL_MODEM)
 	case DFU_TARGET_IMAGE_TYPE_FULL_MODEM:
 		ret = fota_download_full_modem_apply_update();
@@ -96,3 +96,66 @@ int nfc_ndef_msg_record_add(struct nfc_ndef_msg_desc *msg,
 
 	return 0;
 }
+
+void nfc_ndef_msg_encoder_init(struct nfc_ndef_msg_encoder *encoder,
+			       uint8_t *msg_buffer,
+			       uint32_t msg_buffer_size)
+{
+	encoder->buf = msg_buffer;
+	encoder->size = msg_buffer_size;
+	encoder->len = 0;
+	encoder->last_record = 0;
+	encoder->record_count = 0;
+}
+
+int nfc_ndef_msg_encoder_record_add(struct nfc_ndef_msg_encoder *encoder,
+				    struct nfc_ndef_record_desc const *record)
+{
+	enum nfc_ndef_record_location record_location;
+	uint32_t temp_len;
+	int err;
+
+	if (!encoder->buf || !record) {
+		return -EINVAL;
+	}
+
+	/* The last record is not known yet, the ME flag is set when finishing
+	 * the message.
+	 */
+	record_location = encoder->record_count ?
+			  NDEF_MIDDLE_RECORD : NDEF_FIRST_RECORD;
+
+	temp_len = encoder->size - encoder->len;
+
+	err = nfc_ndef_record_encode(record,
+				     record_location,
+				     &encoder->buf[encoder->len],
+				     &temp_len);
+	if (err) {
+		return err;
+	}
+
+	encoder->last_record = encoder->len;
+	encoder->len += temp_len;
+	encoder->record_count++;
+
+	return 0;
+}
+
+int nfc_ndef_msg_encoder_finish(struct nfc_ndef_msg_encoder *encoder,
+				uint32_t *msg_len)
+{
+	if (!msg_len) {
+		return -EINVAL;
+	}
+
+	if (!encoder->record_count) {
+		return -ENODATA;
+	}
+
+	encoder->buf[encoder->last_record] |= NDEF_LAST_RECORD;
+
+	*msg_len = encoder->len;
+
+	return 0;
+}
@@ -3,8 +3,10 @@
  *
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
+#include <errno.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <nfc/ndef/msg_parser.h>
 #include "msg_parser_local.h"
 
 LOG_MODULE_REGISTER(nfc_ndef_parser, CONFIG_NFC_NDEF_PARSER_LOG_LEVEL);
@@ -36,6 +38,55 @@ int nfc_ndef_msg_parse(uint8_t *result_buf,
 }
 
 
+void nfc_ndef_msg_iter_init(struct nfc_ndef_msg_iter *iter,
+			    const uint8_t *raw_data,
+			    uint32_t raw_data_len)
+{
+	iter->data = raw_data;
+	iter->data_len = raw_data_len;
+	iter->offset = 0;
+	iter->record_count = 0;
+	iter->done = false;
+}
+
+int nfc_ndef_msg_iter_next(struct nfc_ndef_msg_iter *iter,
+			   struct nfc_ndef_record_view *record)
+{
+	uint32_t rec_len;
+	int err;
+
+	if (iter->done) {
+		return -ENOENT;
+	}
+
+	if (iter->offset >= iter->data_len) {
+		return -EFAULT;
+	}
+
+	rec_len = iter->data_len - iter->offset;
+
+	err = nfc_ndef_record_view_parse(record, &iter->data[iter->offset], &rec_len);
+	if (err) {
+		return err;
+	}
+
+	/* Verify the records location flags. */
+	if (iter->record_count == 0) {
+		if (!(record->location & NDEF_FIRST_RECORD)) {
+			return -EFAULT;
+		}
+	} else if (record->location & NDEF_FIRST_RECORD) {
+		return -EFAULT;
+	}
+
+	iter->offset += rec_len;
+	iter->record_count++;
+	iter->done = ((record->location & NDEF_LAST_RECORD) != 0);
+
+	return 0;
+}
+
+
 void nfc_ndef_msg_printout(const struct nfc_ndef_msg_desc *msg_desc)
 {
 	uint32_t i;
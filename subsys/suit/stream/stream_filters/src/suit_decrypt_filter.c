@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <suit_decrypt_filter.h>
 #include <suit_types.h>
@@ -17,7 +18,12 @@
 /**
  * @brief Chunk size for a single decryption operation.
  */
-#define SINGLE_CHUNK_SIZE 128
+#define SINGLE_CHUNK_SIZE CONFIG_SUIT_STREAM_FILTER_DECRYPT_CHUNK_SIZE
+
+/**
+ * @brief Size of the buffer, used to pass decrypted data to the output sink in larger blocks.
+ */
+#define OUTPUT_BUF_SIZE CONFIG_SUIT_STREAM_FILTER_DECRYPT_OUTPUT_BUF_SIZE
 
 LOG_MODULE_REGISTER(suit_decrypt_filter, CONFIG_SUIT_LOG_LEVEL);
 
@@ -29,14 +35,19 @@ struct decrypt_ctx {
 	size_t stored_tag_bytes;
 	uint8_t tag[PSA_AEAD_TAG_MAX_SIZE];
 	enum suit_cose_alg kw_alg_id;
+#if OUTPUT_BUF_SIZE > 0
+	size_t out_buf_len;
+	uint8_t out_buf[OUTPUT_BUF_SIZE];
+#endif
 	bool in_use;
 };
 
 /**
- * Only a single decryption filter can be used at a time. This is a single PSA decryption stream
- * can be used at a time.
+ * Each decryption filter uses a separate PSA decryption stream, so the number of filters used
+ * at the same time is limited by the number of contexts.
  */
-struct decrypt_ctx ctx = {0};
+static struct decrypt_ctx ctx_pool[CONFIG_SUIT_STREAM_FILTER_DECRYPT_MAX_INSTANCES];
+static K_MUTEX_DEFINE(ctx_pool_mutex);
 
 /*
  * Use pointer to volatile function, as stated in Percival's blog article at:
@@ -57,6 +68,102 @@ static void zeroize(void *buf, size_t len)
 	memset_func(buf, 0, len);
 }
 
+/**
+ * @brief Get the new, free ctx object and mark it as used
+ *
+ * @return struct decrypt_ctx* or NULL if no free ctx was found
+ */
+static struct decrypt_ctx *new_ctx_get(void)
+{
+	struct decrypt_ctx *ctx = NULL;
+
+	k_mutex_lock(&ctx_pool_mutex, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(ctx_pool); i++) {
+		if (!ctx_pool[i].in_use) {
+			ctx = &ctx_pool[i];
+			ctx->in_use = true;
+			break;
+		}
+	}
+
+	k_mutex_unlock(&ctx_pool_mutex);
+
+	return ctx;
+}
+
+/**
+ * @brief Drop the decrypted data, not yet passed to the output sink
+ */
+static void out_buf_discard(struct decrypt_ctx *decrypt_ctx)
+{
+#if OUTPUT_BUF_SIZE > 0
+	zeroize(decrypt_ctx->out_buf, decrypt_ctx->out_buf_len);
+	decrypt_ctx->out_buf_len = 0;
+#endif
+}
+
+/**
+ * @brief Pass the buffered decrypted data to the output sink
+ */
+static suit_plat_err_t out_buf_flush(struct decrypt_ctx *decrypt_ctx)
+{
+	suit_plat_err_t err = SUIT_PLAT_SUCCESS;
+
+#if OUTPUT_BUF_SIZE > 0
+	if (decrypt_ctx->out_buf_len > 0) {
+		err = decrypt_ctx->out_sink.write(decrypt_ctx->out_sink.ctx, decrypt_ctx->out_buf,
+						  decrypt_ctx->out_buf_len);
+	}
+
+	out_buf_discard(decrypt_ctx);
+#endif
+
+	return err;
+}
+
+/**
+ * @brief Write decrypted data to the output sink
+ *
+ * If the output buffer is enabled, the data is passed to the output sink in blocks of
+ * OUTPUT_BUF_SIZE bytes, so that a sink writing to the non-volatile memory receives
+ * write block aligned chunks. The remaining data is passed by the flush function.
+ */
+static suit_plat_err_t out_write(struct decrypt_ctx *decrypt_ctx, const uint8_t *buf, size_t size)
+{
+#if OUTPUT_BUF_SIZE > 0
+	suit_plat_err_t err = SUIT_PLAT_SUCCESS;
+	size_t len = 0;
+
+	while (size > 0) {
+		if ((decrypt_ctx->out_buf_len == 0) && (size >= OUTPUT_BUF_SIZE)) {
+			/* Whole blocks do not need to be copied. */
+			len = ROUND_DOWN(size, OUTPUT_BUF_SIZE);
+			err = decrypt_ctx->out_sink.write(decrypt_ctx->out_sink.ctx, buf, len);
+		} else {
+			len = MIN(size, OUTPUT_BUF_SIZE - decrypt_ctx->out_buf_len);
+			memcpy(&decrypt_ctx->out_buf[decrypt_ctx->out_buf_len], buf, len);
+			decrypt_ctx->out_buf_len += len;
+
+			if (decrypt_ctx->out_buf_len == OUTPUT_BUF_SIZE) {
+				err = out_buf_flush(decrypt_ctx);
+			}
+		}
+
+		if (err != SUIT_PLAT_SUCCESS) {
+			return err;
+		}
+
+		size -= len;
+		buf += len;
+	}
+
+	return SUIT_PLAT_SUCCESS;
+#else
+	return decrypt_ctx->out_sink.write(decrypt_ctx->out_sink.ctx, buf, size);
+#endif
+}
+
 static suit_plat_err_t erase(void *ctx)
 {
 	suit_plat_err_t res = SUIT_PLAT_SUCCESS;
@@ -66,6 +173,7 @@ static suit_plat_err_t erase(void *ctx)
 
 		decrypt_ctx->stored_tag_bytes = 0;
 		memset(decrypt_ctx->tag, 0, sizeof(decrypt_ctx->tag));
+		out_buf_discard(decrypt_ctx);
 
 		if (decrypt_ctx->out_sink.erase != NULL) {
 			res = decrypt_ctx->out_sink.erase(decrypt_ctx->out_sink.ctx);
@@ -131,8 +239,7 @@ static suit_plat_err_t write(void *ctx, const uint8_t *buf, size_t size)
 			goto cleanup;
 		}
 
-		err = decrypt_ctx->out_sink.write(decrypt_ctx->out_sink.ctx, decrypted_buf,
-						  decrypted_len);
+		err = out_write(decrypt_ctx, decrypted_buf, decrypted_len);
 
 		if (err != SUIT_PLAT_SUCCESS) {
 			LOG_ERR("Failed to write decrypted data: %d", err);
@@ -198,15 +305,19 @@ static suit_plat_err_t flush(void *ctx)
 			/* Using out_sink without a write API is blocked by the filter constructor.
 			 */
 			if (decrypted_len > 0) {
-				res = decrypt_ctx->out_sink.write(decrypt_ctx->out_sink.ctx,
-								  decrypted_buf, decrypted_len);
-				if (res != SUIT_PLAT_SUCCESS) {
-					LOG_ERR("Failed to write decrypted data: %d", res);
-					/* Revert all the changes so that
-					 * no decrypted data remains
-					 */
-					erase(decrypt_ctx);
-				}
+				res = out_write(decrypt_ctx, decrypted_buf, decrypted_len);
+			}
+
+			if (res == SUIT_PLAT_SUCCESS) {
+				res = out_buf_flush(decrypt_ctx);
+			}
+
+			if (res != SUIT_PLAT_SUCCESS) {
+				LOG_ERR("Failed to write decrypted data: %d", res);
+				/* Revert all the changes so that
+				 * no decrypted data remains
+				 */
+				erase(decrypt_ctx);
 			}
 		}
 	}
@@ -218,6 +329,7 @@ static suit_plat_err_t flush(void *ctx)
 #endif
 
 	zeroize(decrypted_buf, sizeof(decrypted_buf));
+	out_buf_discard(decrypt_ctx);
 
 	memset(&decrypt_ctx->cek_key_id, 0, sizeof(decrypt_ctx->cek_key_id));
 	zeroize(&decrypt_ctx->operation, sizeof(decrypt_ctx->operation));
@@ -266,7 +378,17 @@ static suit_plat_err_t used_storage(void *ctx, size_t *size)
 	}
 
 	if (decrypt_ctx->out_sink.used_storage != NULL) {
-		return decrypt_ctx->out_sink.used_storage(decrypt_ctx->out_sink.ctx, size);
+		suit_plat_err_t ret =
+			decrypt_ctx->out_sink.used_storage(decrypt_ctx->out_sink.ctx, size);
+
+#if OUTPUT_BUF_SIZE > 0
+		/* Decrypted data, not yet passed to the output sink */
+		if (ret == SUIT_PLAT_SUCCESS) {
+			*size += decrypt_ctx->out_buf_len;
+		}
+#endif
+
+		return ret;
 	}
 
 	return SUIT_PLAT_ERR_UNSUPPORTED;
@@ -355,69 +477,71 @@ suit_plat_err_t suit_decrypt_filter_get(struct stream_sink *in_sink,
 {
 	suit_plat_err_t ret = SUIT_PLAT_SUCCESS;
 
-	if (ctx.in_use) {
-		LOG_ERR("The decryption filter is busy");
-		return SUIT_PLAT_ERR_BUSY;
-	}
-
 	if ((enc_info == NULL) || (out_sink == NULL) || (in_sink == NULL) ||
 	    (out_sink->write == NULL) || class_id == NULL) {
 		return SUIT_PLAT_ERR_INVAL;
 	}
 
+	struct decrypt_ctx *ctx = new_ctx_get();
+
+	if (ctx == NULL) {
+		LOG_ERR("All decryption filters are busy");
+		return SUIT_PLAT_ERR_BUSY;
+	}
+
 	psa_status_t status = PSA_SUCCESS;
 	psa_algorithm_t psa_decrypt_alg_id = 0;
 
-	if (get_psa_alg_info(enc_info->enc_alg_id, &psa_decrypt_alg_id, &ctx.tag_size) !=
+	if (get_psa_alg_info(enc_info->enc_alg_id, &psa_decrypt_alg_id, &ctx->tag_size) !=
 	    SUIT_PLAT_SUCCESS) {
+		ctx->in_use = false;
 		return SUIT_PLAT_ERR_INVAL;
 	}
 
-	ctx.in_use = true;
-
 	ret = validate_key_and_unwrap_cek(enc_info->kw_alg_id, enc_info->kw_key, class_id,
-					  &ctx.cek_key_id);
+					  &ctx->cek_key_id);
 
 	if (ret != SUIT_PLAT_SUCCESS) {
-		ctx.in_use = false;
+		ctx->in_use = false;
 		return ret;
 	}
 
-	ctx.kw_alg_id = enc_info->kw_alg_id;
+	ctx->kw_alg_id = enc_info->kw_alg_id;
 
-	ctx.operation = psa_aead_operation_init();
+	ctx->operation = psa_aead_operation_init();
 
-	status = psa_aead_decrypt_setup(&ctx.operation, ctx.cek_key_id, psa_decrypt_alg_id);
+	status = psa_aead_decrypt_setup(&ctx->operation, ctx->cek_key_id, psa_decrypt_alg_id);
 
 	if (status != PSA_SUCCESS) {
 		LOG_ERR("Failed to setup decryption operation: %d", status);
-		psa_aead_abort(&ctx.operation);
-		ctx.in_use = false;
+		psa_aead_abort(&ctx->operation);
+		ctx->in_use = false;
 		return SUIT_PLAT_ERR_CRASH;
 	}
 
-	status = psa_aead_set_nonce(&ctx.operation, enc_info->IV.value, enc_info->IV.len);
+	status = psa_aead_set_nonce(&ctx->operation, enc_info->IV.value, enc_info->IV.len);
 
 	if (status != PSA_SUCCESS) {
 		LOG_ERR("Failed to set initial vector for decryption operation: %d", status);
-		psa_aead_abort(&ctx.operation);
-		ctx.in_use = false;
+		psa_aead_abort(&ctx->operation);
+		ctx->in_use = false;
 		return SUIT_PLAT_ERR_CRASH;
 	}
 
-	status = psa_aead_update_ad(&ctx.operation, enc_info->aad.value, enc_info->aad.len);
+	status = psa_aead_update_ad(&ctx->operation, enc_info->aad.value, enc_info->aad.len);
 
 	if (status != PSA_SUCCESS) {
 		LOG_ERR("Failed to pass additional data for authentication operation: %d", status);
-		psa_aead_abort(&ctx.operation);
-		ctx.in_use = false;
+		psa_aead_abort(&ctx->operation);
+		ctx->in_use = false;
 		return SUIT_PLAT_ERR_CRASH;
 	}
 
-	ctx.stored_tag_bytes = 0;
-	memcpy(&ctx.out_sink, out_sink, sizeof(struct stream_sink));
+	ctx->stored_tag_bytes = 0;
+	out_buf_discard(ctx);
+	memcpy(&ctx->out_sink, out_sink, sizeof(struct stream_sink));
 
-	in_sink->ctx = &ctx;
+	in_sink->ctx = ctx;
 
 	in_sink->write = write;
 	in_sink->erase = erase;
@@ -118,4 +118,56 @@ ZTEST(flash_driver, test_read_unaligned_address)
 	}
 }
 
+#define THROUGHPUT_CHUNK_SIZE 256
+
+static uint32_t kbps(size_t bytes, uint32_t us)
+{
+	return (uint32_t)((uint64_t)bytes * USEC_PER_SEC / 1024 / MAX(us, 1));
+}
+
+ZTEST(flash_driver, test_throughput)
+{
+	int rc;
+	uint32_t start;
+	uint32_t write_us;
+	uint32_t read_us;
+
+	/* Write and read the test area in chunks, as done when streaming an image */
+	for (int i = 0; i < TEST_AREA_WRITE_SIZE; i++) {
+		expected[i] = i * 7;
+	}
+
+	rc = flash_erase(flash_dev, TEST_AREA_START_ADDR, TEST_AREA_ERASE_SIZE);
+	zassert_equal(rc, 0, "Flash memory erase failed");
+
+	start = k_cycle_get_32();
+
+	for (off_t off = 0; off < TEST_AREA_WRITE_SIZE; off += THROUGHPUT_CHUNK_SIZE) {
+		rc = flash_write(flash_dev, TEST_AREA_START_ADDR + off, expected + off,
+				 THROUGHPUT_CHUNK_SIZE);
+		zassert_equal(rc, 0, "Cannot write to flash");
+	}
+
+	/* Reading waits for all queued writes to complete */
+	rc = flash_read(flash_dev, TEST_AREA_START_ADDR, buf, THROUGHPUT_CHUNK_SIZE);
+	zassert_equal(rc, 0, "Cannot read flash");
+
+	write_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+	start = k_cycle_get_32();
+
+	for (off_t off = 0; off < TEST_AREA_WRITE_SIZE; off += THROUGHPUT_CHUNK_SIZE) {
+		rc = flash_read(flash_dev, TEST_AREA_START_ADDR + off, buf + off,
+				THROUGHPUT_CHUNK_SIZE);
+		zassert_equal(rc, 0, "Cannot read flash");
+	}
+
+	read_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+	zassert_mem_equal(buf, expected, TEST_AREA_WRITE_SIZE, "Flash read failed");
+
+	TC_PRINT("Write: %u KiB/s, read: %u KiB/s (%u B chunks)\n",
+		 kbps(TEST_AREA_WRITE_SIZE, write_us), kbps(TEST_AREA_WRITE_SIZE, read_us),
+		 THROUGHPUT_CHUNK_SIZE);
+}
+
 ZTEST_SUITE(flash_driver, NULL, NULL, NULL, NULL, NULL);
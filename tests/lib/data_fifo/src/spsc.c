@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include <data_fifo.h>
+
+#define SPSC_BLOCKS_NUM	    8
+#define SPSC_BLOCK_SIZE	    128
+#define SPSC_ODD_BLOCKS_NUM 5
+#define BENCH_PAIRS_NUM	    3
+#define BENCH_BLOCKS_NUM    2000
+#define BENCH_BLOCK_SIZE    64
+#define BENCH_STACK_SIZE    1024
+#define BENCH_PRODUCER_PRIO 4
+#define BENCH_CONSUMER_PRIO 5
+
+static void spsc_remaining_elements(struct data_fifo *data_fifo, uint32_t num_alloced_tgt,
+				    uint32_t num_locked_tgt, uint32_t line)
+{
+	uint32_t num_alloced;
+	uint32_t num_locked;
+	int ret;
+
+	ret = data_fifo_num_used_get(data_fifo, &num_alloced, &num_locked);
+	zassert_equal(ret, 0, "data_fifo_num_used_get did not return 0");
+	zassert_equal(num_alloced, num_alloced_tgt,
+		      "num_alloced target %d actual val %d. call from line: %d", num_alloced_tgt,
+		      num_alloced, line);
+	zassert_equal(num_locked, num_locked_tgt,
+		      "num_locked target %d actual val %d. call from line: %d", num_locked_tgt,
+		      num_locked, line);
+}
+
+ZTEST(suite_data_fifo_spsc, test_spsc_put_get_ok)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, SPSC_BLOCKS_NUM, SPSC_BLOCK_SIZE);
+
+	int ret;
+	uint8_t *data_ptr;
+	void *data_ptr_read;
+	size_t data_size;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	/* Run through the ring several times to cover index wrap-around */
+	for (uint32_t i = 0; i < SPSC_BLOCKS_NUM * 3; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+		memset(data_ptr, (uint8_t)i, i % SPSC_BLOCK_SIZE + 1);
+
+		spsc_remaining_elements(&data_fifo, 1, 0, __LINE__);
+
+		ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, i % SPSC_BLOCK_SIZE + 1);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+
+		spsc_remaining_elements(&data_fifo, 1, 1, __LINE__);
+
+		ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size,
+							K_NO_WAIT);
+		zassert_equal(ret, 0, "last_filled_get did not return 0");
+		zassert_equal_ptr(data_ptr_read, data_ptr, "wrong block returned");
+		zassert_equal(data_size, i % SPSC_BLOCK_SIZE + 1, "data size incorrect");
+		zassert_equal(((uint8_t *)data_ptr_read)[0], (uint8_t)i, "data incorrect");
+
+		spsc_remaining_elements(&data_fifo, 1, 0, __LINE__);
+
+		data_fifo_block_free(&data_fifo, data_ptr_read);
+
+		spsc_remaining_elements(&data_fifo, 0, 0, __LINE__);
+	}
+}
+
+ZTEST(suite_data_fifo_spsc, test_spsc_put_too_many)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, SPSC_BLOCKS_NUM, SPSC_BLOCK_SIZE);
+
+	int ret;
+	uint8_t *data_ptr;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	for (uint32_t i = 0; i < SPSC_BLOCKS_NUM; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+		ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, 1);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+	}
+
+	spsc_remaining_elements(&data_fifo, SPSC_BLOCKS_NUM, SPSC_BLOCKS_NUM, __LINE__);
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "first_vacant_get did not return -ENOMEM");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_MSEC(1));
+	zassert_equal(ret, -EAGAIN, "first_vacant_get did not return -EAGAIN");
+
+	ret = data_fifo_empty(&data_fifo);
+	zassert_equal(ret, 0, "empty did not return 0");
+
+	spsc_remaining_elements(&data_fifo, 0, 0, __LINE__);
+}
+
+ZTEST(suite_data_fifo_spsc, test_spsc_get_empty)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, SPSC_BLOCKS_NUM, SPSC_BLOCK_SIZE);
+
+	int ret;
+	void *data_ptr_read;
+	size_t data_size;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size, K_NO_WAIT);
+	zassert_equal(ret, -ENOMSG, "last_filled_get did not return -ENOMSG");
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size, K_MSEC(1));
+	zassert_equal(ret, -EAGAIN, "last_filled_get did not return -EAGAIN");
+}
+
+ZTEST(suite_data_fifo_spsc, test_spsc_lock_out_of_order)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, SPSC_BLOCKS_NUM, SPSC_BLOCK_SIZE);
+
+	int ret;
+	uint8_t *data_ptr_one;
+	uint8_t *data_ptr_two;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr_one, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr_two, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr_two, 1);
+	zassert_equal(ret, -ESPIPE, "block_lock did not return -ESPIPE");
+
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr_one, 1);
+	zassert_equal(ret, 0, "block_lock did not return 0");
+
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr_two, 1);
+	zassert_equal(ret, 0, "block_lock did not return 0");
+
+	spsc_remaining_elements(&data_fifo, 2, 2, __LINE__);
+}
+
+ZTEST(suite_data_fifo_spsc, test_spsc_wrap_odd_size)
+{
+	/* Element count that does not divide the index range */
+	DATA_FIFO_SPSC_DEFINE(data_fifo, SPSC_ODD_BLOCKS_NUM, SPSC_BLOCK_SIZE);
+
+	int ret;
+	uint8_t *data_ptr;
+	void *data_ptr_read;
+	size_t data_size;
+	uint32_t written = 0;
+	uint32_t read = 0;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	/* Keep the ring partly filled while the indices wrap several times */
+	while (read < SPSC_ODD_BLOCKS_NUM * 7) {
+		while (written - read < SPSC_ODD_BLOCKS_NUM - 1) {
+			ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr,
+								 K_NO_WAIT);
+			zassert_equal(ret, 0, "first_vacant_get did not return 0");
+			data_ptr[0] = (uint8_t)written;
+
+			ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, 1);
+			zassert_equal(ret, 0, "block_lock did not return 0");
+			written++;
+		}
+
+		spsc_remaining_elements(&data_fifo, SPSC_ODD_BLOCKS_NUM - 1,
+					SPSC_ODD_BLOCKS_NUM - 1, __LINE__);
+
+		for (uint32_t i = 0; i < 2; i++) {
+			ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read,
+								&data_size, K_NO_WAIT);
+			zassert_equal(ret, 0, "last_filled_get did not return 0");
+			zassert_equal(((uint8_t *)data_ptr_read)[0], (uint8_t)read,
+				      "data incorrect");
+			data_fifo_block_free(&data_fifo, data_ptr_read);
+			read++;
+		}
+	}
+
+	/* Fill the ring completely after wrapping */
+	while (written - read < SPSC_ODD_BLOCKS_NUM) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+		written++;
+	}
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "first_vacant_get did not return -ENOMEM");
+}
+
+/* Contention benchmark: several producer/consumer thread pairs, each working on its own FIFO.
+ * With the old file-scope lock all pairs serialized on the same spinlock.
+ */
+DATA_FIFO_DEFINE(bench_fifo_0, SPSC_BLOCKS_NUM, BENCH_BLOCK_SIZE);
+DATA_FIFO_DEFINE(bench_fifo_1, SPSC_BLOCKS_NUM, BENCH_BLOCK_SIZE);
+DATA_FIFO_DEFINE(bench_fifo_2, SPSC_BLOCKS_NUM, BENCH_BLOCK_SIZE);
+DATA_FIFO_SPSC_DEFINE(bench_spsc_fifo_0, SPSC_BLOCKS_NUM, BENCH_BLOCK_SIZE);
+DATA_FIFO_SPSC_DEFINE(bench_spsc_fifo_1, SPSC_BLOCKS_NUM, BENCH_BLOCK_SIZE);
+DATA_FIFO_SPSC_DEFINE(bench_spsc_fifo_2, SPSC_BLOCKS_NUM, BENCH_BLOCK_SIZE);
+
+static struct data_fifo *const bench_fifos[] = {&bench_fifo_0, &bench_fifo_1, &bench_fifo_2};
+static struct data_fifo *const bench_spsc_fifos[] = {&bench_spsc_fifo_0, &bench_spsc_fifo_1,
+						     &bench_spsc_fifo_2};
+
+BUILD_ASSERT(ARRAY_SIZE(bench_fifos) == BENCH_PAIRS_NUM);
+BUILD_ASSERT(ARRAY_SIZE(bench_spsc_fifos) == BENCH_PAIRS_NUM);
+
+K_THREAD_STACK_ARRAY_DEFINE(producer_stacks, BENCH_PAIRS_NUM, BENCH_STACK_SIZE);
+K_THREAD_STACK_ARRAY_DEFINE(consumer_stacks, BENCH_PAIRS_NUM, BENCH_STACK_SIZE);
+static struct k_thread producer_threads[BENCH_PAIRS_NUM];
+static struct k_thread consumer_threads[BENCH_PAIRS_NUM];
+static uint32_t consumer_errors[BENCH_PAIRS_NUM];
+
+static void bench_producer(void *p1, void *p2, void *p3)
+{
+	struct data_fifo *data_fifo = p1;
+	uint8_t *data_ptr;
+	int ret;
+
+	for (uint32_t i = 0; i < BENCH_BLOCKS_NUM; i++) {
+		ret = data_fifo_pointer_first_vacant_get(data_fifo, (void **)&data_ptr, K_FOREVER);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+		memcpy(data_ptr, &i, sizeof(i));
+
+		ret = data_fifo_block_lock(data_fifo, (void **)&data_ptr, sizeof(i));
+		zassert_equal(ret, 0, "block_lock did not return 0");
+	}
+}
+
+static void bench_consumer(void *p1, void *p2, void *p3)
+{
+	struct data_fifo *data_fifo = p1;
+	uint32_t *errors = p2;
+	void *data_ptr;
+	size_t data_size;
+	uint32_t val;
+	int ret;
+
+	for (uint32_t i = 0; i < BENCH_BLOCKS_NUM; i++) {
+		ret = data_fifo_pointer_last_filled_get(data_fifo, &data_ptr, &data_size,
+							K_FOREVER);
+		zassert_equal(ret, 0, "last_filled_get did not return 0");
+
+		memcpy(&val, data_ptr, sizeof(val));
+		if (val != i || data_size != sizeof(val)) {
+			(*errors)++;
+		}
+
+		data_fifo_block_free(data_fifo, data_ptr);
+	}
+}
+
+static uint32_t bench_run(struct data_fifo *const *fifos, const char *name)
+{
+	uint32_t start;
+	uint32_t cycles;
+	int ret;
+
+	for (int i = 0; i < BENCH_PAIRS_NUM; i++) {
+		if (!data_fifo_state(fifos[i])) {
+			ret = data_fifo_init(fifos[i]);
+			zassert_equal(ret, 0, "init did not return 0");
+		}
+
+		consumer_errors[i] = 0;
+	}
+
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < BENCH_PAIRS_NUM; i++) {
+		k_thread_create(&consumer_threads[i], consumer_stacks[i], BENCH_STACK_SIZE,
+				bench_consumer, fifos[i], &consumer_errors[i], NULL,
+				BENCH_CONSUMER_PRIO, 0, K_NO_WAIT);
+		k_thread_create(&producer_threads[i], producer_stacks[i], BENCH_STACK_SIZE,
+				bench_producer, fifos[i], NULL, NULL, BENCH_PRODUCER_PRIO, 0,
+				K_NO_WAIT);
+	}
+
+	for (int i = 0; i < BENCH_PAIRS_NUM; i++) {
+		k_thread_join(&producer_threads[i], K_FOREVER);
+		k_thread_join(&consumer_threads[i], K_FOREVER);
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	for (int i = 0; i < BENCH_PAIRS_NUM; i++) {
+		zassert_equal(consumer_errors[i], 0, "%s: pair %d received corrupt data", name, i);
+		ret = data_fifo_uninit(fifos[i]);
+		zassert_equal(ret, 0, "uninit did not return 0");
+	}
+
+	TC_PRINT("%s: %d pairs x %d blocks in %u us (%u cycles/block)\n", name, BENCH_PAIRS_NUM,
+		 BENCH_BLOCKS_NUM, k_cyc_to_us_floor32(cycles),
+		 cycles / (BENCH_PAIRS_NUM * BENCH_BLOCKS_NUM));
+
+	return cycles;
+}
+
+ZTEST(suite_data_fifo_spsc, test_spsc_contention_benchmark)
+{
+	bench_run(bench_fifos, "slab/msgq");
+	bench_run(bench_spsc_fifos, "spsc");
+}
+
+ZTEST_SUITE(suite_data_fifo_spsc, NULL, NULL, NULL, NULL, NULL);
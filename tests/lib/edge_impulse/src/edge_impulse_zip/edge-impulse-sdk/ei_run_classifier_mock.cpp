@@ -8,17 +8,28 @@
 #include <ei_run_classifier.h>
 
 static size_t prediction_idx;
+static size_t slice_cnt;
 
 void ei_run_classifier_mock_init(void)
 {
 	prediction_idx = 0;
+	slice_cnt = 0;
+}
+
+size_t ei_run_classifier_mock_slice_cnt_take(void)
+{
+	size_t cnt = slice_cnt;
+
+	slice_cnt = 0;
+
+	return cnt;
 }
 
 /* Input data must be ascending sequence of floats. Difference between
  * subsequent elements of input sequence equals 1. The first element
  * has value defined by ei_test_params.h (depends on current prediction idx).
  */
-static void verify_data_read(signal_t *signal, const size_t prediction_idx,
+static void verify_data_read(signal_t *signal, const float first_value,
 			     const size_t chunk_size)
 {
 	size_t data_size = signal->total_length;
@@ -37,7 +48,7 @@ static void verify_data_read(signal_t *signal, const size_t prediction_idx,
 		zassert_ok(err, "get_data returned an error");
 	}
 
-	float value = EI_MOCK_GEN_FIRST_INPUT(prediction_idx);;
+	float value = first_value;
 
 	for (size_t off = 0; off < data_size; off++) {
 		zassert_within(data_buf[off], value, FLOAT_CMP_EPSILON,
@@ -46,17 +57,42 @@ static void verify_data_read(signal_t *signal, const size_t prediction_idx,
 	}
 }
 
+static void fill_results(ei_impulse_result_t *result, const size_t prediction_idx)
+{
+	/* Classification results. */
+	result->anomaly = EI_MOCK_GEN_ANOMALY(prediction_idx);
+
+	size_t res_idx = EI_MOCK_GEN_LABEL_IDX(prediction_idx);
+	const float value_selected = EI_MOCK_GEN_VALUE(prediction_idx);
+	const float value_others = EI_MOCK_GEN_VALUE_OTHERS(prediction_idx);
+
+	zassert_true(value_selected < 1.0, "Wrong value of selected label.");
+	zassert_true(value_selected > value_others, "Wrong values");
+
+	for (size_t i = 0; i < EI_CLASSIFIER_LABEL_COUNT; i++) {
+		result->classification[i].label = ei_classifier_inferencing_categories[i];
+		result->classification[i].value =
+			(i == res_idx) ? (value_selected) : (value_others);
+	}
+
+	zassert_false(strcmp(EI_MOCK_GEN_LABEL(prediction_idx),
+		      ei_classifier_inferencing_categories[res_idx]),
+		      "Wrong label");
+}
+
 EI_IMPULSE_ERROR run_classifier(signal_t *signal,
 				ei_impulse_result_t *result,
 				bool debug)
 {
 	ARG_UNUSED(debug);
 
+	const float first_value = EI_MOCK_GEN_FIRST_INPUT(prediction_idx);
+
 	/* Test getting data. */
-	verify_data_read(signal, prediction_idx, 1);
-	verify_data_read(signal, prediction_idx,
+	verify_data_read(signal, first_value, 1);
+	verify_data_read(signal, first_value,
 			 EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME);
-	verify_data_read(signal, prediction_idx,
+	verify_data_read(signal, first_value,
 			 EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE);
 
 	/* Busy wait for predefined amount of time to simulate calculations. */
@@ -67,27 +103,55 @@ EI_IMPULSE_ERROR run_classifier(signal_t *signal,
 	result->timing.classification = EI_MOCK_GEN_CLASSIFICATION_TIME(prediction_idx);
 	result->timing.anomaly = EI_MOCK_GEN_ANOMALY_TIME(prediction_idx);
 
-	/* Classification results. */
-	result->anomaly = EI_MOCK_GEN_ANOMALY(prediction_idx);
+	fill_results(result, prediction_idx);
 
-	size_t res_idx = EI_MOCK_GEN_LABEL_IDX(prediction_idx);
-	const float value_selected = EI_MOCK_GEN_VALUE(prediction_idx);
-	const float value_others = EI_MOCK_GEN_VALUE_OTHERS(prediction_idx);
+	prediction_idx++;
 
-	zassert_true(value_selected < 1.0, "Wrong value of selected label.");
-	zassert_true(value_selected > value_others, "Wrong values");
+	return EI_IMPULSE_OK;
+}
 
-	for (size_t i = 0; i < EI_CLASSIFIER_LABEL_COUNT; i++) {
-		result->classification[i].label = ei_classifier_inferencing_categories[i];
-		result->classification[i].value =
-			(i == res_idx) ? (value_selected) : (value_others);
-	}
+void run_classifier_init(void)
+{
+}
 
-	zassert_false(strcmp(EI_MOCK_GEN_LABEL(prediction_idx),
-		      ei_classifier_inferencing_categories[res_idx]),
-		      "Wrong label");
+EI_IMPULSE_ERROR run_classifier_continuous(signal_t *signal,
+					   ei_impulse_result_t *result,
+					   bool debug,
+					   bool enable_maf)
+{
+	ARG_UNUSED(debug);
 
-	prediction_idx++;
+	zassert_false(enable_maf, "Moving average filter should not be used");
+	zassert_equal(signal->total_length, EI_MOCK_SLICE_SIZE, "Wrong slice size");
+
+	float first_value;
+	int err = signal->get_data(0, 1, &first_value);
+
+	zassert_ok(err, "get_data returned an error");
+
+	/* Test getting data. */
+	verify_data_read(signal, first_value, 1);
+	verify_data_read(signal, first_value,
+			 EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME);
+	verify_data_read(signal, first_value, EI_MOCK_SLICE_SIZE);
+
+	/* Busy wait for predefined amount of time to simulate calculations. */
+	k_busy_wait(EI_MOCK_BUSY_WAIT_TIME / EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW);
+
+	/* Timing results. */
+	result->timing.dsp = EI_MOCK_SLICE_DSP_TIME;
+	result->timing.classification = EI_MOCK_SLICE_CLASSIFICATION_TIME;
+	result->timing.anomaly = EI_MOCK_SLICE_ANOMALY_TIME;
+
+	/* The results are generated as if the slice was the last one in the
+	 * input window. The first input of the window identifies the prediction.
+	 */
+	int window_start = (int)first_value + EI_MOCK_SLICE_SIZE -
+			   EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE;
+
+	fill_results(result, MAX(window_start, 0) / EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME);
+
+	slice_cnt++;
 
 	return EI_IMPULSE_OK;
 }
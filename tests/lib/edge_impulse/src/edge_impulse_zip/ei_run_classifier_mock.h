@@ -9,4 +9,7 @@
 
 void ei_run_classifier_mock_init(void);
 
+/* Get and clear the number of slices processed by the continuous classifier. */
+size_t ei_run_classifier_mock_slice_cnt_take(void);
+
 #endif /* _EI_RUN_CLASSIFIER_MOCK_H_ */
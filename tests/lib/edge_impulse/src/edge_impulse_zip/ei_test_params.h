@@ -18,6 +18,7 @@
 #define EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE	300
 #define EI_CLASSIFIER_HAS_ANOMALY		1
 #define EI_CLASSIFIER_FREQUENCY			60
+#define EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW	4
 
 /* Mocked results. */
 static const char * const ei_classifier_inferencing_categories[] = {
@@ -41,6 +42,14 @@ static const char * const ei_classifier_inferencing_categories[] = {
 #define EI_MOCK_GEN_CLASSIFICATION_TIME(PRED_IDX)	((int)(PRED_IDX) + 2)
 #define EI_MOCK_GEN_ANOMALY_TIME(PRED_IDX)		((int)(PRED_IDX) + 3)
 
+/* Continuous classification processes the input window in slices. */
+#define EI_MOCK_SLICE_SIZE	(EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE / \
+				 EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW)
+
+#define EI_MOCK_SLICE_DSP_TIME				1
+#define EI_MOCK_SLICE_CLASSIFICATION_TIME		2
+#define EI_MOCK_SLICE_ANOMALY_TIME			3
+
 /* Data processing is simulated as busy wait. */
 #define EI_MOCK_BUSY_WAIT_TIME				(100U)
 
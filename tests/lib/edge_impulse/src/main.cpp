@@ -21,6 +21,7 @@ static size_t timer_fn_calls;
 static atomic_t rerun_in_cb;
 
 static size_t prediction_idx;
+static size_t slice_cnt;
 /* Semaphore is used to wait until ei_wrapper returns prediction results. */
 static K_SEM_DEFINE(test_sem, 0, 1)
 
@@ -103,10 +104,22 @@ static void verify_result(const size_t pred_idx)
 	err = ei_wrapper_get_timing(&dsp_time, &classification_time, &anomaly_time);
 	zassert_ok(err, "ei_wrapper_get_timing returned an error");
 
-	zassert_equal(dsp_time, EI_MOCK_GEN_DSP_TIME(pred_idx), "Wrong DSP time");
-	zassert_equal(classification_time, EI_MOCK_GEN_CLASSIFICATION_TIME(pred_idx),
-		      "Wrong classification time");
-	zassert_equal(anomaly_time, EI_MOCK_GEN_ANOMALY_TIME(pred_idx), "Wrong anomaly time");
+	if (IS_ENABLED(CONFIG_EI_WRAPPER_CONTINUOUS)) {
+		/* Execution times are summed over the processed slices. */
+		slice_cnt = ei_run_classifier_mock_slice_cnt_take();
+
+		zassert_equal(dsp_time, slice_cnt * EI_MOCK_SLICE_DSP_TIME, "Wrong DSP time");
+		zassert_equal(classification_time, slice_cnt * EI_MOCK_SLICE_CLASSIFICATION_TIME,
+			      "Wrong classification time");
+		zassert_equal(anomaly_time, slice_cnt * EI_MOCK_SLICE_ANOMALY_TIME,
+			      "Wrong anomaly time");
+	} else {
+		zassert_equal(dsp_time, EI_MOCK_GEN_DSP_TIME(pred_idx), "Wrong DSP time");
+		zassert_equal(classification_time, EI_MOCK_GEN_CLASSIFICATION_TIME(pred_idx),
+			      "Wrong classification time");
+		zassert_equal(anomaly_time, EI_MOCK_GEN_ANOMALY_TIME(pred_idx),
+			      "Wrong anomaly time");
+	}
 }
 
 static void run_basic_setup(const size_t pred_idx,
@@ -347,6 +360,42 @@ ZTEST(suite0, test_sliding_window)
 	}
 }
 
+ZTEST(suite0, test_continuous)
+{
+	const static size_t slice_frames = EI_MOCK_SLICE_SIZE / EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME;
+	const static size_t loop_cnt = 20;
+	size_t total_slice_cnt = 0;
+	int err;
+
+	if (!IS_ENABLED(CONFIG_EI_WRAPPER_CONTINUOUS)) {
+		ztest_test_skip();
+	}
+
+	err = add_input_data(prediction_idx, (loop_cnt - 1) * slice_frames);
+	zassert_ok(err, "Cannot add input data");
+
+	for (size_t i = 0; i < loop_cnt; i++) {
+		size_t frame_shift = (i == 0) ? (0) : (slice_frames);
+
+		/* Prediction index is identified by the first input of the window. */
+		prediction_idx += frame_shift - ((i == 0) ? (0) : (1));
+
+		err = ei_wrapper_start_prediction(0, frame_shift);
+		zassert_ok(err, "Cannot start prediction");
+		err = k_sem_take(&test_sem, EI_TEST_SEM_TIMEOUT);
+		zassert_ok(err, "Cannot take semaphore");
+
+		/* Only the slice shifted into the window is processed. */
+		zassert_equal(slice_cnt,
+			      (i == 0) ? (EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW) : (1),
+			      "Wrong number of processed slices");
+		total_slice_cnt += slice_cnt;
+	}
+
+	TC_PRINT("%zu predictions: %zu slices processed, %zu without continuous mode\n",
+		 loop_cnt, total_slice_cnt, loop_cnt * EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW);
+}
+
 ZTEST(suite0, test_data_after_start)
 {
 	static const size_t loop_cnt = 10;
@@ -450,6 +499,7 @@ static void setup_fn(void *unused)
 	bool cancelled;
 	int err = ei_wrapper_clear_data(&cancelled);
 	prediction_idx = 0;
+	slice_cnt = 0;
 	ei_run_classifier_mock_init();
 
 	zassert_false(cancelled, "Prediction was not cancelled");
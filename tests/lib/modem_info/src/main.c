@@ -12,6 +12,8 @@
 #include <zephyr/device.h>
 
 #include "modem_info.h"
+#include <modem/at_monitor.h>
+#include <modem/nrf_modem_lib.h>
 
 #include <zephyr/fff.h>
 
@@ -23,6 +25,7 @@ DEFINE_FFF_GLOBALS;
 FAKE_VALUE_FUNC(int, nrf_modem_at_notif_handler_set, nrf_modem_at_notif_handler_t);
 FAKE_VALUE_FUNC_VARARG(int, nrf_modem_at_scanf, const char *, const char *, ...);
 FAKE_VALUE_FUNC_VARARG(int, nrf_modem_at_cmd, void *, size_t, const char *, ...);
+FAKE_VALUE_FUNC_VARARG(int, nrf_modem_at_printf, const char *, ...);
 
 #define FW_UUID_SIZE 37
 #define SVN_SIZE 3
@@ -40,6 +43,18 @@ FAKE_VALUE_FUNC_VARARG(int, nrf_modem_at_cmd, void *, size_t, const char *, ...)
 #define EXAMPLE_SHORT_OPERATOR_NAME "OP"
 #define EXAMPLE_SNR 47
 
+/* Time modelled for each AT command round trip */
+#define AT_ROUND_TRIP_US 2000
+
+#define EXAMPLE_SNAPSHOT_ALL (MODEM_INFO_SNAPSHOT_RSRP | MODEM_INFO_SNAPSHOT_SNR | \
+			      MODEM_INFO_SNAPSHOT_BAND | MODEM_INFO_SNAPSHOT_OPERATOR | \
+			      MODEM_INFO_SNAPSHOT_TEMP | MODEM_INFO_SNAPSHOT_BATTERY | \
+			      MODEM_INFO_SNAPSHOT_CONN_STATS | MODEM_INFO_SNAPSHOT_IP_ADDRESS)
+#define EXAMPLE_SNAPSHOT_RSRP_IDX 53
+#define EXAMPLE_SNAPSHOT_TX_KBYTES 12
+#define EXAMPLE_SNAPSHOT_RX_KBYTES 34
+#define EXAMPLE_SNAPSHOT_IP "10.0.0.1"
+
 #define SHORT_OP_NAME_SIZE_WITHOUT_NULL_TERM 64
 BUILD_ASSERT(SHORT_OP_NAME_SIZE_WITHOUT_NULL_TERM == (MODEM_INFO_SHORT_OP_NAME_SIZE - 1),
 	     "Short operator size macros must match");
@@ -258,10 +273,136 @@ static int nrf_modem_at_scanf_custom_snr(const char *cmd, const char *fmt, va_li
 	return 1;
 }
 
+/* Responses of the modem to the commands used by the health report */
+static const struct {
+	const char *cmd;
+	const char *rsp;
+} example_rsps[] = {
+	{ "%XMONITOR", "%XMONITOR: 1,\"Operator\",\"" EXAMPLE_SHORT_OPERATOR_NAME "\",\"24201\","
+		       "\"0901\",7," STRINGIFY(EXAMPLE_BAND) ",\"00A0B1C2\",194,6400,"
+		       STRINGIFY(EXAMPLE_SNAPSHOT_RSRP_IDX) "," STRINGIFY(EXAMPLE_SNR) ",\"\","
+		       "\"11100000\",\"00010011\",\"01001001\"\r\n" },
+	{ "%XTEMP?", "%XTEMP: " STRINGIFY(EXAMPLE_TEMP) "\r\n" },
+	{ "%XVBAT", "%XVBAT: " STRINGIFY(EXAMPLE_VBAT) "\r\n" },
+	{ "%XCONNSTAT?", "%XCONNSTAT: 0,0," STRINGIFY(EXAMPLE_SNAPSHOT_TX_KBYTES) ","
+			 STRINGIFY(EXAMPLE_SNAPSHOT_RX_KBYTES) ",1500,1000\r\n" },
+	{ "+CGDCONT?", "+CGDCONT: 0,\"IP\",\"internet\",\"" EXAMPLE_SNAPSHOT_IP "\",0,0\r\n"
+		       "+CGDCONT: 1,\"IP\",\"\",\"\",0,0\r\n" },
+	{ "+CESQ", "+CESQ: 99,99,255,255,31," STRINGIFY(EXAMPLE_SNAPSHOT_RSRP_IDX) "\r\n" },
+	{ "%XSNRSQ?", "%XSNRSQ: " STRINGIFY(EXAMPLE_SNR) ",0,0\r\n" },
+	{ "%XCBAND", "%XCBAND: " STRINGIFY(EXAMPLE_BAND) "\r\n" },
+};
+
+static const char *example_rsp_get(const char *cmd, size_t len)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(example_rsps); i++) {
+		if ((strlen(example_rsps[i].cmd) == len) &&
+		    !strncmp(example_rsps[i].cmd, cmd, len)) {
+			return example_rsps[i].rsp;
+		}
+	}
+
+	TEST_FAIL_MESSAGE("Unexpected AT command");
+
+	return NULL;
+}
+
+static int nrf_modem_at_scanf_custom_example(const char *cmd, const char *fmt, va_list args)
+{
+	TEST_ASSERT_EQUAL_STRING_LEN("AT", cmd, 2);
+
+	k_busy_wait(AT_ROUND_TRIP_US);
+
+	return vsscanf(example_rsp_get(cmd + 2, strlen(cmd + 2)), fmt, args);
+}
+
+/* Command which the modem rejects, if any */
+static const char *at_cmd_failing;
+
+/* Responds to a command line with chained commands, like the modem. */
+static int nrf_modem_at_cmd_custom_example(void *buf, size_t len, const char *fmt, va_list args)
+{
+	TEST_ASSERT_EQUAL_STRING("%s", fmt);
+
+	const char *cmd = va_arg(args, const char *);
+	char *rsp = buf;
+
+	TEST_ASSERT_EQUAL_STRING_LEN("AT", cmd, 2);
+	cmd += 2;
+	rsp[0] = '\0';
+
+	k_busy_wait(AT_ROUND_TRIP_US);
+
+	while (*cmd) {
+		size_t cmd_len = strcspn(cmd, ";");
+
+		/* The modem does not run the commands after a failing one. */
+		if (at_cmd_failing && (strlen(at_cmd_failing) == cmd_len) &&
+		    !strncmp(at_cmd_failing, cmd, cmd_len)) {
+			strncat(rsp, "ERROR\r\n", len - strlen(rsp) - 1);
+			return 65536; /* Modem respond "ERROR" */
+		}
+
+		strncat(rsp, example_rsp_get(cmd, cmd_len), len - strlen(rsp) - 1);
+
+		cmd += cmd_len;
+		if (*cmd == ';') {
+			cmd++;
+		}
+	}
+
+	strncat(rsp, "OK\r\n", len - strlen(rsp) - 1);
+
+	return 0;
+}
+
+static int nrf_modem_at_cmd_custom_error(void *buf, size_t len, const char *fmt, va_list args)
+{
+	return -NRF_EFAULT;
+}
+
+static char at_cmd_last[128];
+
+static int nrf_modem_at_cmd_custom_not_registered(void *buf, size_t len, const char *fmt,
+						  va_list args)
+{
+	strncpy(at_cmd_last, va_arg(args, const char *), sizeof(at_cmd_last) - 1);
+	strncpy(buf, "%XMONITOR: 2\r\nOK\r\n", len);
+
+	return 0;
+}
+
+static void at_notif_dispatch(const char *notif)
+{
+	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
+		if (!e->flags.paused && (!e->filter || strstr(notif, e->filter))) {
+			e->handler(notif);
+		}
+	}
+}
+
+static void snapshot_verify(const struct modem_info_snapshot *snapshot)
+{
+	TEST_ASSERT_EQUAL(EXAMPLE_SNAPSHOT_ALL, snapshot->valid);
+	TEST_ASSERT_EQUAL(RSRP_IDX_TO_DBM(EXAMPLE_SNAPSHOT_RSRP_IDX), snapshot->rsrp);
+	TEST_ASSERT_EQUAL(EXAMPLE_SNR - SNR_OFFSET_VAL, snapshot->snr);
+	TEST_ASSERT_EQUAL(EXAMPLE_BAND, snapshot->band);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_SHORT_OPERATOR_NAME, snapshot->operator_name);
+	TEST_ASSERT_EQUAL(EXAMPLE_TEMP, snapshot->temperature);
+	TEST_ASSERT_EQUAL(EXAMPLE_VBAT, snapshot->battery_voltage);
+	TEST_ASSERT_EQUAL(EXAMPLE_SNAPSHOT_TX_KBYTES, snapshot->tx_kbytes);
+	TEST_ASSERT_EQUAL(EXAMPLE_SNAPSHOT_RX_KBYTES, snapshot->rx_kbytes);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_SNAPSHOT_IP, snapshot->ip_address);
+}
+
 void setUp(void)
 {
 	RESET_FAKE(nrf_modem_at_notif_handler_set);
 	RESET_FAKE(nrf_modem_at_scanf);
+	RESET_FAKE(nrf_modem_at_cmd);
+	RESET_FAKE(nrf_modem_at_printf);
+
+	at_cmd_failing = NULL;
 }
 
 void tearDown(void)
@@ -796,6 +937,184 @@ void test_modem_info_get_snr_success(void)
 	TEST_ASSERT_EQUAL(EXAMPLE_SNR - SNR_OFFSET_VAL, snr);
 }
 
+void test_modem_info_snapshot_get_invalid(void)
+{
+	struct modem_info_snapshot snapshot;
+
+	TEST_ASSERT_EQUAL(-EINVAL, modem_info_snapshot_get(0, false, &snapshot));
+	TEST_ASSERT_EQUAL(-EINVAL, modem_info_snapshot_get(EXAMPLE_SNAPSHOT_ALL, false, NULL));
+	TEST_ASSERT_EQUAL(0, nrf_modem_at_cmd_fake.call_count);
+}
+
+void test_modem_info_snapshot_get_at_cmd_error(void)
+{
+	struct modem_info_snapshot snapshot;
+
+	nrf_modem_at_cmd_fake.custom_fake = nrf_modem_at_cmd_custom_error;
+
+	int ret = modem_info_snapshot_get(EXAMPLE_SNAPSHOT_ALL, false, &snapshot);
+
+	TEST_ASSERT_EQUAL(-EIO, ret);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_cmd_fake.call_count);
+	TEST_ASSERT_EQUAL(0, snapshot.valid);
+}
+
+void test_modem_info_snapshot_get_success(void)
+{
+	struct modem_info_snapshot snapshot;
+
+	nrf_modem_at_cmd_fake.custom_fake = nrf_modem_at_cmd_custom_example;
+
+	int ret = modem_info_snapshot_get(EXAMPLE_SNAPSHOT_ALL, false, &snapshot);
+
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_cmd_fake.call_count);
+	snapshot_verify(&snapshot);
+}
+
+void test_modem_info_snapshot_get_cmd_failed(void)
+{
+	struct modem_info_snapshot snapshot;
+
+	nrf_modem_at_cmd_fake.custom_fake = nrf_modem_at_cmd_custom_example;
+	at_cmd_failing = "%XCONNSTAT?";
+
+	int ret = modem_info_snapshot_get(EXAMPLE_SNAPSHOT_ALL, false, &snapshot);
+
+	/* Only the parameters of the failing command are missing. */
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(EXAMPLE_SNAPSHOT_ALL & ~MODEM_INFO_SNAPSHOT_CONN_STATS, snapshot.valid);
+	TEST_ASSERT_EQUAL(RSRP_IDX_TO_DBM(EXAMPLE_SNAPSHOT_RSRP_IDX), snapshot.rsrp);
+	TEST_ASSERT_EQUAL(EXAMPLE_TEMP, snapshot.temperature);
+	TEST_ASSERT_EQUAL(EXAMPLE_VBAT, snapshot.battery_voltage);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_SNAPSHOT_IP, snapshot.ip_address);
+
+	/* The command line, then each of the five commands alone. */
+	TEST_ASSERT_EQUAL(6, nrf_modem_at_cmd_fake.call_count);
+}
+
+void test_modem_info_snapshot_cesq_subscribe(void)
+{
+	STRUCT_SECTION_FOREACH(nrf_modem_lib_init_cb, e) {
+		e->callback(0, e->context);
+	}
+
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_printf_fake.call_count);
+	TEST_ASSERT_EQUAL_STRING("AT%%CESQ=1", nrf_modem_at_printf_fake.arg0_val);
+}
+
+void test_modem_info_snapshot_get_not_registered(void)
+{
+	struct modem_info_snapshot snapshot;
+
+	nrf_modem_at_cmd_fake.custom_fake = nrf_modem_at_cmd_custom_not_registered;
+
+	int ret = modem_info_snapshot_get(MODEM_INFO_SNAPSHOT_RSRP | MODEM_INFO_SNAPSHOT_BAND,
+					  false, &snapshot);
+
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_cmd_fake.call_count);
+	TEST_ASSERT_EQUAL_STRING("AT%XMONITOR", at_cmd_last);
+	TEST_ASSERT_EQUAL(0, snapshot.valid);
+}
+
+void test_modem_info_snapshot_get_cached(void)
+{
+	struct modem_info_snapshot snapshot;
+
+	nrf_modem_at_cmd_fake.custom_fake = nrf_modem_at_cmd_custom_example;
+
+	/* Refresh the cache. */
+	int ret = modem_info_snapshot_get(EXAMPLE_SNAPSHOT_ALL, false, &snapshot);
+
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_cmd_fake.call_count);
+
+	ret = modem_info_snapshot_get(EXAMPLE_SNAPSHOT_ALL, true, &snapshot);
+
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_cmd_fake.call_count);
+	snapshot_verify(&snapshot);
+
+	/* RSRP notifications keep the cached value fresh. */
+	at_notif_dispatch("%CESQ: 60,2,20,1\r\n");
+
+	ret = modem_info_snapshot_get(MODEM_INFO_SNAPSHOT_RSRP, true, &snapshot);
+
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_cmd_fake.call_count);
+	TEST_ASSERT_EQUAL(MODEM_INFO_SNAPSHOT_RSRP, snapshot.valid);
+	TEST_ASSERT_EQUAL(RSRP_IDX_TO_DBM(60), snapshot.rsrp);
+
+	/* Network parameters are read again after the registration changed. */
+	at_notif_dispatch("+CEREG: 5,\"0901\",\"00A0B1C3\",7\r\n");
+
+	nrf_modem_at_cmd_fake.custom_fake = nrf_modem_at_cmd_custom_not_registered;
+
+	ret = modem_info_snapshot_get(MODEM_INFO_SNAPSHOT_BAND | MODEM_INFO_SNAPSHOT_TEMP,
+				      true, &snapshot);
+
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(2, nrf_modem_at_cmd_fake.call_count);
+	TEST_ASSERT_EQUAL_STRING("AT%XMONITOR", at_cmd_last);
+	TEST_ASSERT_EQUAL(MODEM_INFO_SNAPSHOT_TEMP, snapshot.valid);
+	TEST_ASSERT_EQUAL(EXAMPLE_TEMP, snapshot.temperature);
+}
+
+void test_modem_info_snapshot_get_round_trips(void)
+{
+	struct modem_info_snapshot snapshot;
+	char operator_name[MODEM_INFO_SHORT_OP_NAME_SIZE];
+	uint8_t band;
+	int rsrp, snr, temp, vbat, tx_kbytes, rx_kbytes;
+	uint32_t start;
+	uint32_t single_cycles;
+	uint32_t snapshot_cycles;
+
+	nrf_modem_at_scanf_fake.custom_fake = nrf_modem_at_scanf_custom_example;
+	nrf_modem_at_cmd_fake.custom_fake = nrf_modem_at_cmd_custom_example;
+
+	/* Health report read with the single parameter functions */
+	start = k_cycle_get_32();
+
+	TEST_ASSERT_EQUAL(0, modem_info_get_rsrp(&rsrp));
+	TEST_ASSERT_EQUAL(0, modem_info_get_snr(&snr));
+	TEST_ASSERT_EQUAL(0, modem_info_get_current_band(&band));
+	TEST_ASSERT_EQUAL(0, modem_info_get_operator(operator_name, sizeof(operator_name)));
+	TEST_ASSERT_EQUAL(0, modem_info_get_temperature(&temp));
+	TEST_ASSERT_EQUAL(0, modem_info_get_batt_voltage(&vbat));
+	TEST_ASSERT_EQUAL(0, modem_info_get_connectivity_stats(&tx_kbytes, &rx_kbytes));
+
+	single_cycles = k_cycle_get_32() - start;
+
+	/* The same report read with a snapshot */
+	start = k_cycle_get_32();
+
+	TEST_ASSERT_EQUAL(0, modem_info_snapshot_get(EXAMPLE_SNAPSHOT_ALL &
+						     ~MODEM_INFO_SNAPSHOT_IP_ADDRESS,
+						     false, &snapshot));
+
+	snapshot_cycles = k_cycle_get_32() - start;
+
+	TEST_ASSERT_EQUAL(rsrp, snapshot.rsrp);
+	TEST_ASSERT_EQUAL(snr, snapshot.snr);
+	TEST_ASSERT_EQUAL(band, snapshot.band);
+	TEST_ASSERT_EQUAL_STRING(operator_name, snapshot.operator_name);
+	TEST_ASSERT_EQUAL(temp, snapshot.temperature);
+	TEST_ASSERT_EQUAL(vbat, snapshot.battery_voltage);
+	TEST_ASSERT_EQUAL(tx_kbytes, snapshot.tx_kbytes);
+	TEST_ASSERT_EQUAL(rx_kbytes, snapshot.rx_kbytes);
+
+	printk("Health report: %d round trips (%u cycles) with single reads, "
+	       "%d round trip (%u cycles) with a snapshot\n",
+	       nrf_modem_at_scanf_fake.call_count, single_cycles,
+	       nrf_modem_at_cmd_fake.call_count, snapshot_cycles);
+
+	TEST_ASSERT_EQUAL(7, nrf_modem_at_scanf_fake.call_count);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_cmd_fake.call_count);
+	TEST_ASSERT_TRUE(snapshot_cycles < single_cycles);
+}
+
 /* It is required to be added to each test. That is because unity's
  * main may return nonzero, while zephyr's main currently must
  * return 0 in all cases (other values are reserved).
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <math.h>
+#include <wave_gen.h>
+
+#define SAMPLE_RATE_HZ 100
+#define SAMPLE_INTERVAL_MS (MSEC_PER_SEC / SAMPLE_RATE_HZ)
+#define START_TIME_MS 123
+#define SAMPLE_CNT 500
+#define BENCH_SAMPLE_CNT 10000
+
+/* Maximum error of the lookup table based sine, relative to the amplitude */
+#define SINE_MAX_ERR 3e-5
+
+static float out[SAMPLE_CNT];
+static int16_t out_s16[SAMPLE_CNT];
+
+static const struct wave_gen_param wave_params[] = {
+	{ .type = WAVE_GEN_TYPE_SINE, .period_ms = 1000, .offset = 2.0, .amplitude = 3.0 },
+	{ .type = WAVE_GEN_TYPE_SINE, .period_ms = 730, .offset = -1.0, .amplitude = 100.0 },
+	{ .type = WAVE_GEN_TYPE_TRIANGLE, .period_ms = 400, .offset = 0.0, .amplitude = 5.0 },
+	{ .type = WAVE_GEN_TYPE_SQUARE, .period_ms = 200, .offset = 1.0, .amplitude = 1.0 },
+	{ .type = WAVE_GEN_TYPE_NONE, .period_ms = 0, .offset = 7.0, .amplitude = 1.0 },
+};
+
+ZTEST(suite_wave_gen, test_block_generate)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(wave_params); i++) {
+		const struct wave_gen_param *params = &wave_params[i];
+		struct wave_gen_block block;
+		size_t pos = 0;
+
+		zassert_ok(wave_gen_block_init(&block, params, START_TIME_MS, SAMPLE_RATE_HZ));
+
+		/* Consecutive blocks continue the signal */
+		while (pos < SAMPLE_CNT) {
+			size_t cnt = MIN(SAMPLE_CNT - pos, 7);
+
+			wave_gen_block_generate(&block, &out[pos], cnt);
+			pos += cnt;
+		}
+
+		for (size_t j = 0; j < SAMPLE_CNT; j++) {
+			double expected;
+
+			zassert_ok(wave_gen_generate_value(START_TIME_MS + j * SAMPLE_INTERVAL_MS,
+							   params, &expected));
+			zassert_within(out[j], expected, SINE_MAX_ERR * params->amplitude + 1e-5,
+				       "Wave %zu sample %zu: %f instead of %f", i, j,
+				       (double)out[j], expected);
+		}
+	}
+}
+
+ZTEST(suite_wave_gen, test_block_generate_s16)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(wave_params); i++) {
+		struct wave_gen_block block;
+
+		zassert_ok(wave_gen_block_init(&block, &wave_params[i], START_TIME_MS,
+					       SAMPLE_RATE_HZ));
+		wave_gen_block_generate(&block, out, SAMPLE_CNT);
+
+		zassert_ok(wave_gen_block_init(&block, &wave_params[i], START_TIME_MS,
+					       SAMPLE_RATE_HZ));
+		wave_gen_block_generate_s16(&block, out_s16, SAMPLE_CNT);
+
+		for (size_t j = 0; j < SAMPLE_CNT; j++) {
+			zassert_within(out_s16[j], truncf(out[j]), 1,
+				       "Wave %zu sample %zu: %d instead of %f", i, j,
+				       out_s16[j], (double)out[j]);
+		}
+	}
+}
+
+ZTEST(suite_wave_gen, test_block_saturation)
+{
+	const struct wave_gen_param params = {
+		.type = WAVE_GEN_TYPE_SQUARE,
+		.period_ms = 2,
+		.amplitude = 40000.0,
+	};
+	struct wave_gen_block block;
+
+	zassert_ok(wave_gen_block_init(&block, &params, 0, 1000));
+	wave_gen_block_generate_s16(&block, out_s16, 4);
+
+	zassert_equal(out_s16[0], INT16_MIN);
+	zassert_equal(out_s16[1], INT16_MAX);
+	zassert_equal(out_s16[2], INT16_MIN);
+	zassert_equal(out_s16[3], INT16_MAX);
+}
+
+ZTEST(suite_wave_gen, test_block_no_drift)
+{
+	/* The period is not a multiple of the sample interval */
+	const struct wave_gen_param params = {
+		.type = WAVE_GEN_TYPE_SINE,
+		.period_ms = 7,
+		.amplitude = 1.0,
+	};
+	struct wave_gen_block block;
+	uint32_t phase;
+
+	zassert_ok(wave_gen_block_init(&block, &params, 0, 48000));
+	phase = block.phase;
+
+	for (size_t i = 0; i < 1000; i++) {
+		/* 7 ms at 48 kHz */
+		wave_gen_block_generate(&block, out, 336);
+	}
+
+	zassert_equal(block.phase, phase, "Phase drifted");
+}
+
+ZTEST(suite_wave_gen, test_sine_symmetry)
+{
+	for (uint32_t phase = 0; phase < BIT(31); phase += 0x1234567) {
+		zassert_equal(wave_gen_sine(phase), -wave_gen_sine(phase + BIT(31)));
+		zassert_equal(wave_gen_sine(phase & (BIT(30) - 1)),
+			      wave_gen_sine(BIT(31) - (phase & (BIT(30) - 1))));
+	}
+
+	zassert_equal(wave_gen_sine(0), 0);
+	zassert_equal(wave_gen_sine(BIT(30)), WAVE_GEN_Q30_ONE);
+	zassert_equal(wave_gen_sine(3 * BIT(30)), -WAVE_GEN_Q30_ONE);
+}
+
+ZTEST(suite_wave_gen, test_illegal_args)
+{
+	struct wave_gen_block block;
+	struct wave_gen_param params = {
+		.type = WAVE_GEN_TYPE_SINE,
+		.period_ms = 0,
+	};
+
+	zassert_equal(wave_gen_block_init(&block, &params, 0, SAMPLE_RATE_HZ), -EINVAL);
+
+	params.period_ms = 1000;
+	zassert_equal(wave_gen_block_init(&block, &params, 0, 0), -EINVAL);
+	zassert_equal(wave_gen_block_init(&block, &params, 0, UINT32_MAX), -EINVAL);
+
+	params.type = WAVE_GEN_TYPE_COUNT;
+	zassert_equal(wave_gen_block_init(&block, &params, 0, SAMPLE_RATE_HZ), -EINVAL);
+}
+
+static unsigned long long samples_per_sec(uint32_t cycles)
+{
+	return (uint64_t)BENCH_SAMPLE_CNT * sys_clock_hw_cycles_per_sec() / MAX(cycles, 1);
+}
+
+ZTEST(suite_wave_gen, test_benchmark)
+{
+	const struct wave_gen_param *params = &wave_params[0];
+	struct wave_gen_block block;
+	uint32_t start;
+	uint32_t cycles;
+	double val;
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < BENCH_SAMPLE_CNT; i++) {
+		zassert_ok(wave_gen_generate_value(i, params, &val));
+	}
+	cycles = k_cycle_get_32() - start;
+	TC_PRINT("wave_gen_generate_value: %llu samples/s\n", samples_per_sec(cycles));
+
+	zassert_ok(wave_gen_block_init(&block, params, 0, MSEC_PER_SEC));
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < BENCH_SAMPLE_CNT; i += SAMPLE_CNT) {
+		wave_gen_block_generate(&block, out, SAMPLE_CNT);
+	}
+	cycles = k_cycle_get_32() - start;
+	TC_PRINT("wave_gen_block_generate: %llu samples/s\n", samples_per_sec(cycles));
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < BENCH_SAMPLE_CNT; i += SAMPLE_CNT) {
+		wave_gen_block_generate_s16(&block, out_s16, SAMPLE_CNT);
+	}
+	cycles = k_cycle_get_32() - start;
+	TC_PRINT("wave_gen_block_generate_s16: %llu samples/s\n", samples_per_sec(cycles));
+}
+
+ZTEST_SUITE(suite_wave_gen, NULL, NULL, NULL, NULL, NULL);
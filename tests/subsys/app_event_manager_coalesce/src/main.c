@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <app_event_manager.h>
+#include "test_events.h"
+
+#define LOG_LEN 16
+#define BURST_LEN 32
+#define BURST_CNT 100
+
+struct processed_event {
+	const struct event_type *type;
+	uint32_t value;
+};
+
+static struct processed_event processed[LOG_LEN];
+static size_t processed_cnt;
+static size_t submitted_cnt;
+
+static void submit_hook(const struct app_event_header *aeh)
+{
+	submitted_cnt++;
+}
+
+APP_EVENT_HOOK_ON_SUBMIT_REGISTER(submit_hook);
+
+static void processed_add(const struct app_event_header *aeh, uint32_t value)
+{
+	if (processed_cnt < ARRAY_SIZE(processed)) {
+		processed[processed_cnt].type = aeh->type_id;
+		processed[processed_cnt].value = value;
+	}
+
+	processed_cnt++;
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_state_event(aeh)) {
+		processed_add(aeh, cast_test_state_event(aeh)->value);
+	} else if (is_test_count_event(aeh)) {
+		const struct test_count_event *event = cast_test_count_event(aeh);
+
+		processed_add(aeh, event->count);
+		zassert_equal(event->last, event->count);
+	} else if (is_test_dyn_event(aeh)) {
+		const struct test_dyn_event *event = cast_test_dyn_event(aeh);
+
+		processed_add(aeh, event->dyndata.data[event->dyndata.size - 1]);
+	} else if (is_test_plain_event(aeh)) {
+		processed_add(aeh, cast_test_plain_event(aeh)->value);
+	} else {
+		zassert_unreachable("Unexpected event");
+	}
+
+	return false;
+}
+
+APP_EVENT_LISTENER(test_module, app_event_handler);
+APP_EVENT_SUBSCRIBE(test_module, test_state_event);
+APP_EVENT_SUBSCRIBE(test_module, test_count_event);
+APP_EVENT_SUBSCRIBE(test_module, test_dyn_event);
+APP_EVENT_SUBSCRIBE(test_module, test_plain_event);
+
+static void state_submit(uint32_t value)
+{
+	struct test_state_event *event = new_test_state_event();
+
+	event->value = value;
+	APP_EVENT_SUBMIT(event);
+}
+
+static void plain_submit(uint32_t value)
+{
+	struct test_plain_event *event = new_test_plain_event();
+
+	event->value = value;
+	APP_EVENT_SUBMIT(event);
+}
+
+static void dyn_submit(size_t size, uint8_t value)
+{
+	struct test_dyn_event *event = new_test_dyn_event(size);
+
+	memset(event->dyndata.data, value, size);
+	APP_EVENT_SUBMIT(event);
+}
+
+static void processed_check(size_t idx, const struct event_type *type, uint32_t value)
+{
+	zassert_true(idx < processed_cnt, "Event %zu not processed", idx);
+	zassert_equal_ptr(processed[idx].type, type, "Invalid type of event %zu", idx);
+	zassert_equal(processed[idx].value, value, "Invalid value of event %zu", idx);
+}
+
+/* Events are queued, but not processed, while the scheduler is locked. */
+static void queue_hold(void)
+{
+	k_sched_lock();
+}
+
+static void queue_release(void)
+{
+	k_sched_unlock();
+	k_msleep(1);
+}
+
+ZTEST(app_event_manager_coalesce, test_replace)
+{
+	uint32_t coalesced = app_event_manager_coalesced_cnt_get(APP_EVENT_ID(test_state_event));
+
+	queue_hold();
+	for (uint32_t i = 1; i <= 5; i++) {
+		state_submit(i);
+	}
+	queue_release();
+
+	zassert_equal(processed_cnt, 1);
+	processed_check(0, APP_EVENT_ID(test_state_event), 5);
+	zassert_equal(app_event_manager_coalesced_cnt_get(APP_EVENT_ID(test_state_event)),
+		      coalesced + 4);
+
+	/* Submit hooks are only called for the queued event */
+	zassert_equal(submitted_cnt, 1);
+}
+
+ZTEST(app_event_manager_coalesce, test_queue_order)
+{
+	/* The coalesced event keeps the position of the first queued event */
+	queue_hold();
+	plain_submit(1);
+	state_submit(10);
+	plain_submit(2);
+	state_submit(20);
+	plain_submit(3);
+	queue_release();
+
+	zassert_equal(processed_cnt, 4);
+	processed_check(0, APP_EVENT_ID(test_plain_event), 1);
+	processed_check(1, APP_EVENT_ID(test_state_event), 20);
+	processed_check(2, APP_EVENT_ID(test_plain_event), 2);
+	processed_check(3, APP_EVENT_ID(test_plain_event), 3);
+}
+
+ZTEST(app_event_manager_coalesce, test_merge)
+{
+	uint32_t coalesced = app_event_manager_coalesced_cnt_get(APP_EVENT_ID(test_count_event));
+
+	queue_hold();
+	for (uint32_t i = 1; i <= 10; i++) {
+		struct test_count_event *event = new_test_count_event();
+
+		event->count = 1;
+		event->last = i;
+		APP_EVENT_SUBMIT(event);
+	}
+	queue_release();
+
+	zassert_equal(processed_cnt, 1);
+	processed_check(0, APP_EVENT_ID(test_count_event), 10);
+	zassert_equal(app_event_manager_coalesced_cnt_get(APP_EVENT_ID(test_count_event)),
+		      coalesced + 9);
+}
+
+ZTEST(app_event_manager_coalesce, test_dyndata)
+{
+	queue_hold();
+	dyn_submit(4, 1);
+	dyn_submit(4, 2);
+	/* Different size, the event is queued */
+	dyn_submit(8, 3);
+	dyn_submit(8, 4);
+	queue_release();
+
+	zassert_equal(processed_cnt, 2);
+	processed_check(0, APP_EVENT_ID(test_dyn_event), 2);
+	processed_check(1, APP_EVENT_ID(test_dyn_event), 4);
+}
+
+ZTEST(app_event_manager_coalesce, test_not_coalesced_after_processing)
+{
+	uint32_t coalesced = app_event_manager_coalesced_cnt_get(APP_EVENT_ID(test_state_event));
+
+	/* Event taken for processing is not replaced */
+	state_submit(1);
+	k_msleep(1);
+	state_submit(2);
+	k_msleep(1);
+
+	zassert_equal(processed_cnt, 2);
+	processed_check(0, APP_EVENT_ID(test_state_event), 1);
+	processed_check(1, APP_EVENT_ID(test_state_event), 2);
+	zassert_equal(app_event_manager_coalesced_cnt_get(APP_EVENT_ID(test_state_event)),
+		      coalesced);
+}
+
+static uint32_t burst_run(void (*submit)(uint32_t value))
+{
+	uint32_t start = k_cycle_get_32();
+
+	for (uint32_t i = 0; i < BURST_CNT; i++) {
+		queue_hold();
+		for (uint32_t j = 0; j < BURST_LEN; j++) {
+			submit(j);
+		}
+		k_sched_unlock();
+		k_yield();
+	}
+	k_msleep(1);
+
+	return k_cycle_get_32() - start;
+}
+
+ZTEST(app_event_manager_coalesce, test_benchmark)
+{
+	uint32_t cycles;
+
+	cycles = burst_run(plain_submit);
+	zassert_equal(processed_cnt, BURST_CNT * BURST_LEN);
+	TC_PRINT("Plain events: %u processed, %u cycles per submitted event\n",
+		 (uint32_t)processed_cnt, cycles / (BURST_CNT * BURST_LEN));
+
+	processed_cnt = 0;
+
+	cycles = burst_run(state_submit);
+	zassert_equal(processed_cnt, BURST_CNT);
+	TC_PRINT("Coalescing events: %u processed, %u cycles per submitted event\n",
+		 (uint32_t)processed_cnt, cycles / (BURST_CNT * BURST_LEN));
+}
+
+static void *setup(void)
+{
+	zassert_ok(app_event_manager_init());
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(processed, 0, sizeof(processed));
+	processed_cnt = 0;
+	submitted_cnt = 0;
+}
+
+ZTEST_SUITE(app_event_manager_coalesce, NULL, setup, before, NULL, NULL);
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "test_events.h"
+
+static void merge_test_count_event(struct app_event_header *queued,
+				   const struct app_event_header *aeh)
+{
+	struct test_count_event *queued_event = cast_test_count_event(queued);
+	const struct test_count_event *event = cast_test_count_event(aeh);
+
+	queued_event->count += event->count;
+	queued_event->last = event->last;
+}
+
+APP_EVENT_TYPE_DEFINE(test_state_event, NULL, NULL,
+		      APP_EVENT_FLAGS_CREATE(APP_EVENT_TYPE_FLAGS_COALESCE));
+
+APP_EVENT_TYPE_COALESCE_DEFINE(test_count_event, NULL, NULL, APP_EVENT_FLAGS_CREATE(),
+			       merge_test_count_event);
+
+APP_EVENT_TYPE_DEFINE(test_dyn_event, NULL, NULL,
+		      APP_EVENT_FLAGS_CREATE(APP_EVENT_TYPE_FLAGS_COALESCE));
+
+APP_EVENT_TYPE_DEFINE(test_plain_event, NULL, NULL, APP_EVENT_FLAGS_CREATE());
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _TEST_EVENTS_H_
+#define _TEST_EVENTS_H_
+
+#include <app_event_manager.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* State-like event, only the latest value matters. */
+struct test_state_event {
+	struct app_event_header header;
+
+	uint32_t value;
+};
+
+APP_EVENT_TYPE_DECLARE(test_state_event);
+
+/* Event merged with the queued one by adding the counts. */
+struct test_count_event {
+	struct app_event_header header;
+
+	uint32_t count;
+	uint32_t last;
+};
+
+APP_EVENT_TYPE_DECLARE(test_count_event);
+
+/* Coalescing event with dynamic data. */
+struct test_dyn_event {
+	struct app_event_header header;
+
+	struct event_dyndata dyndata;
+};
+
+APP_EVENT_TYPE_DYNDATA_DECLARE(test_dyn_event);
+
+/* Event that is never coalesced. */
+struct test_plain_event {
+	struct app_event_header header;
+
+	uint32_t value;
+};
+
+APP_EVENT_TYPE_DECLARE(test_plain_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _TEST_EVENTS_H_ */
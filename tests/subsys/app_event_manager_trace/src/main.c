@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <app_event_manager.h>
+#include <app_event_manager_trace.h>
+#include "test_events.h"
+
+#define INPUT_EVENT_CNT 3
+#define EVENT_INTERVAL_MS 10
+#define HANDLER_TIME_US 200
+#define DATA_LEN 13
+#define DATA_ID 0x1234
+
+static uint8_t trace[CONFIG_APP_EVENT_MANAGER_TRACE_RECORDER_BUF_SIZE];
+static size_t trace_len;
+
+static uint32_t input_values[INPUT_EVENT_CNT];
+static size_t input_cnt;
+static size_t output_cnt;
+static uint8_t data_buf[DATA_LEN];
+static size_t data_cnt;
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_input_event(aeh)) {
+		const struct test_input_event *event = cast_test_input_event(aeh);
+		struct test_output_event *output = new_test_output_event();
+
+		zassert_equal(event->flags, event->value & 0xFF);
+		if (input_cnt < ARRAY_SIZE(input_values)) {
+			input_values[input_cnt] = event->value;
+		}
+		input_cnt++;
+
+		k_busy_wait(HANDLER_TIME_US);
+
+		output->value = event->value;
+		APP_EVENT_SUBMIT(output);
+
+		return false;
+	}
+
+	if (is_test_output_event(aeh)) {
+		output_cnt++;
+		return false;
+	}
+
+	if (is_test_data_event(aeh)) {
+		const struct test_data_event *event = cast_test_data_event(aeh);
+
+		zassert_equal(event->id, DATA_ID);
+		zassert_equal(event->dyndata.size, DATA_LEN);
+		memcpy(data_buf, event->dyndata.data, DATA_LEN);
+		data_cnt++;
+
+		return false;
+	}
+
+	zassert_unreachable("Unexpected event");
+	return false;
+}
+
+APP_EVENT_LISTENER(test_module, app_event_handler);
+APP_EVENT_SUBSCRIBE(test_module, test_input_event);
+APP_EVENT_SUBSCRIBE(test_module, test_output_event);
+APP_EVENT_SUBSCRIBE(test_module, test_data_event);
+
+static void received_reset(void)
+{
+	memset(input_values, 0, sizeof(input_values));
+	memset(data_buf, 0, sizeof(data_buf));
+	input_cnt = 0;
+	output_cnt = 0;
+	data_cnt = 0;
+}
+
+static void received_check(void)
+{
+	zassert_equal(input_cnt, INPUT_EVENT_CNT);
+	zassert_equal(output_cnt, INPUT_EVENT_CNT);
+	zassert_equal(data_cnt, 1);
+
+	for (size_t i = 0; i < INPUT_EVENT_CNT; i++) {
+		zassert_equal(input_values[i], 0x100 + i);
+	}
+
+	for (size_t i = 0; i < DATA_LEN; i++) {
+		zassert_equal(data_buf[i], i);
+	}
+}
+
+static bool input_filter(const struct event_type *et)
+{
+	return et != APP_EVENT_ID(test_output_event);
+}
+
+static int64_t replay_time_ms(uint32_t speed)
+{
+	const struct app_event_trace_replay_param param = {
+		.speed = speed,
+		.filter = input_filter,
+	};
+	int64_t start = k_uptime_get();
+
+	zassert_equal(app_event_trace_replay(trace, trace_len, &param), INPUT_EVENT_CNT + 1);
+
+	return k_uptime_get() - start;
+}
+
+ZTEST(app_event_manager_trace, test_replay)
+{
+	const struct app_event_trace_replay_param param = {
+		.filter = input_filter,
+	};
+
+	zassert_equal(app_event_trace_recorder_dropped_get(), 0);
+	zassert_equal(app_event_trace_replay(trace, trace_len, &param), INPUT_EVENT_CNT + 1);
+	k_msleep(1);
+
+	received_check();
+}
+
+ZTEST(app_event_manager_trace, test_replay_unfiltered)
+{
+	/* Output events are replayed and submitted again by the module */
+	zassert_equal(app_event_trace_replay(trace, trace_len, NULL), 2 * INPUT_EVENT_CNT + 1);
+	k_msleep(1);
+
+	zassert_equal(input_cnt, INPUT_EVENT_CNT);
+	zassert_equal(output_cnt, 2 * INPUT_EVENT_CNT);
+}
+
+ZTEST(app_event_manager_trace, test_replay_timing)
+{
+	int64_t recorded_ms = INPUT_EVENT_CNT * EVENT_INTERVAL_MS;
+
+	zassert_true(replay_time_ms(1) >= recorded_ms - 1);
+	zassert_true(replay_time_ms(10) <= recorded_ms / 5);
+	zassert_true(replay_time_ms(0) <= 1);
+	k_msleep(1);
+}
+
+ZTEST(app_event_manager_trace, test_stats)
+{
+	struct app_event_trace_stats stats;
+	uint32_t handler_cycles = k_us_to_cyc_floor32(HANDLER_TIME_US);
+
+	app_event_trace_stats_reset();
+	(void)replay_time_ms(0);
+	k_msleep(1);
+
+	app_event_trace_type_stats_get(APP_EVENT_ID(test_input_event), &stats);
+	zassert_equal(stats.count, INPUT_EVENT_CNT);
+	zassert_true(stats.max_cycles >= handler_cycles);
+	zassert_true(stats.total_cycles >= INPUT_EVENT_CNT * handler_cycles);
+
+	app_event_trace_type_stats_get(APP_EVENT_ID(test_output_event), &stats);
+	zassert_equal(stats.count, INPUT_EVENT_CNT);
+
+	app_event_trace_listener_stats_get(&__event_listener_test_module, &stats);
+	zassert_equal(stats.count, 2 * INPUT_EVENT_CNT + 1);
+	zassert_true(stats.total_cycles >= INPUT_EVENT_CNT * handler_cycles);
+
+	app_event_trace_stats_log();
+
+	app_event_trace_stats_reset();
+	app_event_trace_type_stats_get(APP_EVENT_ID(test_input_event), &stats);
+	zassert_equal(stats.count, 0);
+}
+
+ZTEST(app_event_manager_trace, test_malformed)
+{
+	static uint8_t buf[sizeof(trace)];
+	struct app_event_trace_header hdr;
+
+	memcpy(buf, trace, trace_len);
+	memcpy(&hdr, buf, sizeof(hdr));
+	zassert_equal(hdr.magic, APP_EVENT_TRACE_MAGIC);
+	zassert_equal(hdr.version, APP_EVENT_TRACE_VERSION);
+
+	/* Truncated trace */
+	zassert_equal(app_event_trace_replay(buf, sizeof(hdr) - 1, NULL), -EINVAL);
+	zassert_equal(app_event_trace_replay(buf, trace_len - 1, NULL), -EINVAL);
+
+	/* Invalid record type */
+	buf[sizeof(hdr)] = 0xFF;
+	zassert_equal(app_event_trace_replay(buf, trace_len, NULL), -EINVAL);
+
+	buf[0]++;
+	zassert_equal(app_event_trace_replay(buf, trace_len, NULL), -EINVAL);
+	buf[0]--;
+
+	hdr.version++;
+	memcpy(buf, &hdr, sizeof(hdr));
+	zassert_equal(app_event_trace_replay(buf, trace_len, NULL), -ENOTSUP);
+	k_msleep(1);
+}
+
+ZTEST(app_event_manager_trace, test_unknown_type)
+{
+	static uint8_t buf[sizeof(trace)];
+	const char *name = "test_input_event";
+	const struct app_event_trace_replay_param param = {
+		.filter = input_filter,
+	};
+	size_t pos;
+
+	memcpy(buf, trace, trace_len);
+
+	/* Rename the recorded event type */
+	for (pos = 0; pos < trace_len - strlen(name); pos++) {
+		if (memcmp(&buf[pos], name, strlen(name)) == 0) {
+			break;
+		}
+	}
+	zassert_true(pos < trace_len - strlen(name));
+	buf[pos] = 'x';
+
+	zassert_equal(app_event_trace_replay(buf, trace_len, &param), 1);
+	k_msleep(1);
+
+	zassert_equal(input_cnt, 0);
+	zassert_equal(data_cnt, 1);
+}
+
+ZTEST(app_event_manager_trace, test_recorder_overflow)
+{
+	uint8_t buf[32];
+
+	app_event_trace_recorder_start();
+
+	for (size_t i = 0; i < sizeof(trace); i++) {
+		struct test_output_event *event = new_test_output_event();
+
+		event->value = i;
+		APP_EVENT_SUBMIT(event);
+		k_msleep(1);
+	}
+
+	app_event_trace_recorder_stop();
+
+	zassert_true(app_event_trace_recorder_dropped_get() > 0);
+	while (app_event_trace_recorder_read(buf, sizeof(buf)) > 0) {
+	}
+}
+
+static void *setup(void)
+{
+	struct test_data_event *data_event;
+
+	zassert_ok(app_event_manager_init());
+
+	app_event_trace_recorder_start();
+
+	for (size_t i = 0; i < INPUT_EVENT_CNT; i++) {
+		struct test_input_event *event = new_test_input_event();
+
+		event->value = 0x100 + i;
+		event->flags = event->value & 0xFF;
+		APP_EVENT_SUBMIT(event);
+		k_msleep(EVENT_INTERVAL_MS);
+	}
+
+	data_event = new_test_data_event(DATA_LEN);
+	data_event->id = DATA_ID;
+	for (size_t i = 0; i < DATA_LEN; i++) {
+		data_event->dyndata.data[i] = i;
+	}
+	APP_EVENT_SUBMIT(data_event);
+	k_msleep(1);
+
+	app_event_trace_recorder_stop();
+	received_check();
+
+	trace_len = app_event_trace_recorder_read(trace, sizeof(trace));
+	zassert_true(trace_len > sizeof(struct app_event_trace_header));
+	zassert_equal(app_event_trace_recorder_read(trace, sizeof(trace)), 0);
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	received_reset();
+}
+
+ZTEST_SUITE(app_event_manager_trace, NULL, setup, before, NULL, NULL);
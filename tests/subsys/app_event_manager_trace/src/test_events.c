@@ -0,0 +1,11 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "test_events.h"
+
+APP_EVENT_TYPE_DEFINE(test_input_event, NULL, NULL, APP_EVENT_FLAGS_CREATE());
+APP_EVENT_TYPE_DEFINE(test_output_event, NULL, NULL, APP_EVENT_FLAGS_CREATE());
+APP_EVENT_TYPE_DEFINE(test_data_event, NULL, NULL, APP_EVENT_FLAGS_CREATE());
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _TEST_EVENTS_H_
+#define _TEST_EVENTS_H_
+
+#include <app_event_manager.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Event submitted by the test, as if it came from a driver. */
+struct test_input_event {
+	struct app_event_header header;
+
+	uint32_t value;
+	uint8_t flags;
+};
+
+APP_EVENT_TYPE_DECLARE(test_input_event);
+
+/* Event submitted by the test module in reaction to test_input_event. */
+struct test_output_event {
+	struct app_event_header header;
+
+	uint32_t value;
+};
+
+APP_EVENT_TYPE_DECLARE(test_output_event);
+
+struct test_data_event {
+	struct app_event_header header;
+
+	uint16_t id;
+	struct event_dyndata dyndata;
+};
+
+APP_EVENT_TYPE_DYNDATA_DECLARE(test_data_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _TEST_EVENTS_H_ */
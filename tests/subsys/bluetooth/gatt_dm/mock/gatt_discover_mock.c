@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 #include <stdbool.h>
+#include <string.h>
 #include <inttypes.h>
 #include <zephyr/bluetooth/gatt.h>
 #include <zephyr/bluetooth/uuid.h>
@@ -19,15 +20,41 @@ static struct bt_discover_mock {
 	struct bt_conn *conn;
 	struct bt_gatt_discover_params *params;
 	struct k_work_delayable work;
+	size_t cnt;
 } discover_mock_data;
 
+/* Settings of the read mock */
+static struct bt_read_mock {
+	uint8_t db_hash[16];
+	bool db_hash_present;
+	struct bt_conn *conn;
+	struct bt_gatt_read_params *params;
+	struct k_work_delayable work;
+} read_mock_data;
+
 static void bt_gatt_discover_work(struct k_work *work);
+static void bt_gatt_read_work(struct k_work *work);
 
 void bt_gatt_discover_mock_setup(const struct bt_gatt_attr *attr, size_t len)
 {
 	k_work_init_delayable(&discover_mock_data.work, bt_gatt_discover_work);
 	discover_mock_data.attr = attr;
 	discover_mock_data.len  = len;
+	discover_mock_data.cnt  = 0;
+}
+
+size_t bt_gatt_discover_mock_cnt_get(void)
+{
+	return discover_mock_data.cnt;
+}
+
+void bt_gatt_read_mock_setup(const uint8_t *db_hash)
+{
+	k_work_init_delayable(&read_mock_data.work, bt_gatt_read_work);
+	read_mock_data.db_hash_present = (db_hash != NULL);
+	if (db_hash) {
+		memcpy(read_mock_data.db_hash, db_hash, sizeof(read_mock_data.db_hash));
+	}
 }
 
 static bool bt_gatt_primary_check(const struct bt_gatt_attr *attr_cur,
@@ -128,7 +155,48 @@ int bt_gatt_discover(struct bt_conn *conn,
 	printk("Running %s mock\n", __func__);
 	discover_mock_data.conn = conn;
 	discover_mock_data.params = params;
+	discover_mock_data.cnt++;
 
 	k_work_schedule(&discover_mock_data.work, K_MSEC(5));
 	return 0;
 }
+
+static void bt_gatt_read_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct bt_read_mock *mock_data =
+		CONTAINER_OF(dwork, struct bt_read_mock, work);
+	struct bt_gatt_read_params *params = mock_data->params;
+
+	if (!mock_data->db_hash_present) {
+		(void)params->func(mock_data->conn, BT_ATT_ERR_ATTRIBUTE_NOT_FOUND,
+				   params, NULL, 0);
+		return;
+	}
+
+	if (BT_GATT_ITER_STOP ==
+		params->func(mock_data->conn, 0, params, mock_data->db_hash,
+			     sizeof(mock_data->db_hash))) {
+		return;
+	}
+
+	/* Send NULL to mark processing end */
+	(void)params->func(mock_data->conn, 0, params, NULL, 0);
+}
+
+/* Mocked version of the bt_gatt_read */
+/* Call the bt_gatt_read_mock_setup function first */
+int bt_gatt_read(struct bt_conn *conn, struct bt_gatt_read_params *params)
+{
+	printk("Running %s mock\n", __func__);
+
+	zassert_equal(params->handle_count, 0, "Only reads by UUID are supported");
+	zassert_true(!bt_uuid_cmp(params->by_uuid.uuid, BT_UUID_GATT_DB_HASH),
+		     "Unexpected read");
+
+	read_mock_data.conn = conn;
+	read_mock_data.params = params;
+
+	k_work_schedule(&read_mock_data.work, K_MSEC(5));
+	return 0;
+}
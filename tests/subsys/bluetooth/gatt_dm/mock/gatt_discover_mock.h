@@ -90,5 +90,24 @@
  */
 void bt_gatt_discover_mock_setup(const struct bt_gatt_attr *attr, size_t len);
 
+/**
+ * @brief Get the number of discoveries
+ *
+ * @return The number of @ref bt_gatt_discover calls since the last
+ *         @ref bt_gatt_discover_mock_setup call.
+ */
+size_t bt_gatt_discover_mock_cnt_get(void);
+
+/**
+ * @brief GATT read mock setup
+ *
+ * This function setups the mock for @ref bt_gatt_read function.
+ * The mock serves reads of the Database Hash characteristic.
+ *
+ * @param db_hash The 16-byte Database Hash of the simulated peer,
+ *                or NULL if the peer does not have the characteristic.
+ */
+void bt_gatt_read_mock_setup(const uint8_t *db_hash);
+
 /** @} */
 #endif /* #define BT_GATT_DISCOVERY_MOCK_H_ */
@@ -8,6 +8,7 @@
 #include <stddef.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/bluetooth/uuid.h>
+#include <zephyr/settings/settings.h>
 #include <bluetooth/gatt_dm.h>
 #include "../mock/gatt_discover_mock.h"
 
@@ -87,12 +88,38 @@ struct bt_gatt_dm_cb test_hids_cb = {
 	.error_found       = test_cb_error_found
 };
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+/* Time given to the Discovery Manager to store the discovered service */
+#define CACHE_STORE_WAIT_MS 50
+
+static const bt_addr_le_t peer_addr = {
+	.type = BT_ADDR_LE_PUBLIC,
+	.a.val = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06},
+};
+static bool peer_bonded;
+#endif
+
+static const uint8_t db_hash[16] = {
+	0xf0, 0xe1, 0xd2, 0xc3, 0xb4, 0xa5, 0x96, 0x87,
+	0x78, 0x69, 0x5a, 0x4b, 0x3c, 0x2d, 0x1e, 0x0f,
+};
+
 void test_before(void *fixture)
 {
 	ARG_UNUSED(fixture);
 
 	k_sem_reset(&discovery_finished);
 	bt_gatt_discover_mock_setup(discover_sim, ARRAY_SIZE(discover_sim));
+	bt_gatt_read_mock_setup(db_hash);
+
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	peer_bonded = true;
+
+	/* Let the previous test finish storing before the cache is cleared */
+	k_sleep(K_MSEC(CACHE_STORE_WAIT_MS));
+	zassert_ok(settings_subsys_init());
+	zassert_ok(bt_gatt_dm_cache_clear(NULL));
+#endif
 }
 
 struct bt_gatt_dm *run_dm(const struct bt_uuid *svc_uuid)
@@ -476,3 +503,218 @@ ZTEST(gatt_tests, test_gatt_many_serv_by_uuid)
 	zassert_equal(0, bt_gatt_dm_attr_cnt(dm), "Parameter count after clearing: %d",
 		      bt_gatt_dm_attr_cnt(dm));
 }
+
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+/* The dummy connection is an LE connection to a peer that is bonded
+ * unless the test says otherwise.
+ */
+int __wrap_bt_conn_get_info(const struct bt_conn *conn, struct bt_conn_info *info)
+{
+	zassert_equal_ptr((const void *)&dummy_conn, conn, "Unexpected connection");
+
+	memset(info, 0, sizeof(*info));
+	info->type = BT_CONN_TYPE_LE;
+	info->le.dst = &peer_addr;
+
+	return 0;
+}
+
+bool __wrap_bt_le_bond_exists(uint8_t id, const bt_addr_le_t *addr)
+{
+	return peer_bonded && bt_addr_le_eq(addr, &peer_addr);
+}
+
+/* Runs the discovery and reports how long it took and how many GATT
+ * discovery requests were sent to the peer.
+ */
+static struct bt_gatt_dm *run_dm_measured(const struct bt_uuid *svc_uuid,
+					  int64_t *duration, size_t *requests)
+{
+	struct bt_gatt_dm *dm;
+	int64_t start;
+
+	bt_gatt_discover_mock_setup(discover_sim, ARRAY_SIZE(discover_sim));
+
+	start = k_uptime_get();
+	dm = run_dm(svc_uuid);
+	*duration = k_uptime_get() - start;
+	*requests = bt_gatt_discover_mock_cnt_get();
+
+	return dm;
+}
+
+/* Compares the discovered service with the simulated attributes */
+static void dm_check(struct bt_gatt_dm *dm, const struct bt_gatt_attr *expected,
+		     size_t cnt)
+{
+	const struct bt_gatt_dm_attr *attr = bt_gatt_dm_service_get(dm);
+
+	zassert_equal(cnt, bt_gatt_dm_attr_cnt(dm),
+		      "Unexpected number of attributes detected: %d",
+		      bt_gatt_dm_attr_cnt(dm));
+
+	for (size_t i = 0; i < cnt; i++, attr = bt_gatt_dm_attr_next(dm, attr)) {
+		zassert_not_null(attr, "Attr handle: %u", expected[i].handle);
+		zassert_equal(expected[i].handle, attr->handle, "Unexpected handle");
+		zassert_true(!bt_uuid_cmp(expected[i].uuid, attr->uuid),
+			     "Unexpected UUID at handle %u", attr->handle);
+
+		if (!bt_uuid_cmp(BT_UUID_GATT_PRIMARY, attr->uuid)) {
+			const struct bt_gatt_service_val *exp = expected[i].user_data;
+			const struct bt_gatt_service_val *val =
+				bt_gatt_dm_attr_service_val(attr);
+
+			zassert_true(!bt_uuid_cmp(exp->uuid, val->uuid),
+				     "Unexpected service UUID");
+			zassert_equal(exp->end_handle, val->end_handle,
+				      "Unexpected end handle");
+		} else if (!bt_uuid_cmp(BT_UUID_GATT_CHRC, attr->uuid)) {
+			const struct bt_gatt_chrc *exp = expected[i].user_data;
+			const struct bt_gatt_chrc *val = bt_gatt_dm_attr_chrc_val(attr);
+
+			zassert_true(!bt_uuid_cmp(exp->uuid, val->uuid),
+				     "Unexpected characteristic UUID at handle %u",
+				     attr->handle);
+			zassert_equal(exp->properties, val->properties,
+				      "Unexpected properties at handle %u", attr->handle);
+		}
+	}
+}
+
+/* Discovers HIDS, as on connection, and returns the number of GATT discovery
+ * requests.
+ */
+static size_t hids_connect(void)
+{
+	struct bt_gatt_dm *dm;
+	int64_t duration;
+	size_t requests;
+
+	dm = run_dm_measured(BT_UUID_HIDS, &duration, &requests);
+	zassert_not_null(dm, "Device Manager pointer not set");
+	dm_check(dm, &discover_sim[0], 11);
+	zassert_ok(bt_gatt_dm_data_release(dm));
+
+	return requests;
+}
+
+ZTEST(gatt_tests, test_gatt_cache_reconnect)
+{
+	struct bt_gatt_dm *dm;
+	int64_t first, cached;
+	size_t first_requests, cached_requests;
+
+	dm = run_dm_measured(BT_UUID_HIDS, &first, &first_requests);
+	zassert_not_null(dm, "Device Manager pointer not set");
+	dm_check(dm, &discover_sim[0], 11);
+	zassert_ok(bt_gatt_dm_data_release(dm));
+	zassert_true(first_requests > 0, "Service not discovered");
+
+	/* On reconnection the service is served from the cache */
+	dm = run_dm_measured(BT_UUID_HIDS, &cached, &cached_requests);
+	zassert_not_null(dm, "Device Manager pointer not set");
+	dm_check(dm, &discover_sim[0], 11);
+	zassert_ok(bt_gatt_dm_data_release(dm));
+
+	TC_PRINT("Discovery: %lld ms (%zu requests), cached: %lld ms (%zu requests)\n",
+		 first, first_requests, cached, cached_requests);
+
+	zassert_equal(cached_requests, 0, "Cached service discovered again");
+	zassert_true(cached < first, "Cached discovery not faster");
+}
+
+ZTEST(gatt_tests, test_gatt_cache_continue)
+{
+	struct bt_gatt_dm *dm;
+	size_t services;
+
+	for (int i = 0; i < 2; i++) {
+		bt_gatt_discover_mock_setup(discover_sim, ARRAY_SIZE(discover_sim));
+
+		services = 0;
+		for (dm = run_dm(NULL); dm; dm = run_dm_next(dm)) {
+			services++;
+		}
+
+		zassert_equal(services, 6, "Unexpected number of services: %zu", services);
+
+		if (i > 0) {
+			zassert_equal(bt_gatt_discover_mock_cnt_get(), 0,
+				      "Cached services discovered again");
+		}
+	}
+
+	/* Cached services are found by UUID separately */
+	zassert_not_equal(hids_connect(), 0, "HIDS by UUID served from the cache");
+}
+
+ZTEST(gatt_tests, test_gatt_cache_continue_by_uuid)
+{
+	struct bt_gatt_dm *dm;
+	struct bt_gatt_dm *dm_next;
+	size_t services;
+	int err[2];
+
+	for (int i = 0; i < 2; i++) {
+		bt_gatt_discover_mock_setup(discover_sim, ARRAY_SIZE(discover_sim));
+
+		services = 0;
+		for (dm = run_dm(BT_UUID_HRS); dm; dm = run_dm_next(dm)) {
+			services++;
+		}
+
+		zassert_equal(services, 2, "Unexpected number of services: %zu", services);
+
+		/* A service without characteristics keeps the UUID of the search */
+		dm = run_dm(BT_UUID_EMPTY);
+		zassert_not_null(dm, "Device Manager pointer not set");
+		zassert_ok(bt_gatt_dm_data_release(dm));
+		err[i] = bt_gatt_dm_continue(dm, &dm_next);
+	}
+
+	zassert_equal(err[0], -EINVAL, "Unexpected result: %d", err[0]);
+	zassert_equal(err[1], err[0], "Cached service continued differently: %d", err[1]);
+}
+
+ZTEST(gatt_tests, test_gatt_cache_db_hash_changed)
+{
+	static const uint8_t db_hash_changed[16] = {
+		0x0f, 0x1e, 0x2d, 0x3c, 0x4b, 0x5a, 0x69, 0x78,
+		0x87, 0x96, 0xa5, 0xb4, 0xc3, 0xd2, 0xe1, 0xf0,
+	};
+
+	zassert_not_equal(hids_connect(), 0, "Service not discovered");
+
+	bt_gatt_read_mock_setup(db_hash_changed);
+	zassert_not_equal(hids_connect(), 0, "Stale service served from the cache");
+
+	/* The cache is updated with the new Database Hash */
+	zassert_equal(hids_connect(), 0, "Service discovered again");
+}
+
+ZTEST(gatt_tests, test_gatt_cache_no_db_hash)
+{
+	bt_gatt_read_mock_setup(NULL);
+
+	zassert_not_equal(hids_connect(), 0, "Service not discovered");
+	zassert_not_equal(hids_connect(), 0, "Unvalidated service served from the cache");
+}
+
+ZTEST(gatt_tests, test_gatt_cache_not_bonded)
+{
+	peer_bonded = false;
+
+	zassert_not_equal(hids_connect(), 0, "Service not discovered");
+	zassert_not_equal(hids_connect(), 0, "Service of unbonded peer cached");
+}
+
+ZTEST(gatt_tests, test_gatt_cache_clear)
+{
+	zassert_not_equal(hids_connect(), 0, "Service not discovered");
+
+	k_sleep(K_MSEC(CACHE_STORE_WAIT_MS));
+	zassert_ok(bt_gatt_dm_cache_clear(&peer_addr));
+
+	zassert_not_equal(hids_connect(), 0, "Cleared service served from the cache");
+}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
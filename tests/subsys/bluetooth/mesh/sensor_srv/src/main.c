@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/bluetooth/mesh.h>
+#include <bluetooth/mesh/sensor_srv.h>
+#include <bluetooth/mesh/sensor_types.h>
+#include "sensor.h"
+
+/* Publication period of the server, in milliseconds */
+#define PUB_PERIOD 1000
+/* Fast period divisor of the configured sensor cadence */
+#define PUB_DIV 2
+/* Number of publications after which each sensor value is published again */
+#define PUB_INTERVAL BIT(PUB_DIV)
+/* Number of publications in the measurement */
+#define TICK_COUNT (4 * PUB_INTERVAL)
+
+#define DELTA 5.0f
+#define RANGE_HIGH 60.0f
+
+#define PUB_LEN_MAX                                                                                \
+	(MIN(BT_MESH_TX_SDU_MAX, sizeof(sensor_srv.pub_data)) - BT_MESH_MIC_SHORT)
+
+static int sensor_get(struct bt_mesh_sensor_srv *srv, struct bt_mesh_sensor *sensor,
+		      struct bt_mesh_msg_ctx *ctx, struct bt_mesh_sensor_value *rsp);
+
+#define SENSOR(_type)                                                                              \
+	{                                                                                          \
+		.type = &(_type), .get = sensor_get,                                               \
+	}
+
+/* The sensor values don't fit into a single publication */
+static struct bt_mesh_sensor sensors[] = {
+	SENSOR(bt_mesh_sensor_people_count),
+	SENSOR(bt_mesh_sensor_present_amb_light_level),
+	SENSOR(bt_mesh_sensor_present_amb_temp),
+	SENSOR(bt_mesh_sensor_present_dev_input_power),
+	SENSOR(bt_mesh_sensor_present_input_current),
+	SENSOR(bt_mesh_sensor_present_input_voltage),
+};
+
+static struct bt_mesh_sensor *const sensor_array[] = {
+	&sensors[0], &sensors[1], &sensors[2], &sensors[3], &sensors[4], &sensors[5],
+};
+
+static struct bt_mesh_sensor_srv sensor_srv =
+	BT_MESH_SENSOR_SRV_INIT(sensor_array, ARRAY_SIZE(sensor_array));
+
+static const struct bt_mesh_model mock_sensor_model = {
+	.rt = &(struct bt_mesh_model_rt_ctx){.user_data = &sensor_srv}};
+
+static float samples[ARRAY_SIZE(sensors)];
+static uint32_t get_cnt;
+static uint32_t encoded_len;
+
+/** Mocks ******************************************/
+
+static int sensor_get(struct bt_mesh_sensor_srv *srv, struct bt_mesh_sensor *sensor,
+		      struct bt_mesh_msg_ctx *ctx, struct bt_mesh_sensor_value *rsp)
+{
+	get_cnt++;
+
+	return bt_mesh_sensor_value_from_float(sensor->type->channels[0].format,
+					       samples[sensor - sensors], rsp);
+}
+
+void bt_mesh_model_msg_init(struct net_buf_simple *msg, uint32_t opcode)
+{
+	net_buf_simple_init(msg, 0);
+	net_buf_simple_add_u8(msg, opcode);
+}
+
+int32_t bt_mesh_model_pub_period_get(const struct bt_mesh_model *mod)
+{
+	return PUB_PERIOD;
+}
+
+int bt_mesh_msg_send(const struct bt_mesh_model *model, struct bt_mesh_msg_ctx *ctx,
+		     struct net_buf_simple *buf)
+{
+	return 0;
+}
+
+int bt_mesh_model_send(const struct bt_mesh_model *model, struct bt_mesh_msg_ctx *ctx,
+		       struct net_buf_simple *msg, const struct bt_mesh_send_cb *cb,
+		       void *cb_data)
+{
+	return 0;
+}
+
+int bt_mesh_model_extend(const struct bt_mesh_model *mod, const struct bt_mesh_model *base_mod)
+{
+	return 0;
+}
+
+int bt_mesh_model_correspond(const struct bt_mesh_model *corresponding_mod,
+			     const struct bt_mesh_model *base_mod)
+{
+	return 0;
+}
+
+int bt_mesh_model_data_store(const struct bt_mesh_model *mod, bool vnd, const char *name,
+			     const void *data, size_t data_len)
+{
+	return 0;
+}
+
+void bt_mesh_model_data_store_schedule(const struct bt_mesh_model *mod)
+{
+}
+
+/** End Mocks **************************************/
+
+static void sample_set(int idx, float value)
+{
+	samples[idx] = value;
+
+	if (IS_ENABLED(CONFIG_BT_MESH_SENSOR_SRV_VALUE_CACHE)) {
+		struct bt_mesh_sensor_value val;
+		int err;
+
+		err = bt_mesh_sensor_value_from_float(sensors[idx].type->channels[0].format,
+						      value, &val);
+		zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+		err = bt_mesh_sensor_srv_value_update(&sensor_srv, &sensors[idx], &val);
+		zassert_equal(err, 0, "Unexpected failure: %d", err);
+	}
+}
+
+static int sensor_idx(uint16_t id)
+{
+	for (int i = 0; i < ARRAY_SIZE(sensors); i++) {
+		if (sensors[i].type->id == id) {
+			return i;
+		}
+	}
+
+	zassert_unreachable("Unknown sensor 0x%04x", id);
+	return -1;
+}
+
+/* Runs a periodic publication and returns a bitmask of the published sensors. */
+static uint32_t tick(void)
+{
+	struct net_buf_simple *msg = sensor_srv.pub.msg;
+	struct net_buf_simple_state state;
+	uint32_t published = 0;
+	int prev_id = -1;
+	int err;
+
+	err = sensor_srv.pub.update(&mock_sensor_model);
+	if (err) {
+		zassert_equal(err, -ENOENT, "Unexpected failure: %d", err);
+		return 0;
+	}
+
+	zassert_true(msg->len <= PUB_LEN_MAX, "Publication too long: %u", msg->len);
+	encoded_len += msg->len;
+
+	net_buf_simple_save(msg, &state);
+	zassert_equal(net_buf_simple_pull_u8(msg), BT_MESH_SENSOR_OP_STATUS, "Invalid opcode");
+
+	while (msg->len) {
+		uint16_t id;
+		uint8_t len;
+
+		sensor_status_id_decode(msg, &len, &id);
+		zassert_true(id > prev_id, "Sensors not sorted");
+		prev_id = id;
+
+		net_buf_simple_pull(msg, len);
+		published |= BIT(sensor_idx(id));
+	}
+
+	net_buf_simple_restore(msg, &state);
+
+	return published;
+}
+
+static void cadence_configure(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(sensors); i++) {
+		const struct bt_mesh_sensor_format *format = sensors[i].type->channels[0].format;
+		struct bt_mesh_sensor_threshold *threshold = &sensors[i].state.threshold;
+
+		zassert_ok(bt_mesh_sensor_value_from_float(format, DELTA, &threshold->deltas.up));
+		zassert_ok(bt_mesh_sensor_value_from_float(format, DELTA, &threshold->deltas.down));
+		zassert_ok(bt_mesh_sensor_value_from_float(format, 0.0f, &threshold->range.low));
+		zassert_ok(bt_mesh_sensor_value_from_float(format, RANGE_HIGH,
+							   &threshold->range.high));
+		threshold->range.cadence = BT_MESH_SENSOR_CADENCE_NORMAL;
+
+		sensors[i].state.pub_div = PUB_DIV;
+		sensors[i].state.min_int = 0;
+		sensors[i].state.configured = true;
+	}
+
+	sensor_srv.pub.period_div = PUB_DIV;
+}
+
+ZTEST(sensor_srv, test_pub_split)
+{
+	uint32_t all = BIT_MASK(ARRAY_SIZE(sensors));
+	uint32_t first, second;
+
+	first = tick();
+	zassert_not_equal(first, 0, "Nothing published");
+	zassert_not_equal(first, all, "All sensors fit into one publication");
+
+	/* The deferred sensors are published first in the next publication */
+	second = tick();
+	zassert_equal(second & ~first, all & ~first, "Deferred sensors not published");
+
+	for (int i = 0; i < ARRAY_SIZE(sensors); i++) {
+		if (!(first & BIT(i))) {
+			zassert_false(sensors[i].state.deferred, "Sensor %d still deferred", i);
+		}
+	}
+}
+
+ZTEST(sensor_srv, test_encode_work)
+{
+	uint32_t pub_cnt[ARRAY_SIZE(sensors)] = {};
+
+	cadence_configure();
+
+	/* Unchanged values are only published when the publish interval expires */
+	for (int i = 0; i < TICK_COUNT; i++) {
+		uint32_t published = tick();
+
+		for (int j = 0; j < ARRAY_SIZE(sensors); j++) {
+			pub_cnt[j] += !!(published & BIT(j));
+		}
+	}
+
+	TC_PRINT("%u ticks: %u get calls, %u bytes encoded\n", TICK_COUNT, get_cnt,
+		 encoded_len);
+
+	for (int i = 0; i < ARRAY_SIZE(sensors); i++) {
+		zassert_equal(pub_cnt[i], TICK_COUNT / PUB_INTERVAL,
+			      "Sensor %d published %u times", i, pub_cnt[i]);
+	}
+
+	if (IS_ENABLED(CONFIG_BT_MESH_SENSOR_SRV_VALUE_CACHE)) {
+		zassert_equal(get_cnt, 0, "Sensor values read");
+	}
+
+	/* Pass the ticks where the publish intervals of the sensors expire */
+	tick();
+	tick();
+
+	/* A value change beyond the delta threshold is published in the next publication */
+	sample_set(1, samples[1] + 2 * DELTA);
+
+	zassert_equal(tick(), BIT(1), "Changed value not published");
+	zassert_equal(tick(), 0, "Unchanged value published");
+}
+
+ZTEST(sensor_srv, test_value_update)
+{
+	struct bt_mesh_sensor_value val;
+	int err;
+
+	zassert_ok(bt_mesh_sensor_value_from_float(&bt_mesh_sensor_format_temp_8, 1.0f, &val));
+
+	err = bt_mesh_sensor_srv_value_update(&sensor_srv, &sensors[0], &val);
+	if (IS_ENABLED(CONFIG_BT_MESH_SENSOR_SRV_VALUE_CACHE)) {
+		zassert_equal(err, -EINVAL, "Value of another format accepted: %d", err);
+	} else {
+		zassert_equal(err, -ENOTSUP, "Unexpected result: %d", err);
+	}
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (int i = 0; i < ARRAY_SIZE(sensors); i++) {
+		memset(&sensors[i].state, 0, sizeof(sensors[i].state));
+	}
+
+	zassert_ok(_bt_mesh_sensor_srv_cb.init(&mock_sensor_model));
+	sensor_srv.pub.period_div = 0;
+
+	for (int i = 0; i < ARRAY_SIZE(sensors); i++) {
+		sample_set(i, 10.0f * (i + 1));
+	}
+
+	get_cnt = 0;
+	encoded_len = 0;
+}
+
+ZTEST_SUITE(sensor_srv, NULL, NULL, before, NULL, NULL);
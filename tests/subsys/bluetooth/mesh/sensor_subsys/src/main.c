@@ -975,4 +975,59 @@ TEST_SENSOR_TYPE(rel_dev_runtime_in_a_generic_level_range, 0x0061,
 
 TEST_SENSOR_TYPE(total_dev_runtime, 0x006e, CHANNEL(time_hour_24, 3))
 
+ZTEST(sensor_types_test, test_type_registry_sorted)
+{
+	const struct bt_mesh_sensor_type *prev = NULL;
+
+	/* bt_mesh_sensor_type_get() relies on the types being sorted by ID */
+	STRUCT_SECTION_FOREACH(bt_mesh_sensor_type, type) {
+		if (prev) {
+			zassert_true(prev->id < type->id,
+				     "Sensor type 0x%04x placed after 0x%04x", type->id, prev->id);
+		}
+
+		zassert_equal(bt_mesh_sensor_type_get(type->id), type);
+		prev = type;
+	}
+
+	zassert_not_null(prev, "No sensor types registered");
+	zassert_is_null(bt_mesh_sensor_type_get(BT_MESH_PROP_ID_PROHIBITED));
+	zassert_is_null(bt_mesh_sensor_type_get(0xffff));
+}
+
+#define LOOKUP_ROUNDS 1000
+
+ZTEST(sensor_types_test, test_type_lookup_throughput)
+{
+	uint8_t data[BT_MESH_SENSOR_ENCODED_VALUE_MAXLEN] = {0};
+	struct bt_mesh_sensor_value values[CONFIG_BT_MESH_SENSOR_CHANNELS_MAX];
+	size_t count = 0;
+	int64_t start;
+	int64_t ticks;
+
+	/* Look up and decode a status of every known type, as the Sensor Client does
+	 * for every received Sensor Status message.
+	 */
+	start = k_uptime_ticks();
+
+	for (int i = 0; i < LOOKUP_ROUNDS; i++) {
+		STRUCT_SECTION_FOREACH(bt_mesh_sensor_type, type) {
+			const struct bt_mesh_sensor_type *found = bt_mesh_sensor_type_get(type->id);
+			struct net_buf_simple buf;
+
+			zassert_equal(found, type);
+
+			net_buf_simple_init_with_data(&buf, data, sizeof(data));
+			zassert_ok(sensor_value_decode(&buf, found, values));
+			count++;
+		}
+	}
+
+	ticks = MAX(k_uptime_ticks() - start, 1);
+
+	TC_PRINT("Decoded %zu sensor values in %u us (%llu values/s)\n", count,
+		 k_ticks_to_us_floor32(ticks),
+		 (unsigned long long)count * CONFIG_SYS_CLOCK_TICKS_PER_SEC / ticks);
+}
+
 ZTEST_SUITE(sensor_types_test, NULL, NULL, NULL, NULL, NULL);
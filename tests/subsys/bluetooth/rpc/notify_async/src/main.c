@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <mock_nrf_rpc_transport.h>
+#include <bt_rpc_common.h>
+
+#include <bluetooth/bt_rpc.h>
+#include <zephyr/bluetooth/gatt.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define MAX_COUNT CONFIG_BT_RPC_GATT_NOTIFY_ASYNC_MAX_COUNT
+#define ATTR_INDEX 7
+/* Notification length of which only two fit into the batch buffer */
+#define LONG_LEN 100
+/* Number of notifications streamed in the throughput test */
+#define STREAM_LEN (4 * MAX_COUNT)
+
+/* With a single connection the connection is not encoded, so any pointer identifies it */
+#define TEST_CONN ((struct bt_conn *)0x10)
+
+#define RPC_PKT(bytes...)                                                                          \
+	(mock_nrf_rpc_pkt_t)                                                                       \
+	{                                                                                          \
+		.data = (uint8_t[]){bytes}, .len = sizeof((uint8_t[]){bytes}),                     \
+	}
+
+#define RPC_INIT_REQ RPC_PKT(0x04, 0x00, 0xff, 0x00, 0xff, 0x00, 'b', 't', '_', 'r', 'p', 'c')
+#define RPC_INIT_RSP RPC_PKT(0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 'b', 't', '_', 'r', 'p', 'c')
+#define RPC_ACK(evt) RPC_PKT(0x02, (evt), 0xff, 0xff, 0x00)
+#define NO_RSP	     RPC_PKT()
+
+/* Runtime builder of nRF RPC event packets, which contain function pointers. */
+struct pkt_builder {
+	uint8_t data[512];
+	size_t len;
+};
+
+static struct pkt_builder pkts[STREAM_LEN / MAX_COUNT];
+static const struct bt_gatt_attr test_attr;
+static uint8_t test_data[LONG_LEN];
+
+static int conn_refs;
+static int evt_err;
+static int evt_cnt;
+static int done_cnt;
+static int done_err[MAX_COUNT];
+static uintptr_t done_user_data[MAX_COUNT];
+
+/** Mocks ******************************************/
+
+struct bt_conn *__wrap_bt_conn_ref(struct bt_conn *conn)
+{
+	zassert_equal_ptr(conn, TEST_CONN);
+	conn_refs++;
+
+	return conn;
+}
+
+void __wrap_bt_conn_unref(struct bt_conn *conn)
+{
+	zassert_equal_ptr(conn, TEST_CONN);
+	zassert_true(conn_refs > 0, "Connection reference released twice");
+	conn_refs--;
+}
+
+int __wrap_bt_rpc_gatt_attr_to_index(const struct bt_gatt_attr *attr, uint32_t *index)
+{
+	zassert_equal_ptr(attr, &test_attr);
+	*index = ATTR_INDEX;
+
+	return 0;
+}
+
+int __real_nrf_rpc_cbor_evt(const struct nrf_rpc_group *group, uint8_t evt,
+			    struct nrf_rpc_cbor_ctx *ctx);
+
+int __wrap_nrf_rpc_cbor_evt(const struct nrf_rpc_group *group, uint8_t evt,
+			    struct nrf_rpc_cbor_ctx *ctx)
+{
+	struct nrf_rpc_cbor_ctx dropped;
+
+	evt_cnt++;
+
+	if (evt_err) {
+		dropped = *ctx;
+		NRF_RPC_CBOR_DISCARD(group, dropped);
+		return evt_err;
+	}
+
+	return __real_nrf_rpc_cbor_evt(group, evt, ctx);
+}
+
+static void notify_done(struct bt_conn *conn, int err, void *user_data)
+{
+	zassert_equal_ptr(conn, TEST_CONN);
+	zassert_true(done_cnt < ARRAY_SIZE(done_err), "Too many completions");
+	zassert_true(conn_refs > 0, "Connection released before completion");
+
+	done_err[done_cnt] = err;
+	done_user_data[done_cnt] = (uintptr_t)user_data;
+	done_cnt++;
+}
+
+/** Packet construction ******************************************/
+
+static void pkt_put(struct pkt_builder *pkt, uint8_t byte)
+{
+	zassert_true(pkt->len < sizeof(pkt->data));
+	pkt->data[pkt->len++] = byte;
+}
+
+static void pkt_put_head(struct pkt_builder *pkt, uint8_t major, uint32_t value)
+{
+	if (value < 24) {
+		pkt_put(pkt, major | value);
+	} else if (value <= UINT8_MAX) {
+		pkt_put(pkt, major | 24);
+		pkt_put(pkt, value);
+	} else if (value <= UINT16_MAX) {
+		pkt_put(pkt, major | 25);
+		pkt_put(pkt, value >> 8);
+		pkt_put(pkt, value);
+	} else {
+		pkt_put(pkt, major | 26);
+		pkt_put(pkt, value >> 24);
+		pkt_put(pkt, value >> 16);
+		pkt_put(pkt, value >> 8);
+		pkt_put(pkt, value);
+	}
+}
+
+static void pkt_put_uint(struct pkt_builder *pkt, uint32_t value)
+{
+	pkt_put_head(pkt, 0x00, value);
+}
+
+static void pkt_put_int(struct pkt_builder *pkt, int32_t value)
+{
+	if (value < 0) {
+		pkt_put_head(pkt, 0x20, -1 - value);
+	} else {
+		pkt_put_head(pkt, 0x00, value);
+	}
+}
+
+static void pkt_evt_start(struct pkt_builder *pkt, uint8_t evt, uint32_t count)
+{
+	pkt->len = 0;
+	pkt_put(pkt, 0x00);
+	pkt_put(pkt, evt);
+	pkt_put(pkt, 0xff);
+	pkt_put(pkt, 0xff);
+	pkt_put(pkt, 0x00);
+	pkt_put_uint(pkt, count);
+}
+
+static void pkt_put_notification(struct pkt_builder *pkt, uint16_t len,
+				 bt_rpc_gatt_notify_done_t done, uintptr_t user_data)
+{
+	pkt_put_uint(pkt, ATTR_INDEX);
+	pkt_put_head(pkt, 0x40, len);
+
+	for (uint16_t i = 0; i < len; i++) {
+		pkt_put(pkt, test_data[i]);
+	}
+
+	pkt_put_uint(pkt, (uintptr_t)done);
+	pkt_put_uint(pkt, user_data);
+	pkt_put_uint(pkt, (uintptr_t)TEST_CONN);
+}
+
+static void pkt_put_result(struct pkt_builder *pkt, int err, uintptr_t user_data)
+{
+	pkt_put_uint(pkt, (uintptr_t)TEST_CONN);
+	pkt_put_int(pkt, err);
+	pkt_put_uint(pkt, (uintptr_t)notify_done);
+	pkt_put_uint(pkt, user_data);
+}
+
+static mock_nrf_rpc_pkt_t pkt_end(struct pkt_builder *pkt)
+{
+	pkt_put(pkt, 0xf6);
+
+	return (mock_nrf_rpc_pkt_t){.data = pkt->data, .len = pkt->len};
+}
+
+static void expect_batch(struct pkt_builder *pkt)
+{
+	mock_nrf_rpc_tr_expect_add(pkt_end(pkt), RPC_ACK(BT_RPC_GATT_NOTIFY_ASYNC_RPC_EVT));
+}
+
+/** Tests ******************************************/
+
+ZTEST(bt_rpc_notify_async, test_batch_on_max_count)
+{
+	for (int i = 0; i < MAX_COUNT - 1; i++) {
+		zassert_ok(bt_rpc_gatt_notify_async(TEST_CONN, &test_attr, test_data, 1, NULL,
+						    (void *)(uintptr_t)i));
+	}
+
+	/* Nothing is sent until the batch is complete */
+	zassert_equal(evt_cnt, 0);
+	zassert_equal(conn_refs, MAX_COUNT - 1);
+
+	pkt_evt_start(&pkts[0], BT_RPC_GATT_NOTIFY_ASYNC_RPC_EVT, MAX_COUNT);
+	for (int i = 0; i < MAX_COUNT; i++) {
+		pkt_put_notification(&pkts[0], 1, NULL, i);
+	}
+	expect_batch(&pkts[0]);
+
+	zassert_ok(bt_rpc_gatt_notify_async(TEST_CONN, &test_attr, test_data, 1, NULL,
+					    (void *)(uintptr_t)(MAX_COUNT - 1)));
+	mock_nrf_rpc_tr_expect_done();
+
+	/* Notifications without a completion callback are released once sent */
+	zassert_equal(evt_cnt, 1);
+	zassert_equal(conn_refs, 0);
+}
+
+ZTEST(bt_rpc_notify_async, test_batch_on_full_buffer)
+{
+	zassert_ok(bt_rpc_gatt_notify_async(TEST_CONN, &test_attr, test_data, LONG_LEN, NULL,
+					    (void *)0));
+	zassert_ok(bt_rpc_gatt_notify_async(TEST_CONN, &test_attr, test_data, LONG_LEN, NULL,
+					    (void *)1));
+
+	pkt_evt_start(&pkts[0], BT_RPC_GATT_NOTIFY_ASYNC_RPC_EVT, 2);
+	pkt_put_notification(&pkts[0], LONG_LEN, NULL, 0);
+	pkt_put_notification(&pkts[0], LONG_LEN, NULL, 1);
+	expect_batch(&pkts[0]);
+
+	/* The third notification does not fit, so the first two are sent */
+	zassert_ok(bt_rpc_gatt_notify_async(TEST_CONN, &test_attr, test_data, LONG_LEN, NULL,
+					    (void *)2));
+	mock_nrf_rpc_tr_expect_done();
+	zassert_equal(conn_refs, 1);
+
+	pkt_evt_start(&pkts[1], BT_RPC_GATT_NOTIFY_ASYNC_RPC_EVT, 1);
+	pkt_put_notification(&pkts[1], LONG_LEN, NULL, 2);
+	expect_batch(&pkts[1]);
+
+	zassert_ok(bt_rpc_gatt_notify_flush());
+	mock_nrf_rpc_tr_expect_done();
+	zassert_equal(conn_refs, 0);
+
+	zassert_equal(bt_rpc_gatt_notify_async(TEST_CONN, &test_attr, test_data,
+					       CONFIG_BT_RPC_GATT_NOTIFY_ASYNC_BUF_SIZE, NULL,
+					       NULL),
+		      -EMSGSIZE);
+	zassert_equal(conn_refs, 0);
+}
+
+ZTEST(bt_rpc_notify_async, test_done_reported_by_host)
+{
+	zassert_ok(bt_rpc_gatt_notify_async(TEST_CONN, &test_attr, test_data, 2, notify_done,
+					    (void *)0x100));
+	zassert_ok(bt_rpc_gatt_notify_async(TEST_CONN, &test_attr, test_data, 2, notify_done,
+					    (void *)0x200));
+
+	pkt_evt_start(&pkts[0], BT_RPC_GATT_NOTIFY_ASYNC_RPC_EVT, 2);
+	pkt_put_notification(&pkts[0], 2, notify_done, 0x100);
+	pkt_put_notification(&pkts[0], 2, notify_done, 0x200);
+	expect_batch(&pkts[0]);
+
+	zassert_ok(bt_rpc_gatt_notify_flush());
+	mock_nrf_rpc_tr_expect_done();
+
+	/* The connection is kept until the host reports the results */
+	zassert_equal(done_cnt, 0);
+	zassert_equal(conn_refs, 2);
+
+	pkt_evt_start(&pkts[1], BT_RPC_GATT_NOTIFY_ASYNC_DONE_RPC_EVT, 2);
+	pkt_put_result(&pkts[1], 0, 0x100);
+	pkt_put_result(&pkts[1], -ENOMEM, 0x200);
+
+	mock_nrf_rpc_tr_expect_add(RPC_ACK(BT_RPC_GATT_NOTIFY_ASYNC_DONE_RPC_EVT), NO_RSP);
+	mock_nrf_rpc_tr_receive(pkt_end(&pkts[1]));
+	mock_nrf_rpc_tr_expect_done();
+
+	zassert_equal(done_cnt, 2);
+	zassert_equal(done_err[0], 0);
+	zassert_equal(done_user_data[0], 0x100);
+	zassert_equal(done_err[1], -ENOMEM);
+	zassert_equal(done_user_data[1], 0x200);
+	zassert_equal(conn_refs, 0);
+}
+
+ZTEST(bt_rpc_notify_async, test_done_on_send_failure)
+{
+	zassert_ok(bt_rpc_gatt_notify_async(TEST_CONN, &test_attr, test_data, 2, notify_done,
+					    (void *)0x100));
+	zassert_ok(bt_rpc_gatt_notify_async(TEST_CONN, &test_attr, test_data, 2, NULL, NULL));
+	zassert_ok(bt_rpc_gatt_notify_async(TEST_CONN, &test_attr, test_data, 2, notify_done,
+					    (void *)0x300));
+
+	evt_err = -EIO;
+	zassert_equal(bt_rpc_gatt_notify_flush(), -EIO);
+
+	/* Dropped notifications are completed with the error and released */
+	zassert_equal(done_cnt, 2);
+	zassert_equal(done_err[0], -EIO);
+	zassert_equal(done_user_data[0], 0x100);
+	zassert_equal(done_err[1], -EIO);
+	zassert_equal(done_user_data[1], 0x300);
+	zassert_equal(conn_refs, 0);
+
+	/* Nothing is left to send */
+	evt_err = 0;
+	evt_cnt = 0;
+	zassert_ok(bt_rpc_gatt_notify_flush());
+	zassert_equal(evt_cnt, 0);
+}
+
+ZTEST(bt_rpc_notify_async, test_throughput)
+{
+	uint32_t start;
+	uint32_t cycles;
+
+	for (int i = 0; i < ARRAY_SIZE(pkts); i++) {
+		pkt_evt_start(&pkts[i], BT_RPC_GATT_NOTIFY_ASYNC_RPC_EVT, MAX_COUNT);
+		for (int j = 0; j < MAX_COUNT; j++) {
+			pkt_put_notification(&pkts[i], 20, NULL, i * MAX_COUNT + j);
+		}
+		expect_batch(&pkts[i]);
+	}
+
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < STREAM_LEN; i++) {
+		zassert_ok(bt_rpc_gatt_notify_async(TEST_CONN, &test_attr, test_data, 20, NULL,
+						    (void *)(uintptr_t)i));
+	}
+
+	cycles = k_cycle_get_32() - start;
+	mock_nrf_rpc_tr_expect_done();
+
+	/* A stream of notifications takes one RPC event per batch, without a response */
+	zassert_equal(evt_cnt, STREAM_LEN / MAX_COUNT);
+	zassert_equal(conn_refs, 0);
+
+	TC_PRINT("%d notifications in %d RPC events, %u ns per notification\n", STREAM_LEN,
+		 evt_cnt, (uint32_t)(k_cyc_to_ns_floor64(cycles) / STREAM_LEN));
+}
+
+static void nrf_rpc_err_handler(const struct nrf_rpc_err_report *report)
+{
+	zassert_ok(report->code);
+}
+
+static void *setup(void)
+{
+	for (size_t i = 0; i < sizeof(test_data); i++) {
+		test_data[i] = i;
+	}
+
+	mock_nrf_rpc_tr_expect_add(RPC_INIT_REQ, RPC_INIT_RSP);
+	zassert_ok(nrf_rpc_init(nrf_rpc_err_handler));
+	mock_nrf_rpc_tr_expect_reset();
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	mock_nrf_rpc_tr_expect_reset();
+	conn_refs = 0;
+	evt_err = 0;
+	evt_cnt = 0;
+	done_cnt = 0;
+}
+
+ZTEST_SUITE(bt_rpc_notify_async, NULL, setup, before, NULL, NULL);
@@ -0,0 +1,396 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/sys/byteorder.h>
+#include <bluetooth/scan.h>
+
+/* Number of advertisers in the replay benchmark */
+#define REPLAY_DEVICES 256
+/* Number of reports of each advertiser in the replay benchmark */
+#define REPLAY_ROUNDS 100
+#define REPLAY_REPORTS (REPLAY_ROUNDS * REPLAY_DEVICES)
+
+#define ADDR_FILTERS 32
+#define UUID_FILTERS 8
+#define COMPANY_ID 0x0059
+
+static struct bt_le_scan_cb *scan_cb;
+static uint32_t match_cnt;
+static uint32_t no_match_cnt;
+static struct bt_scan_filter_match last_match;
+
+NET_BUF_SIMPLE_DEFINE_STATIC(adv_buf, BT_GAP_ADV_MAX_ADV_DATA_LEN);
+
+/** Mocks ******************************************/
+
+/* Capture the callback of the scan library to replay reports to it */
+int bt_le_scan_cb_register(struct bt_le_scan_cb *cb)
+{
+	scan_cb = cb;
+	return 0;
+}
+
+int bt_le_scan_start(const struct bt_le_scan_param *param, bt_le_scan_cb_t cb)
+{
+	return 0;
+}
+
+int bt_le_scan_stop(void)
+{
+	return 0;
+}
+
+void bt_data_parse(struct net_buf_simple *ad,
+		   bool (*func)(struct bt_data *data, void *user_data),
+		   void *user_data)
+{
+	while (ad->len > 1) {
+		struct bt_data data;
+		uint8_t len;
+
+		len = net_buf_simple_pull_u8(ad);
+		if (len == 0U || len > ad->len) {
+			return;
+		}
+
+		data.type = net_buf_simple_pull_u8(ad);
+		data.data_len = len - 1;
+		data.data = ad->data;
+
+		if (!func(&data, user_data)) {
+			return;
+		}
+
+		net_buf_simple_pull(ad, len - 1);
+	}
+}
+
+/** End Mocks **************************************/
+
+static void filter_match(struct bt_scan_device_info *device_info,
+			 struct bt_scan_filter_match *filter_match,
+			 bool connectable)
+{
+	match_cnt++;
+	last_match = *filter_match;
+}
+
+static void filter_no_match(struct bt_scan_device_info *device_info,
+			    bool connectable)
+{
+	no_match_cnt++;
+}
+
+BT_SCAN_CB_INIT(scan_cb_data, filter_match, filter_no_match, NULL, NULL);
+
+static void ad_add(struct net_buf_simple *buf, uint8_t type, const void *data,
+		   uint8_t len)
+{
+	net_buf_simple_add_u8(buf, len + 1);
+	net_buf_simple_add_u8(buf, type);
+	net_buf_simple_add_mem(buf, data, len);
+}
+
+static void report_recv(const bt_addr_le_t *addr, struct net_buf_simple *buf)
+{
+	struct bt_le_scan_recv_info info = {
+		.addr = addr,
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+	};
+
+	zassert_not_null(scan_cb, "Scan callback not registered");
+	scan_cb->recv(&info, buf);
+}
+
+static void device_addr(bt_addr_le_t *addr, uint32_t idx)
+{
+	addr->type = BT_ADDR_LE_RANDOM;
+	sys_put_le32(0x5a000000 | idx, addr->a.val);
+	addr->a.val[4] = 0x12;
+	addr->a.val[5] = 0xc0;
+}
+
+/* 16-bit UUID advertised by the device. Every fourth device advertises one
+ * of the filtered UUIDs.
+ */
+static uint16_t device_uuid(uint32_t idx)
+{
+	return (idx % 4) ? 0x2000 + idx : 0x1800 + (idx / 4) % (2 * UUID_FILTERS);
+}
+
+/* Builds a typical advertising report of the device. */
+static void device_report_build(struct net_buf_simple *buf, uint32_t idx)
+{
+	uint8_t flags = BT_LE_AD_GENERAL | BT_LE_AD_NO_BREDR;
+	uint8_t uuids[3 * sizeof(uint16_t)];
+	uint8_t manufacturer_data[4];
+	char name[12];
+
+	net_buf_simple_reset(buf);
+
+	ad_add(buf, BT_DATA_FLAGS, &flags, sizeof(flags));
+
+	sys_put_le16(0x3000 + idx, &uuids[0]);
+	sys_put_le16(device_uuid(idx), &uuids[2]);
+	sys_put_le16(0x4000 + idx, &uuids[4]);
+	ad_add(buf, BT_DATA_UUID16_ALL, uuids, sizeof(uuids));
+
+	snprintk(name, sizeof(name), "Device %u", idx);
+	ad_add(buf, BT_DATA_NAME_COMPLETE, name, strlen(name));
+
+	sys_put_le16(COMPANY_ID, &manufacturer_data[0]);
+	sys_put_le16(idx, &manufacturer_data[2]);
+	ad_add(buf, BT_DATA_MANUFACTURER_DATA, manufacturer_data,
+	       sizeof(manufacturer_data));
+}
+
+ZTEST(bt_scan, test_addr_filter)
+{
+	bt_addr_le_t addr;
+
+	/* Filter on every other device */
+	for (uint32_t i = 0; i < ADDR_FILTERS; i++) {
+		device_addr(&addr, 2 * i);
+		zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr));
+	}
+
+	device_addr(&addr, 1);
+	zassert_equal(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr), -ENOMEM,
+		      "Filter added beyond the limit");
+
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_ADDR_FILTER, false));
+
+	for (uint32_t i = 0; i < 2 * ADDR_FILTERS + 8; i++) {
+		uint32_t prev_match_cnt = match_cnt;
+
+		device_addr(&addr, i);
+		device_report_build(&adv_buf, i);
+		report_recv(&addr, &adv_buf);
+
+		if ((i % 2) == 0 && i < 2 * ADDR_FILTERS) {
+			zassert_equal(match_cnt, prev_match_cnt + 1, "Device %u not matched", i);
+			zassert_true(bt_addr_le_eq(last_match.addr.addr, &addr),
+				     "Unexpected address matched");
+		} else {
+			zassert_equal(match_cnt, prev_match_cnt, "Device %u matched", i);
+		}
+	}
+}
+
+ZTEST(bt_scan, test_uuid_filter_types)
+{
+	/* The 128-bit form of a 16-bit UUID matches the 16-bit UUID */
+	static const struct bt_uuid_128 hrs_128 = BT_UUID_INIT_128(
+		BT_UUID_128_ENCODE(0x0000180d, 0x0000, 0x1000, 0x8000, 0x00805f9b34fb));
+	uint8_t uuid[BT_UUID_SIZE_128];
+	bt_addr_le_t addr;
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, &hrs_128));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_BAS));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_HRS),
+		   "Duplicate filter of another UUID type not accepted");
+
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_UUID_FILTER, false));
+
+	device_addr(&addr, 0);
+
+	net_buf_simple_reset(&adv_buf);
+	sys_put_le16(BT_UUID_HRS_VAL, uuid);
+	ad_add(&adv_buf, BT_DATA_UUID16_SOME, uuid, sizeof(uint16_t));
+	report_recv(&addr, &adv_buf);
+	zassert_equal(match_cnt, 1, "16-bit UUID not matched");
+	zassert_equal(last_match.uuid.count, 1, "Unexpected match count");
+
+	net_buf_simple_reset(&adv_buf);
+	sys_put_le32(BT_UUID_BAS_VAL, uuid);
+	ad_add(&adv_buf, BT_DATA_UUID32_SOME, uuid, sizeof(uint32_t));
+	report_recv(&addr, &adv_buf);
+	zassert_equal(match_cnt, 2, "32-bit UUID not matched");
+
+	net_buf_simple_reset(&adv_buf);
+	memcpy(uuid, hrs_128.val, sizeof(uuid));
+	uuid[12]++;
+	ad_add(&adv_buf, BT_DATA_UUID128_ALL, uuid, sizeof(uuid));
+	report_recv(&addr, &adv_buf);
+	zassert_equal(match_cnt, 2, "Unexpected UUID matched");
+	zassert_equal(no_match_cnt, 1, "No match not reported");
+}
+
+ZTEST(bt_scan, test_uuid_filter_all_mode)
+{
+	uint8_t uuids[2 * sizeof(uint16_t)];
+	bt_addr_le_t addr;
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_HIDS));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_BAS));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_UUID_FILTER, true));
+
+	device_addr(&addr, 0);
+
+	/* All UUIDs in any order */
+	net_buf_simple_reset(&adv_buf);
+	sys_put_le16(BT_UUID_BAS_VAL, &uuids[0]);
+	sys_put_le16(BT_UUID_HIDS_VAL, &uuids[2]);
+	ad_add(&adv_buf, BT_DATA_UUID16_ALL, uuids, sizeof(uuids));
+	report_recv(&addr, &adv_buf);
+	zassert_equal(match_cnt, 1, "All UUIDs not matched");
+	zassert_equal(last_match.uuid.count, 2, "Unexpected match count");
+	zassert_true(!bt_uuid_cmp(last_match.uuid.uuid[0], BT_UUID_HIDS),
+		     "Matched UUIDs not in filter order");
+	zassert_true(!bt_uuid_cmp(last_match.uuid.uuid[1], BT_UUID_BAS),
+		     "Matched UUIDs not in filter order");
+
+	/* A single UUID is not enough */
+	net_buf_simple_reset(&adv_buf);
+	ad_add(&adv_buf, BT_DATA_UUID16_ALL, uuids, sizeof(uint16_t));
+	report_recv(&addr, &adv_buf);
+	zassert_equal(match_cnt, 1, "Partial UUID list matched");
+	zassert_equal(no_match_cnt, 1, "No match not reported");
+}
+
+ZTEST(bt_scan, test_name_filter)
+{
+	static const struct bt_scan_short_name short_name = {
+		.name = "Thingy",
+		.min_len = 4,
+	};
+	bt_addr_le_t addr;
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Device 7"));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_SHORT_NAME, &short_name));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_NAME_FILTER | BT_SCAN_SHORT_NAME_FILTER,
+					 false));
+
+	device_addr(&addr, 0);
+
+	device_report_build(&adv_buf, 7);
+	report_recv(&addr, &adv_buf);
+	zassert_equal(match_cnt, 1, "Name not matched");
+	zassert_true(last_match.name.match, "Name match not reported");
+
+	device_report_build(&adv_buf, 8);
+	report_recv(&addr, &adv_buf);
+	zassert_equal(match_cnt, 1, "Other name matched");
+
+	net_buf_simple_reset(&adv_buf);
+	ad_add(&adv_buf, BT_DATA_NAME_SHORTENED, "Thin", 4);
+	report_recv(&addr, &adv_buf);
+	zassert_equal(match_cnt, 2, "Short name not matched");
+	zassert_true(last_match.short_name.match, "Short name match not reported");
+
+	net_buf_simple_reset(&adv_buf);
+	ad_add(&adv_buf, BT_DATA_NAME_SHORTENED, "Thi", 3);
+	report_recv(&addr, &adv_buf);
+	zassert_equal(match_cnt, 2, "Too short name matched");
+
+	net_buf_simple_reset(&adv_buf);
+	ad_add(&adv_buf, BT_DATA_NAME_SHORTENED, "Xhingy", 6);
+	report_recv(&addr, &adv_buf);
+	zassert_equal(match_cnt, 2, "Other short name matched");
+}
+
+ZTEST(bt_scan, test_replay)
+{
+	struct bt_scan_manufacturer_data manufacturer_data = {
+		.data = (uint8_t[]){ 0x00, 0x00, 0xff, 0xff },
+		.data_len = 4,
+	};
+	uint32_t expected_addr = 0;
+	uint32_t expected_uuid = 0;
+	uint32_t expected_match = 0;
+	struct bt_scan_stats stats;
+	bt_addr_le_t addr;
+	uint32_t start;
+	uint64_t elapsed_ns;
+
+	/* Filters of a typical application looking for known devices */
+	for (uint32_t i = 0; i < ADDR_FILTERS; i++) {
+		device_addr(&addr, 3 * i);
+		zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr));
+	}
+
+	for (uint32_t i = 0; i < UUID_FILTERS; i++) {
+		zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID,
+					      BT_UUID_DECLARE_16(0x1800 + i)));
+	}
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Sensor"));
+	sys_put_le16(COMPANY_ID, manufacturer_data.data);
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_MANUFACTURER_DATA,
+				      &manufacturer_data));
+
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_ADDR_FILTER | BT_SCAN_UUID_FILTER |
+					 BT_SCAN_NAME_FILTER |
+					 BT_SCAN_MANUFACTURER_DATA_FILTER, false));
+
+	for (uint32_t i = 0; i < REPLAY_DEVICES; i++) {
+		bool addr_match = (i % 3) == 0 && i < 3 * ADDR_FILTERS;
+		bool uuid_match = (device_uuid(i) - 0x1800) < UUID_FILTERS;
+
+		expected_addr += addr_match;
+		expected_uuid += uuid_match;
+		expected_match += addr_match || uuid_match;
+	}
+
+	bt_scan_stats_reset();
+
+	start = k_cycle_get_32();
+
+	for (uint32_t i = 0; i < REPLAY_REPORTS; i++) {
+		uint32_t idx = i % REPLAY_DEVICES;
+
+		device_addr(&addr, idx);
+		device_report_build(&adv_buf, idx);
+		report_recv(&addr, &adv_buf);
+	}
+
+	elapsed_ns = k_cyc_to_ns_floor64(k_cycle_get_32() - start);
+
+	zassert_ok(bt_scan_stats_get(&stats));
+
+	TC_PRINT("%u reports in %llu us: %u matches, %u address, %u UUID\n",
+		 stats.reports, elapsed_ns / NSEC_PER_USEC, stats.filter_matches,
+		 stats.addr_matches, stats.uuid_matches);
+
+	zassert_equal(stats.reports, REPLAY_REPORTS, "Unexpected report count");
+	zassert_equal(stats.addr_matches, expected_addr * REPLAY_ROUNDS,
+		      "Unexpected address match count");
+	zassert_equal(stats.uuid_matches, expected_uuid * REPLAY_ROUNDS,
+		      "Unexpected UUID match count");
+	zassert_equal(stats.name_matches, 0, "Unexpected name matches");
+	zassert_equal(stats.manufacturer_data_matches, 0,
+		      "Unexpected manufacturer data matches");
+	zassert_equal(stats.filter_matches, expected_match * REPLAY_ROUNDS,
+		      "Unexpected match count");
+	zassert_equal(stats.filter_matches + stats.filter_no_matches, REPLAY_REPORTS,
+		      "Reports not accounted for");
+	zassert_equal(match_cnt, stats.filter_matches, "Match callbacks not called");
+}
+
+static void *setup(void)
+{
+	bt_scan_init(NULL);
+	bt_scan_cb_register(&scan_cb_data);
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	bt_scan_filter_remove_all();
+	bt_scan_filter_disable();
+	bt_scan_stats_reset();
+
+	match_cnt = 0;
+	no_match_cnt = 0;
+	memset(&last_match, 0, sizeof(last_match));
+}
+
+ZTEST_SUITE(bt_scan, NULL, setup, before, NULL, NULL);
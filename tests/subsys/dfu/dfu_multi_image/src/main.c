@@ -44,6 +44,8 @@ struct comparison_context {
 	struct expected expected;
 	size_t current_image_no;
 	size_t current_image_offset;
+	size_t prepared_image_count;
+	bool use_prepare;
 };
 
 static struct comparison_context ctx;
@@ -57,6 +59,11 @@ static int image_comparator_open(int image_id, size_t image_size)
 		      "Unexpected image size");
 	zassert_equal(ctx.current_image_offset, 0, "Opening image while already in progress");
 
+	if (ctx.use_prepare) {
+		zassert_equal(ctx.prepared_image_count, ctx.expected.image_count,
+			      "Opening image before all images are prepared");
+	}
+
 	return 0;
 }
 
@@ -84,6 +91,22 @@ static int image_comparator_close(bool success)
 	return 0;
 }
 
+static int image_comparator_prepare(int image_id, size_t image_size)
+{
+	const struct expected_image *image = &ctx.expected.images[ctx.prepared_image_count];
+
+	zassert_true(ctx.prepared_image_count < ctx.expected.image_count,
+		     "Too many images prepared");
+	zassert_equal(ctx.current_image_no, 0, "Preparing image after writing started");
+	zassert_equal(ctx.current_image_offset, 0, "Preparing image after writing started");
+	zassert_equal(image->image_id, image_id, "Unexpected image id");
+	zassert_equal(image->content_size, image_size, "Unexpected image size");
+
+	ctx.prepared_image_count++;
+
+	return 0;
+}
+
 /*
  * Generic test that verifies that expected image data is written while downloading and
  * unpacking a given DFU Multi Image package.
@@ -98,6 +121,7 @@ static int comparison_test(const uint8_t *package, size_t package_size,
 	ctx.expected = *expected;
 	ctx.current_image_no = 0;
 	ctx.current_image_offset = 0;
+	ctx.prepared_image_count = 0;
 
 	/* Initialize DFU and register image writers for all expected images */
 
@@ -111,7 +135,9 @@ static int comparison_test(const uint8_t *package, size_t package_size,
 		struct dfu_image_writer writer = { .image_id = expected->images[i].image_id,
 						   .open = image_comparator_open,
 						   .write = image_comparator_write,
-						   .close = image_comparator_close };
+						   .close = image_comparator_close,
+						   .prepare = ctx.use_prepare ?
+							   image_comparator_prepare : NULL };
 
 		err = dfu_multi_image_register_writer(&writer);
 
@@ -267,4 +293,49 @@ ZTEST(dfu_multi_image_test, test_generated_dfu_package)
 		   "DFU failed");
 }
 
-ZTEST_SUITE(dfu_multi_image_test, NULL, NULL, NULL, NULL, NULL);
+ZTEST(dfu_multi_image_test, test_prepare)
+{
+	uint8_t buffer[128];
+
+	/*
+	 * Test that all images are prepared as soon as the header is parsed, before
+	 * the first image is opened.
+	 */
+	ctx.use_prepare = true;
+	zassert_ok(comparison_test(two_image_package, sizeof(two_image_package),
+				   &two_image_package_expected, buffer, sizeof(buffer), 1),
+		   "DFU failed");
+	zassert_equal(ctx.prepared_image_count, 2, "Not all images prepared");
+}
+
+ZTEST(dfu_multi_image_test, test_stats)
+{
+	uint8_t buffer[128];
+	struct dfu_image_stats stats;
+
+	zassert_ok(comparison_test(two_image_package, sizeof(two_image_package),
+				   &two_image_package_expected, buffer, sizeof(buffer), 10),
+		   "DFU failed");
+
+	for (size_t i = 0; i < two_image_package_expected.image_count; i++) {
+		const struct expected_image *image = &two_image_package_expected.images[i];
+
+		zassert_ok(dfu_multi_image_stats_get(i, &stats), "Failed to get statistics");
+		zassert_equal(stats.image_id, image->image_id, "Unexpected image id");
+		zassert_equal(stats.image_size, image->content_size, "Unexpected image size");
+		zassert_equal(stats.bytes_written, image->content_size, "Unexpected write count");
+		zassert_true(stats.write_time_us <= stats.elapsed_time_us,
+			     "Write time exceeds elapsed time");
+	}
+
+	zassert_equal(dfu_multi_image_stats_get(2, &stats), -ENOENT, "Unexpected image found");
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	ctx.use_prepare = false;
+}
+
+ZTEST_SUITE(dfu_multi_image_test, NULL, NULL, before, NULL, NULL);
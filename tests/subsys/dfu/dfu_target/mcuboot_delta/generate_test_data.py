@@ -0,0 +1,44 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+"""
+Generate the source and target images and the delta patches used by the test.
+"""
+
+import random
+import sys
+from pathlib import Path
+
+
+def main():
+    sys.path.insert(0, sys.argv[1])
+    from mcuboot_delta_tool import generate_patch
+
+    output_dir = Path(sys.argv[2])
+    output_dir.mkdir(parents=True, exist_ok=True)
+
+    rand = random.Random(0)
+    source = bytes(rand.getrandbits(8) for _ in range(16 * 1024))
+    target = bytearray(source)
+    target[1000:1000] = bytes(rand.getrandbits(8) for _ in range(100))
+    for offset in range(6000, 6040, 4):
+        target[offset] ^= 0x01
+    del target[9000:9500]
+    target += b'appended' * 64
+
+    files = {
+        'source': source,
+        'target': bytes(target),
+        'patch': generate_patch(source, bytes(target), False),
+        'patch_lzma': generate_patch(source, bytes(target), True),
+    }
+
+    for name, data in files.items():
+        (output_dir / f'{name}.bin').write_bytes(data)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <string.h>
+#include <zephyr/storage/flash_map.h>
+#include <dfu/dfu_target_mcuboot.h>
+#include <dfu/dfu_target_mcuboot_delta.h>
+
+/* Write chunk size which does not match any record or buffer boundary */
+#define CHUNK_LEN 37
+
+static const uint8_t source_image[] = {
+#include "source.inc"
+};
+
+static const uint8_t target_image[] = {
+#include "target.inc"
+};
+
+static const uint8_t patch[] = {
+#include "patch.inc"
+};
+
+static const uint8_t patch_lzma[] = {
+#include "patch_lzma.inc"
+};
+
+/* Stubs of the MCUBoot target, which collect the produced image in RAM */
+static uint8_t written[sizeof(target_image) + 1024];
+static size_t written_len;
+static int init_cnt;
+static int reset_cnt;
+static int done_cnt;
+static bool done_successful;
+
+int dfu_target_mcuboot_init(size_t file_size, int img_num, dfu_target_callback_t cb)
+{
+	init_cnt++;
+	return 0;
+}
+
+int dfu_target_mcuboot_offset_get(size_t *offset)
+{
+	*offset = written_len;
+	return 0;
+}
+
+int dfu_target_mcuboot_write(const void *const buf, size_t len)
+{
+	zassert_true(written_len + len <= sizeof(written), "Too much data written");
+	memcpy(&written[written_len], buf, len);
+	written_len += len;
+	return 0;
+}
+
+int dfu_target_mcuboot_done(bool successful)
+{
+	done_cnt++;
+	done_successful = successful;
+	return 0;
+}
+
+int dfu_target_mcuboot_schedule_update(int img_num)
+{
+	return 0;
+}
+
+int dfu_target_mcuboot_reset(void)
+{
+	reset_cnt++;
+	written_len = 0;
+	return 0;
+}
+
+static void write_patch(const uint8_t *data, size_t len)
+{
+	int err;
+
+	for (size_t pos = 0; pos < len; pos += CHUNK_LEN) {
+		err = dfu_target_mcuboot_delta_write(&data[pos], MIN(CHUNK_LEN, len - pos));
+		zassert_equal(err, 0, "Unexpected failure: %d", err);
+	}
+}
+
+static void write_source(const uint8_t *data, size_t len)
+{
+	int err;
+	const struct flash_area *fa;
+
+	err = flash_area_open(FIXED_PARTITION_ID(slot0_partition), &fa);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = flash_area_flatten(fa, 0, ROUND_UP(len, 4096));
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = flash_area_write(fa, 0, data, len);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	flash_area_close(fa);
+}
+
+static void apply_patch(const uint8_t *data, size_t len)
+{
+	int err;
+	size_t offset;
+
+	err = dfu_target_mcuboot_delta_init(len, 0, NULL);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	write_patch(data, len);
+
+	err = dfu_target_mcuboot_delta_offset_get(&offset);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_equal(offset, len, "Unexpected offset");
+
+	err = dfu_target_mcuboot_delta_done(true);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_true(done_successful, "MCUBoot target not finalized");
+
+	zassert_equal(written_len, sizeof(target_image), "Unexpected image size");
+	zassert_mem_equal(written, target_image, sizeof(target_image), "Incorrect image");
+}
+
+ZTEST(dfu_target_mcuboot_delta, test_identify)
+{
+	uint8_t mcuboot_header[32] = {0x3d, 0xb8, 0xf3, 0x96};
+
+	zassert_true(dfu_target_mcuboot_delta_identify(patch), "Patch not identified");
+	zassert_true(dfu_target_mcuboot_delta_identify(patch_lzma), "Patch not identified");
+	zassert_false(dfu_target_mcuboot_delta_identify(mcuboot_header),
+		      "MCUBoot image identified as patch");
+}
+
+ZTEST(dfu_target_mcuboot_delta, test_apply)
+{
+	apply_patch(patch, sizeof(patch));
+}
+
+ZTEST(dfu_target_mcuboot_delta, test_apply_lzma)
+{
+	zassert_true(sizeof(patch_lzma) < sizeof(target_image) / 10,
+		     "Compressed patch unexpectedly large");
+
+	apply_patch(patch_lzma, sizeof(patch_lzma));
+}
+
+ZTEST(dfu_target_mcuboot_delta, test_other_source)
+{
+	int err;
+	static uint8_t modified[sizeof(source_image)];
+
+	memcpy(modified, source_image, sizeof(modified));
+	modified[sizeof(modified) / 2] ^= 0xff;
+	write_source(modified, sizeof(modified));
+
+	err = dfu_target_mcuboot_delta_init(sizeof(patch), 0, NULL);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_mcuboot_delta_write(patch, sizeof(patch));
+	zassert_equal(err, -EINVAL, "Patch applied to other source: %d", err);
+	zassert_equal(written_len, 0, "Data written for rejected patch");
+
+	/* The target refuses data until it is reset */
+	err = dfu_target_mcuboot_delta_write(patch, sizeof(patch));
+	zassert_equal(err, -EINVAL, "Unexpected result: %d", err);
+
+	err = dfu_target_mcuboot_delta_reset();
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+}
+
+ZTEST(dfu_target_mcuboot_delta, test_incomplete)
+{
+	int err;
+
+	err = dfu_target_mcuboot_delta_init(sizeof(patch), 0, NULL);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	write_patch(patch, sizeof(patch) / 2);
+
+	err = dfu_target_mcuboot_delta_done(true);
+	zassert_equal(err, -EINVAL, "Incomplete patch accepted: %d", err);
+	zassert_false(done_successful, "MCUBoot target finalized");
+}
+
+ZTEST(dfu_target_mcuboot_delta, test_init_discards_stored_progress)
+{
+	int err;
+
+	/* Progress of an earlier download in the secondary slot */
+	written_len = 128;
+
+	err = dfu_target_mcuboot_delta_init(sizeof(patch), 0, NULL);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_equal(reset_cnt, 1, "Secondary slot not reset");
+	zassert_equal(init_cnt, 2, "MCUBoot target not reinitialized");
+
+	err = dfu_target_mcuboot_delta_init(sizeof(patch), 1, NULL);
+	zassert_equal(err, -ENOTSUP, "Unexpected result: %d", err);
+}
+
+ZTEST(dfu_target_mcuboot_delta, test_interrupted_restarts)
+{
+	int err;
+	size_t offset;
+
+	err = dfu_target_mcuboot_delta_init(sizeof(patch), 0, NULL);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	write_patch(patch, sizeof(patch) / 2);
+
+	/* The download is not resumed, it starts over from the beginning */
+	err = dfu_target_mcuboot_delta_init(sizeof(patch), 0, NULL);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_mcuboot_delta_offset_get(&offset);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_equal(offset, 0, "Download resumed at %zu", offset);
+	zassert_equal(written_len, 0, "Secondary slot not reset");
+
+	apply_patch(patch, sizeof(patch));
+}
+
+ZTEST(dfu_target_mcuboot_delta, test_write_after_done)
+{
+	int err;
+
+	apply_patch(patch, sizeof(patch));
+
+	/* The source slot is closed, data is refused until the next init */
+	err = dfu_target_mcuboot_delta_write(patch, sizeof(patch));
+	zassert_equal(err, -EINVAL, "Unexpected result: %d", err);
+
+	apply_patch(patch, sizeof(patch));
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	written_len = 0;
+	init_cnt = 0;
+	reset_cnt = 0;
+	done_cnt = 0;
+	done_successful = false;
+
+	write_source(source_image, sizeof(source_image));
+	(void)dfu_target_mcuboot_delta_reset();
+	reset_cnt = 0;
+}
+
+ZTEST_SUITE(dfu_target_mcuboot_delta, NULL, NULL, before, NULL, NULL);
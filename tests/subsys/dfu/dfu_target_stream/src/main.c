@@ -11,6 +11,10 @@
 #include <zephyr/ztest.h>
 #include <dfu/dfu_target_stream.h>
 
+#ifdef CONFIG_DFU_TARGET_STREAM_HASH
+#include <psa/crypto.h>
+#endif
+
 #define FLASH_BASE (64*1024)
 #define FLASH_AVAILABLE (16*1024)
 
@@ -24,15 +28,54 @@ static uint8_t sbuf[128];
 static uint8_t read_buf[BUF_LEN];
 static uint8_t write_buf[BUF_LEN] = {[0 ... BUF_LEN - 1] = 0xaa};
 
-#ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
 static int page_size;
-#endif
 
 #define DFU_TARGET_STREAM_INIT(id_, fdev_, buf_, len_, offset_, size_, cb_)  \
 	dfu_target_stream_init(&(struct dfu_target_stream_init) { .id = id_, \
 		.fdev = fdev_, .buf = buf_, .len = len_, .offset = offset_,  \
 		.size = size_, .cb = cb_})
 
+/* Write chunk size which is neither page nor buffer aligned */
+#define CHUNK_LEN 1000
+
+static size_t get_flash_page_size(const struct device *dev)
+{
+	struct flash_driver_api *api = (struct flash_driver_api *) dev->api;
+	const struct flash_pages_layout *layout;
+	size_t layout_size;
+
+	api->page_layout(dev, &layout, &layout_size);
+	return layout->pages_size;
+}
+
+static void check_flash_base_at_page_start(const struct device *dev)
+{
+	uint32_t err;
+	struct flash_pages_info page;
+
+	err = flash_get_page_info_by_offs(dev, FLASH_BASE, &page);
+	__ASSERT(err == 0, "Unexpected failure: %d", err);
+	__ASSERT(page.start_offset == FLASH_BASE,
+		 "Expected FLASH_BASE to be at a page boundary.");
+}
+
+static void write_image(const uint8_t *image, size_t len)
+{
+	int err;
+
+	err = DFU_TARGET_STREAM_INIT(TEST_ID_1, fdev, sbuf, sizeof(sbuf),
+				     FLASH_BASE, FLASH_AVAILABLE, NULL);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	for (size_t pos = 0; pos < len; pos += CHUNK_LEN) {
+		err = dfu_target_stream_write(&image[pos], MIN(CHUNK_LEN, len - pos));
+		zassert_equal(err, 0, "Unexpected failure: %d", err);
+	}
+
+	err = dfu_target_stream_done(true);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+}
+
 ZTEST(dfu_target_stream_test, test_dfu_target_stream)
 {
 	int err;
@@ -249,27 +292,6 @@ ZTEST(dfu_target_stream_test, test_dfu_target_stream_save_progress)
 		      "Expected last erased page offset to be unchanged.");
 }
 
-static size_t get_flash_page_size(const struct device *dev)
-{
-	struct flash_driver_api *api = (struct flash_driver_api *) dev->api;
-	const struct flash_pages_layout *layout;
-	size_t layout_size;
-
-	api->page_layout(dev, &layout, &layout_size);
-	return layout->pages_size;
-}
-
-static void check_flash_base_at_page_start(const struct device *dev)
-{
-	uint32_t err;
-	struct flash_pages_info page;
-
-	err = flash_get_page_info_by_offs(dev, FLASH_BASE, &page);
-	__ASSERT(err == 0, "Unexpected failure: %d", err);
-	__ASSERT(page.start_offset == FLASH_BASE,
-		 "Expected FLASH_BASE to be at a page boundary.");
-}
-
 static void reset_stream_progress(const struct device *dev)
 {
 	int err;
@@ -297,13 +319,111 @@ ZTEST(dfu_target_stream_test, test_dfu_target_stream_save_progress)
 
 #endif
 
+#ifdef CONFIG_DFU_TARGET_STREAM_HASH
+ZTEST(dfu_target_stream_test, test_dfu_target_stream_hash)
+{
+	int err;
+	psa_status_t status;
+	size_t expected_len;
+	uint8_t expected[DFU_TARGET_STREAM_HASH_SIZE];
+	uint8_t hash[DFU_TARGET_STREAM_HASH_SIZE];
+
+	/* Reset state to avoid failure when initializing */
+	err = dfu_target_stream_done(true);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	/* Initializing the stream also initializes the PSA crypto core */
+	write_image(write_buf, sizeof(write_buf));
+
+	status = psa_hash_compute(PSA_ALG_SHA_256, write_buf, sizeof(write_buf),
+				  expected, sizeof(expected), &expected_len);
+	zassert_equal(status, PSA_SUCCESS, "Unexpected failure: %d", status);
+
+	err = dfu_target_stream_hash_get(hash, sizeof(hash) - 1);
+	zassert_equal(err, -ENOMEM, "Unexpected result: %d", err);
+
+	err = dfu_target_stream_hash_get(hash, sizeof(hash));
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_mem_equal(hash, expected, sizeof(expected), "Incorrect digest");
+
+	/* An aborted download does not produce a digest */
+	err = DFU_TARGET_STREAM_INIT(TEST_ID_1, fdev, sbuf, sizeof(sbuf),
+				     FLASH_BASE, FLASH_AVAILABLE, NULL);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_write(write_buf, CHUNK_LEN);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_done(false);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_hash_get(hash, sizeof(hash));
+	zassert_equal(err, -ENODATA, "Unexpected result: %d", err);
+}
+#else
+
+ZTEST(dfu_target_stream_test, test_dfu_target_stream_hash)
+{
+	ztest_test_skip();
+}
+
+#endif
+
+#ifdef CONFIG_DFU_TARGET_STREAM_SKIP_UNCHANGED
+ZTEST(dfu_target_stream_test, test_dfu_target_stream_skip_unchanged)
+{
+	int err;
+	static uint8_t image[BUF_LEN];
+	size_t full_pages = BUF_LEN / page_size;
+
+	zassert_true(full_pages > 1, "BUF_LEN must span more than one page");
+
+	/* Reset state to avoid failure when initializing */
+	err = dfu_target_stream_done(true);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	for (size_t i = 0; i < sizeof(image); i++) {
+		image[i] = i % 251;
+	}
+
+	/* The flash does not contain the image yet, nothing can be skipped */
+	write_image(image, sizeof(image));
+	zassert_equal(dfu_target_stream_skipped_pages_get(), 0,
+		      "Unexpected skipped pages");
+
+	/* Writing the same image again leaves all full pages untouched, the
+	 * trailing partial page is always written.
+	 */
+	write_image(image, sizeof(image));
+	zassert_equal(dfu_target_stream_skipped_pages_get(), full_pages,
+		      "Unexpected skipped pages");
+
+	/* Patch a single byte in the second page, only that page is written */
+	image[page_size + page_size / 2] ^= 0xff;
+	write_image(image, sizeof(image));
+	zassert_equal(dfu_target_stream_skipped_pages_get(), full_pages - 1,
+		      "Unexpected skipped pages");
+
+	err = flash_read(fdev, FLASH_BASE, read_buf, sizeof(image));
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_mem_equal(read_buf, image, sizeof(image), "Incorrect value");
+}
+#else
+
+ZTEST(dfu_target_stream_test, test_dfu_target_stream_skip_unchanged)
+{
+	ztest_test_skip();
+}
+
+#endif
+
 static void *setup(void)
 {
 	__ASSERT_NO_MSG(device_is_ready(fdev));
 
-#ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
 	/* Check that the FLASH_BASE macro is actually at the start of a page,
-	 * since this is important for the validity of the progress test.
+	 * since this is important for the validity of the progress and the
+	 * skip unchanged tests.
 	 */
 	check_flash_base_at_page_start(fdev);
 
@@ -311,6 +431,7 @@ static void *setup(void)
 	__ASSERT(page_size <= BUF_LEN,
 		 "BUF_LEN must be at least one page long");
 
+#ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
 	reset_stream_progress(fdev);
 #endif
 
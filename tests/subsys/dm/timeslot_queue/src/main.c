@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include "dm/timeslot_queue.h"
+#include "dm/time.h"
+
+#define TIMESLOT_LEN_US 10000
+#define MS_TO_TICKS(ms) US_TO_RTC_TICKS((ms) * USEC_PER_MSEC)
+
+static bt_addr_le_t peer_addr(uint8_t peer)
+{
+	bt_addr_le_t addr = {
+		.type = BT_ADDR_LE_RANDOM,
+		.a.val = { peer },
+	};
+
+	return addr;
+}
+
+static int append(uint8_t peer, uint32_t start_ref_tick, uint32_t delay_ms)
+{
+	struct dm_request req = {
+		.role = DM_ROLE_INITIATOR,
+		.bt_addr = peer_addr(peer),
+		.ranging_mode = DM_RANGING_MODE_MCPD,
+		.start_delay_us = delay_ms * USEC_PER_MSEC,
+	};
+
+	return timeslot_queue_append(&req, start_ref_tick, TIMESLOT_LEN_US, TIMESLOT_LEN_US);
+}
+
+static uint8_t pop_peer(void)
+{
+	struct timeslot_request *req = timeslot_queue_peek();
+	uint8_t peer;
+
+	zassert_not_null(req);
+	peer = req->dm_req.bt_addr.a.val[0];
+	timeslot_queue_remove_first();
+
+	return peer;
+}
+
+static struct dm_peer_stats stats_get(uint8_t peer)
+{
+	bt_addr_le_t addr = peer_addr(peer);
+	struct dm_peer_stats stats;
+
+	zassert_ok(timeslot_queue_peer_stats_get(&addr, &stats));
+
+	return stats;
+}
+
+ZTEST(dm_timeslot_queue, test_start_time_order)
+{
+	zassert_ok(append(1, 0, 300));
+	zassert_ok(append(2, 0, 100));
+	zassert_ok(append(3, 0, 200));
+
+	zassert_equal(timeslot_queue_peek()->start_time, MS_TO_TICKS(100));
+	zassert_equal(pop_peer(), 2);
+	zassert_equal(pop_peer(), 3);
+	zassert_equal(pop_peer(), 1);
+	zassert_is_null(timeslot_queue_peek());
+}
+
+ZTEST(dm_timeslot_queue, test_gap_packing)
+{
+	zassert_ok(append(1, 0, 100));
+	zassert_ok(append(2, 0, 200));
+
+	/* Fits between the scheduled timeslots */
+	zassert_ok(append(3, 0, 150));
+	zassert_ok(append(4, 0, 125));
+
+	/* Overlaps with the previous or the next timeslot */
+	zassert_equal(append(5, 0, 160), -EBUSY);
+	zassert_equal(append(5, 0, 185), -EBUSY);
+	zassert_equal(append(5, 0, 100), -EBUSY);
+	zassert_equal(stats_get(5).rejected, 3);
+
+	zassert_equal(pop_peer(), 1);
+	zassert_equal(pop_peer(), 4);
+	zassert_equal(pop_peer(), 3);
+	zassert_equal(pop_peer(), 2);
+}
+
+ZTEST(dm_timeslot_queue, test_same_peer_limit)
+{
+	for (int i = 0; i < CONFIG_DM_TIMESLOT_QUEUE_COUNT_SAME_PEER; i++) {
+		zassert_ok(append(1, 0, 100 * (i + 1)));
+	}
+
+	zassert_equal(append(1, 0, 1000), -EAGAIN);
+	zassert_equal(stats_get(1).scheduled, CONFIG_DM_TIMESLOT_QUEUE_COUNT_SAME_PEER);
+	zassert_equal(stats_get(1).rejected, 1);
+
+	/* The limit is per peer and is released when a timeslot is executed */
+	zassert_ok(append(2, 0, 1000));
+	timeslot_queue_remove_first();
+	zassert_ok(append(1, 0, 1100));
+}
+
+ZTEST(dm_timeslot_queue, test_queue_full)
+{
+	uint8_t peer = CONFIG_DM_TIMESLOT_PEER_COUNT + 1;
+	bt_addr_le_t addr = peer_addr(1);
+	struct dm_peer_stats stats;
+
+	BUILD_ASSERT(CONFIG_DM_TIMESLOT_PEER_COUNT == CONFIG_DM_TIMESLOT_QUEUE_LENGTH);
+
+	for (int i = 0; i < CONFIG_DM_TIMESLOT_QUEUE_LENGTH; i++) {
+		zassert_ok(append(i + 1, 0, 100 * (i + 1)));
+	}
+
+	zassert_equal(append(peer, 0, 2000), -ENOMEM);
+
+	/* The state of a peer without scheduled timeslots is reused */
+	zassert_equal(pop_peer(), 1);
+	zassert_ok(append(peer, 0, 2000));
+	zassert_equal(timeslot_queue_peer_stats_get(&addr, &stats), -ENOENT);
+	zassert_equal(stats_get(peer).scheduled, 1);
+}
+
+ZTEST(dm_timeslot_queue, test_expire)
+{
+	zassert_ok(append(1, 0, 100));
+	zassert_ok(append(2, 0, 200));
+	zassert_ok(append(3, 0, 300));
+
+	zassert_equal(timeslot_queue_expire(0), 0);
+	zassert_equal(timeslot_queue_expire(MS_TO_TICKS(250)), 2);
+	zassert_equal(stats_get(1).missed, 1);
+	zassert_equal(stats_get(2).missed, 1);
+	zassert_equal(stats_get(3).missed, 0);
+	zassert_equal(pop_peer(), 3);
+}
+
+ZTEST(dm_timeslot_queue, test_counter_wrap)
+{
+	uint32_t ref = RTC_COUNTER_MAX - MS_TO_TICKS(50);
+
+	zassert_ok(append(1, ref, 100));
+	zassert_ok(append(2, ref, 20));
+	zassert_ok(append(3, ref, 60));
+
+	/* Timeslots after the wrap are scheduled after the ones before it */
+	zassert_equal(timeslot_queue_expire(ref), 0);
+	zassert_true(timeslot_queue_peek()->start_time > ref);
+	zassert_equal(pop_peer(), 2);
+	zassert_true(timeslot_queue_peek()->start_time < ref);
+	zassert_equal(pop_peer(), 3);
+	zassert_equal(pop_peer(), 1);
+}
+
+ZTEST(dm_timeslot_queue, test_stats)
+{
+	bt_addr_le_t addr = peer_addr(1);
+	struct dm_peer_stats stats;
+
+	zassert_equal(timeslot_queue_peer_stats_get(&addr, &stats), -ENOENT);
+
+	zassert_ok(append(1, 0, 100));
+
+	/* Reports for unknown peers are ignored */
+	addr = peer_addr(2);
+	timeslot_queue_result_report(&addr, true);
+	zassert_equal(timeslot_queue_peer_stats_get(&addr, &stats), -ENOENT);
+
+	addr = peer_addr(1);
+	timeslot_queue_result_report(&addr, false);
+	for (int i = 0; i < 3; i++) {
+		k_msleep(100);
+		timeslot_queue_result_report(&addr, true);
+	}
+
+	stats = stats_get(1);
+	zassert_true(bt_addr_le_eq(&stats.bt_addr, &addr));
+	zassert_equal(stats.scheduled, 1);
+	zassert_equal(stats.rejected, 0);
+	zassert_equal(stats.completed, 3);
+	zassert_equal(stats.failed, 1);
+	zassert_equal(stats.missed, 0);
+	zassert_within(stats.rate_mhz, 10000, 1000, "Invalid rate: %u", stats.rate_mhz);
+
+	timeslot_queue_reset();
+	zassert_equal(timeslot_queue_peer_stats_get(&addr, &stats), -ENOENT);
+	zassert_is_null(timeslot_queue_peek());
+}
+
+ZTEST(dm_timeslot_queue, test_rate_limit)
+{
+	if (CONFIG_DM_TIMESLOT_PEER_MIN_INTERVAL_MS != 100) {
+		ztest_test_skip();
+	}
+
+	zassert_ok(append(1, 0, 200));
+	zassert_equal(append(1, 0, 250), -EAGAIN);
+	zassert_equal(append(1, 0, 100), -EAGAIN);
+	zassert_ok(append(1, 0, 300));
+
+	/* The limit applies only to the same peer */
+	zassert_ok(append(2, 0, 250));
+	zassert_equal(stats_get(1).rejected, 2);
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	timeslot_queue_reset();
+}
+
+ZTEST_SUITE(dm_timeslot_queue, NULL, NULL, before, NULL, NULL);
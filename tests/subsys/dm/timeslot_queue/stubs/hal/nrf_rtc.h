@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RTC_STUB_H__
+#define NRF_RTC_STUB_H__
+
+#include <zephyr/types.h>
+#include <zephyr/sys/util.h>
+
+#define NRF_RTC_INPUT_FREQ 32768
+#define NRF_RTC_COUNTER_MAX 0xFFFFFF
+#define NRF_RTC0 NULL
+
+static inline uint32_t nrf_rtc_counter_get(const void *p_reg)
+{
+	ARG_UNUSED(p_reg);
+
+	return 0;
+}
+
+#endif /* NRF_RTC_STUB_H__ */
@@ -0,0 +1,33 @@
+#!/usr/bin/env bash
+# Copyright (c) 2025 Nordic Semiconductor ASA
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+if [ -z "$1" ]; then
+    echo "error: This script is not meant to be called directly"
+    exit 1
+fi
+
+
+if [ "${ZEPHYR_BASE}" = "" ]; then
+	echo "error: ZEPHYR_BASE must be set"
+	exit 1
+fi
+
+SIM_ID="$1"
+VERBOSITY=2
+shift
+
+# Remaining arguments are passed to both devices, for example "msg_len 256 msg_cnt 100"
+
+source ${ZEPHYR_BASE}/tests/bsim/sh_common.source
+cd ${BSIM_OUT_PATH}/bin
+
+Execute ./bs_nrf52_bsim____nrf_tests_subsys_esb_bsim_prj_conf \
+  -v=${VERBOSITY} -s=${SIM_ID} -d=0 -testid=ptx -argstest "$@"
+
+Execute ./bs_nrf52_bsim____nrf_tests_subsys_esb_bsim_prj_conf \
+  -v=${VERBOSITY} -s=${SIM_ID} -d=1 -testid=prx -argstest "$@"
+
+Execute ./bs_2G4_phy_v1 -v=${VERBOSITY} -s=${SIM_ID} -D=2 -sim_length=20e6
+
+wait_for_background_jobs # Wait for all programs in background and return != 0 if any fails
@@ -0,0 +1,14 @@
+#!/usr/bin/env bash
+# Copyright (c) 2025 Nordic Semiconductor ASA
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+BOARD=nrf52_bsim
+set -ue
+
+: "${ZEPHYR_BASE:?ZEPHYR_BASE must be set to point to the zephyr root directory}"
+
+source ${ZEPHYR_BASE}/tests/bsim/compile.source
+
+app=${ZEPHYR_NRF_MODULE_DIR}tests/subsys/esb/bsim compile
+
+wait_for_background_jobs
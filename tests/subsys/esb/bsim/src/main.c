@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <esb.h>
+#include <esb_msg.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/nrf_clock_control.h>
+
+#include <babblekit/testcase.h>
+#include <bstests.h>
+#include <bs_tracing.h>
+#include <bs_types.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(esb_msg_test, LOG_LEVEL_INF);
+
+extern enum bst_result_t bst_result;
+
+#define PIPE		0
+#define MSG_TIMEOUT_MS	1000
+/* Time given to the PRX to start receiving before the first message is sent */
+#define PTX_START_DELAY_MS 100
+
+static uint32_t msg_len = 256;
+static uint32_t msg_cnt = 100;
+
+static uint8_t msg_buf[CONFIG_ESB_MSG_MAX_SIZE];
+static K_SEM_DEFINE(msg_sem, 0, 1);
+
+/* Written in the ESB event handler context */
+static int sent_err;
+static uint32_t sent_cycles;
+static uint32_t rx_cnt;
+static uint32_t rx_err_cnt;
+
+/* This code is executed by the test framework and not Zephyr */
+static void test_args(int argc, char *argv[])
+{
+	for (int i = 0; (i + 1) < argc; i += 2) {
+		if (strcmp(argv[i], "msg_len") == 0) {
+			msg_len = strtoul(argv[i + 1], NULL, 0);
+		} else if (strcmp(argv[i], "msg_cnt") == 0) {
+			msg_cnt = strtoul(argv[i + 1], NULL, 0);
+		} else {
+			TEST_FAIL("Unknown argument: %s", argv[i]);
+		}
+	}
+
+	if ((msg_len == 0) || (msg_len > CONFIG_ESB_MSG_MAX_SIZE) || (msg_cnt == 0)) {
+		TEST_FAIL("Invalid arguments");
+	}
+}
+
+/* Every message has different content, so that swapped or repeated messages are detected */
+static void msg_fill(uint8_t *buf, uint32_t idx)
+{
+	for (uint32_t i = 0; i < msg_len; i++) {
+		buf[i] = (uint8_t)(idx + i);
+	}
+}
+
+static bool msg_valid(const uint8_t *data, size_t len, uint32_t idx)
+{
+	if (len != msg_len) {
+		return false;
+	}
+
+	for (uint32_t i = 0; i < len; i++) {
+		if (data[i] != (uint8_t)(idx + i)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void msg_sent(uint8_t pipe, int err)
+{
+	sent_cycles = k_cycle_get_32();
+	sent_err = err;
+	k_sem_give(&msg_sem);
+}
+
+static void msg_received(uint8_t pipe, const uint8_t *data, size_t len)
+{
+	if (!msg_valid(data, len, rx_cnt)) {
+		rx_err_cnt++;
+	}
+
+	rx_cnt++;
+
+	if (rx_cnt == msg_cnt) {
+		k_sem_give(&msg_sem);
+	}
+}
+
+static const struct esb_msg_cb msg_callbacks = {
+	.sent = msg_sent,
+	.received = msg_received,
+};
+
+static void event_handler(struct esb_evt const *event)
+{
+	esb_msg_event_handle(event);
+}
+
+static int clocks_start(void)
+{
+	struct onoff_manager *clk_mgr;
+	struct onoff_client clk_cli;
+	int err;
+	int res;
+
+	clk_mgr = z_nrf_clock_control_get_onoff(CLOCK_CONTROL_NRF_SUBSYS_HF);
+	if (!clk_mgr) {
+		return -ENXIO;
+	}
+
+	sys_notify_init_spinwait(&clk_cli.notify);
+
+	err = onoff_request(clk_mgr, &clk_cli);
+	if (err < 0) {
+		return err;
+	}
+
+	do {
+		err = sys_notify_fetch_result(&clk_cli.notify, &res);
+		if (!err && res) {
+			return res;
+		}
+	} while (err);
+
+	return 0;
+}
+
+static void esb_setup(enum esb_mode mode)
+{
+	uint8_t base_addr_0[4] = {0xE7, 0xE7, 0xE7, 0xE7};
+	uint8_t base_addr_1[4] = {0xC2, 0xC2, 0xC2, 0xC2};
+	uint8_t addr_prefix[8] = {0xE7, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8};
+	struct esb_config config = ESB_DEFAULT_CONFIG;
+	int err;
+
+	err = clocks_start();
+	TEST_ASSERT(err == 0, "Clock start failed (err %d)", err);
+
+	config.mode = mode;
+	config.event_handler = event_handler;
+
+	err = esb_init(&config);
+	TEST_ASSERT(err == 0, "ESB initialization failed (err %d)", err);
+
+	err = esb_set_base_address_0(base_addr_0);
+	TEST_ASSERT(err == 0, "Setting base address 0 failed (err %d)", err);
+
+	err = esb_set_base_address_1(base_addr_1);
+	TEST_ASSERT(err == 0, "Setting base address 1 failed (err %d)", err);
+
+	err = esb_set_prefixes(addr_prefix, ARRAY_SIZE(addr_prefix));
+	TEST_ASSERT(err == 0, "Setting prefixes failed (err %d)", err);
+
+	err = esb_msg_init(&msg_callbacks);
+	TEST_ASSERT(err == 0, "Message transport initialization failed (err %d)", err);
+}
+
+static void test_ptx_main(void)
+{
+	struct esb_msg_stats stats;
+	uint32_t latency_min = UINT32_MAX;
+	uint32_t latency_max = 0;
+	uint64_t latency_sum = 0;
+	uint64_t total_us;
+	int64_t start_ms;
+	int err;
+
+	esb_setup(ESB_MODE_PTX);
+
+	k_sleep(K_MSEC(PTX_START_DELAY_MS));
+
+	start_ms = k_uptime_get();
+
+	for (uint32_t i = 0; i < msg_cnt; i++) {
+		uint32_t send_cycles;
+		uint32_t latency;
+
+		msg_fill(msg_buf, i);
+
+		send_cycles = k_cycle_get_32();
+
+		err = esb_msg_send(PIPE, msg_buf, msg_len);
+		TEST_ASSERT(err == 0, "Sending message %u failed (err %d)", i, err);
+
+		err = k_sem_take(&msg_sem, K_MSEC(MSG_TIMEOUT_MS));
+		TEST_ASSERT(err == 0, "Message %u not sent in time", i);
+		TEST_ASSERT(sent_err == 0, "Message %u not delivered (err %d)", i, sent_err);
+
+		latency = k_cyc_to_us_floor32(sent_cycles - send_cycles);
+		latency_min = MIN(latency_min, latency);
+		latency_max = MAX(latency_max, latency);
+		latency_sum += latency;
+	}
+
+	total_us = (uint64_t)(k_uptime_get() - start_ms) * USEC_PER_MSEC;
+
+	esb_msg_stats_get(&stats);
+	TEST_ASSERT(stats.tx_msgs == msg_cnt, "Invalid message count: %u", stats.tx_msgs);
+	TEST_ASSERT(stats.tx_failed == 0, "Messages failed: %u", stats.tx_failed);
+
+	LOG_INF("Sent %u messages of %u bytes in %u fragments, %u retransmissions",
+		msg_cnt, msg_len, stats.tx_frags, stats.tx_retransmits);
+	LOG_INF("Throughput: %u bytes/s",
+		(uint32_t)(((uint64_t)msg_cnt * msg_len * USEC_PER_SEC) / MAX(total_us, 1)));
+	LOG_INF("Latency [us]: min %u, avg %u, max %u", latency_min,
+		(uint32_t)(latency_sum / msg_cnt), latency_max);
+
+	TEST_PASS("PTX passed");
+}
+
+static void test_prx_main(void)
+{
+	struct esb_msg_stats stats;
+	int err;
+
+	esb_setup(ESB_MODE_PRX);
+
+	err = esb_start_rx();
+	TEST_ASSERT(err == 0, "Starting RX failed (err %d)", err);
+
+	/* Each message is sent within its timeout, or the PTX fails. */
+	err = k_sem_take(&msg_sem, K_MSEC(PTX_START_DELAY_MS + msg_cnt * MSG_TIMEOUT_MS));
+	TEST_ASSERT(err == 0, "Received %u of %u messages", rx_cnt, msg_cnt);
+	TEST_ASSERT(rx_err_cnt == 0, "Received %u invalid messages", rx_err_cnt);
+
+	esb_msg_stats_get(&stats);
+	TEST_ASSERT(stats.rx_invalid == 0, "Invalid payloads: %u", stats.rx_invalid);
+
+	LOG_INF("Received %u messages, %u fragments, %u dropped", stats.rx_msgs,
+		stats.rx_frags, stats.rx_dropped);
+
+	/* The PRX keeps receiving, so that the last fragment is acknowledged. */
+	TEST_PASS("PRX passed");
+}
+
+static void test_delete(void)
+{
+	if (bst_result == In_progress) {
+		TEST_FAIL("Test did not finish");
+	}
+}
+
+static const struct bst_test_instance test_vector[] = {
+	{
+		.test_id = "ptx",
+		.test_descr = "Send messages and measure the throughput and latency",
+		.test_args_f = test_args,
+		.test_main_f = test_ptx_main,
+		.test_delete_f = test_delete,
+	},
+	{
+		.test_id = "prx",
+		.test_descr = "Receive messages and check their content",
+		.test_args_f = test_args,
+		.test_main_f = test_prx_main,
+		.test_delete_f = test_delete,
+	},
+	BSTEST_END_MARKER,
+};
+
+struct bst_test_list *test_esb_msg_install(struct bst_test_list *tests)
+{
+	return bst_add_tests(tests, test_vector);
+}
+
+bst_test_install_t test_installers[] = {test_esb_msg_install, NULL};
+
+int main(void)
+{
+	bst_main();
+	return 0;
+}
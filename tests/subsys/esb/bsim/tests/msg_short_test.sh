@@ -0,0 +1,11 @@
+#!/usr/bin/env bash
+#
+# Copyright (c) 2025 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+SCRIPT_DIR=$(dirname "$(realpath "${BASH_SOURCE[0]}")")
+SCRIPT_NAME=$(basename "$0")
+
+${SCRIPT_DIR}/../_esb_msg_simulation.sh ${SCRIPT_NAME} msg_len 20 msg_cnt 200
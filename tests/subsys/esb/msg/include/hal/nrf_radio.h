@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RADIO_H__
+#define NRF_RADIO_H__
+
+/* Values used by esb.h */
+#define NRF_RADIO_MODE_NRF_1MBIT 0
+#define NRF_RADIO_MODE_NRF_2MBIT 1
+#define NRF_RADIO_MODE_BLE_1MBIT 3
+
+#define RADIO_CRCCNF_LEN_Disabled 0
+#define RADIO_CRCCNF_LEN_One 1
+#define RADIO_CRCCNF_LEN_Two 2
+
+#endif /* NRF_RADIO_H__ */
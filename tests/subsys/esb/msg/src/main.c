@@ -0,0 +1,475 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/byteorder.h>
+#include <string.h>
+#include <esb.h>
+#include <esb_msg.h>
+
+#define FRAG_DATA_LEN ESB_MSG_FRAG_DATA_LEN
+#define RX_FIFO_SIZE 4
+#define LOG_SIZE 32
+
+/* Stubs of the ESB module, which keep the TX and RX FIFOs in RAM */
+static struct esb_payload tx_fifo[CONFIG_ESB_TX_FIFO_SIZE];
+static uint32_t tx_count;
+static uint32_t tx_limit;
+static bool tx_reserved;
+static int flush_cnt;
+static uint32_t max_payload_len;
+
+static struct esb_payload rx_fifo[RX_FIFO_SIZE];
+static size_t rx_count;
+static size_t rx_pos;
+
+/* Fragments committed to the TX FIFO, in order */
+struct frag_info {
+	uint8_t pipe;
+	uint8_t msg_id;
+	uint16_t frag_idx;
+	uint16_t msg_len;
+};
+
+static struct frag_info tx_log[LOG_SIZE];
+static size_t tx_log_cnt;
+
+/* Messages reported by the message transport */
+static uint8_t rx_msg[CONFIG_ESB_MSG_MAX_SIZE];
+static size_t rx_msg_len;
+static uint8_t rx_msg_pipe;
+static int rx_msg_cnt;
+
+static int sent_err[CONFIG_ESB_PIPE_COUNT];
+static int sent_cnt[CONFIG_ESB_PIPE_COUNT];
+
+static uint8_t msg_data[CONFIG_ESB_MSG_MAX_SIZE];
+
+int esb_get_max_payload_length(uint32_t *length)
+{
+	*length = max_payload_len;
+	return 0;
+}
+
+int esb_tx_payload_reserve(struct esb_payload **payload)
+{
+	if (tx_reserved) {
+		return -EBUSY;
+	}
+
+	if (tx_count >= tx_limit) {
+		return -ENOMEM;
+	}
+
+	tx_reserved = true;
+	*payload = &tx_fifo[tx_count];
+	return 0;
+}
+
+int esb_tx_payload_commit(struct esb_payload *payload)
+{
+	zassert_true(tx_reserved, "Entry not reserved");
+	zassert_equal_ptr(payload, &tx_fifo[tx_count], "Invalid entry");
+	zassert_true(tx_log_cnt < LOG_SIZE, "Too many fragments");
+
+	tx_log[tx_log_cnt++] = (struct frag_info){
+		.pipe = payload->pipe,
+		.msg_id = payload->data[0],
+		.frag_idx = sys_get_le16(&payload->data[1]),
+		.msg_len = sys_get_le16(&payload->data[3]),
+	};
+
+	tx_reserved = false;
+	tx_count++;
+	return 0;
+}
+
+uint32_t esb_tx_fifo_count(void)
+{
+	return tx_count;
+}
+
+int esb_flush_tx(void)
+{
+	flush_cnt++;
+	tx_count = 0;
+	return 0;
+}
+
+bool esb_is_idle(void)
+{
+	return true;
+}
+
+int esb_start_tx(void)
+{
+	return 0;
+}
+
+int esb_rx_payload_get(const struct esb_payload **payload)
+{
+	if (rx_pos >= rx_count) {
+		return -ENODATA;
+	}
+
+	*payload = &rx_fifo[rx_pos];
+	return 0;
+}
+
+int esb_rx_payload_release(void)
+{
+	rx_pos++;
+	return 0;
+}
+
+static void sent(uint8_t pipe, int err)
+{
+	sent_cnt[pipe]++;
+	sent_err[pipe] = err;
+}
+
+static void received(uint8_t pipe, const uint8_t *data, size_t len)
+{
+	zassert_true(len <= sizeof(rx_msg), "Message too long");
+
+	memcpy(rx_msg, data, len);
+	rx_msg_len = len;
+	rx_msg_pipe = pipe;
+	rx_msg_cnt++;
+}
+
+static const struct esb_msg_cb callbacks = {
+	.sent = sent,
+	.received = received,
+};
+
+static void event_send(enum esb_evt_id evt_id)
+{
+	struct esb_evt event = {
+		.evt_id = evt_id,
+	};
+
+	esb_msg_event_handle(&event);
+}
+
+/* Acknowledge the oldest fragments, as ESB removes them from the TX FIFO */
+static void tx_ack(uint32_t cnt)
+{
+	zassert_true(cnt <= tx_count, "Not enough fragments queued");
+
+	memmove(tx_fifo, &tx_fifo[cnt], (tx_count - cnt) * sizeof(tx_fifo[0]));
+	tx_count -= cnt;
+
+	event_send(ESB_EVENT_TX_SUCCESS);
+}
+
+static void rx_put(const struct esb_payload *payload)
+{
+	zassert_true(rx_count < RX_FIFO_SIZE, "RX FIFO full");
+
+	rx_fifo[rx_count++] = *payload;
+}
+
+static void rx_deliver(void)
+{
+	event_send(ESB_EVENT_RX_RECEIVED);
+
+	zassert_equal(rx_pos, rx_count, "RX FIFO not emptied");
+	rx_count = 0;
+	rx_pos = 0;
+}
+
+static void frag_rx(uint8_t pipe, uint8_t msg_id, uint16_t frag_idx, uint16_t msg_len)
+{
+	struct esb_payload payload = {
+		.pipe = pipe,
+		.length = ESB_MSG_FRAG_HDR_LEN +
+			  MIN(msg_len - frag_idx * FRAG_DATA_LEN, FRAG_DATA_LEN),
+	};
+
+	payload.data[0] = msg_id;
+	sys_put_le16(frag_idx, &payload.data[1]);
+	sys_put_le16(msg_len, &payload.data[3]);
+	memcpy(&payload.data[ESB_MSG_FRAG_HDR_LEN], &msg_data[frag_idx * FRAG_DATA_LEN],
+	       payload.length - ESB_MSG_FRAG_HDR_LEN);
+
+	rx_put(&payload);
+	rx_deliver();
+}
+
+/* Pass the fragments to the receiving side one by one, acknowledging each of them */
+static void tx_loopback(void)
+{
+	while (tx_count > 0) {
+		rx_put(&tx_fifo[0]);
+		rx_deliver();
+		tx_ack(1);
+	}
+}
+
+static void msg_check(uint8_t pipe, size_t len)
+{
+	zassert_equal(rx_msg_cnt, 1, "Message not received");
+	zassert_equal(rx_msg_pipe, pipe, "Invalid pipe");
+	zassert_equal(rx_msg_len, len, "Invalid length");
+	zassert_mem_equal(rx_msg, msg_data, len, "Invalid data");
+}
+
+ZTEST(esb_msg, test_init_payload_length)
+{
+	int err;
+
+	/* Fragments do not fit in the static payload length */
+	max_payload_len = CONFIG_ESB_MAX_PAYLOAD_LENGTH - 1;
+
+	err = esb_msg_init(&callbacks);
+	zassert_equal(err, -EINVAL, "Unexpected result: %d", err);
+
+	max_payload_len = CONFIG_ESB_MAX_PAYLOAD_LENGTH;
+
+	err = esb_msg_init(&callbacks);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+}
+
+ZTEST(esb_msg, test_fragmentation)
+{
+	static const size_t lengths[] = {
+		1, FRAG_DATA_LEN, FRAG_DATA_LEN + 1, 2 * FRAG_DATA_LEN + 1,
+		CONFIG_ESB_MSG_MAX_SIZE,
+	};
+	int err;
+
+	for (size_t i = 0; i < ARRAY_SIZE(lengths); i++) {
+		size_t len = lengths[i];
+		size_t frag_cnt = DIV_ROUND_UP(len, FRAG_DATA_LEN);
+
+		tx_log_cnt = 0;
+		rx_msg_cnt = 0;
+
+		err = esb_msg_send(0, msg_data, len);
+		zassert_equal(err, 0, "Unexpected failure: %d", err);
+		zassert_equal(tx_count, MIN(frag_cnt, CONFIG_ESB_MSG_TX_WINDOW),
+			      "TX window not filled");
+
+		tx_loopback();
+
+		zassert_equal(tx_log_cnt, frag_cnt, "Invalid fragment count for %zu bytes", len);
+
+		for (size_t j = 0; j < frag_cnt; j++) {
+			zassert_equal(tx_log[j].frag_idx, j, "Invalid fragment index");
+			zassert_equal(tx_log[j].msg_len, len, "Invalid message length");
+			zassert_equal(tx_log[j].msg_id, i + 1, "Invalid message ID");
+		}
+
+		msg_check(0, len);
+		zassert_equal(sent_cnt[0], i + 1, "Message not reported as sent");
+		zassert_equal(sent_err[0], 0, "Unexpected error: %d", sent_err[0]);
+	}
+
+	err = esb_msg_send(0, msg_data, CONFIG_ESB_MSG_MAX_SIZE + 1);
+	zassert_equal(err, -EMSGSIZE, "Unexpected result: %d", err);
+}
+
+ZTEST(esb_msg, test_duplicate_drop)
+{
+	struct esb_msg_stats stats;
+	uint16_t len = 2 * FRAG_DATA_LEN + 1;
+
+	frag_rx(0, 1, 0, len);
+	frag_rx(0, 1, 1, len);
+	frag_rx(0, 1, 1, len);
+	zassert_equal(rx_msg_cnt, 0, "Message reported before completion");
+
+	frag_rx(0, 1, 2, len);
+	msg_check(0, len);
+
+	/* Fragment retransmitted after its acknowledgment was lost */
+	frag_rx(0, 1, 2, len);
+	zassert_equal(rx_msg_cnt, 1, "Message reported twice");
+
+	esb_msg_stats_get(&stats);
+	zassert_equal(stats.rx_frags, 5, "Invalid fragment count");
+	zassert_equal(stats.rx_msgs, 1, "Invalid message count");
+
+	/* A restarted sender starts again from the same message ID */
+	rx_msg_cnt = 0;
+	frag_rx(0, 1, 0, 1);
+	msg_check(0, 1);
+
+	/* Fragments of another message end the retransmissions of the completed one */
+	frag_rx(0, 2, 0, 1);
+	frag_rx(0, 1, 0, 1);
+	zassert_equal(rx_msg_cnt, 3, "Message of restarted sender dropped");
+
+	/* A restarted sender reuses the ID and length of the completed message */
+	frag_rx(0, 1, 0, 1);
+	zassert_equal(rx_msg_cnt, 3, "Duplicate reported");
+
+	k_sleep(K_MSEC(CONFIG_ESB_MSG_RX_TIMEOUT_MS));
+
+	frag_rx(0, 1, 0, 1);
+	zassert_equal(rx_msg_cnt, 4, "Message dropped after the timeout");
+}
+
+ZTEST(esb_msg, test_rx_timeout)
+{
+	struct esb_msg_stats stats;
+	uint16_t len = 3 * FRAG_DATA_LEN;
+
+	frag_rx(0, 1, 0, len);
+
+	/* The sender stopped sending the message */
+	k_sleep(K_MSEC(CONFIG_ESB_MSG_RX_TIMEOUT_MS));
+
+	frag_rx(0, 1, 1, len);
+	frag_rx(0, 1, 2, len);
+	zassert_equal(rx_msg_cnt, 0, "Expired message completed");
+
+	esb_msg_stats_get(&stats);
+	zassert_equal(stats.rx_dropped, 1, "Message not dropped");
+
+	frag_rx(0, 1, 0, len);
+	msg_check(0, len);
+}
+
+ZTEST(esb_msg, test_slot_eviction)
+{
+	struct esb_msg_stats stats;
+	uint16_t len = 3 * FRAG_DATA_LEN;
+
+	frag_rx(0, 1, 0, len);
+	frag_rx(1, 1, 0, len);
+	frag_rx(0, 1, 1, len);
+
+	/* No free slot, the message on pipe 1 was not updated for the longest time */
+	frag_rx(2, 1, 0, len);
+
+	esb_msg_stats_get(&stats);
+	zassert_equal(stats.rx_dropped, 1, "Message not dropped");
+
+	frag_rx(0, 1, 2, len);
+	msg_check(0, len);
+
+	rx_msg_cnt = 0;
+	frag_rx(1, 1, 1, len);
+	frag_rx(1, 1, 2, len);
+	zassert_equal(rx_msg_cnt, 0, "Dropped message completed");
+}
+
+ZTEST(esb_msg, test_give_up)
+{
+	struct esb_msg_stats stats;
+	uint16_t len = 2 * FRAG_DATA_LEN + 1;
+	int err;
+
+	err = esb_msg_send(0, msg_data, len);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	err = esb_msg_send(1, msg_data, len);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	/* The first fragment on pipe 0 is acknowledged, the next one fails */
+	tx_ack(1);
+	zassert_equal(tx_count, CONFIG_ESB_MSG_TX_WINDOW, "TX window not filled");
+
+	for (int i = 0; i < CONFIG_ESB_MSG_TX_RETRY_COUNT; i++) {
+		event_send(ESB_EVENT_TX_FAILED);
+		zassert_equal(sent_cnt[0], 0, "Message given up too early");
+	}
+
+	tx_log_cnt = 0;
+	event_send(ESB_EVENT_TX_FAILED);
+
+	zassert_equal(sent_cnt[0], 1, "Message not given up");
+	zassert_equal(sent_err[0], -EIO, "Unexpected error: %d", sent_err[0]);
+	zassert_equal(flush_cnt, 1, "TX FIFO not flushed");
+
+	/* The message on pipe 1 is sent again from its first unacknowledged fragment */
+	zassert_equal(tx_count, 3, "Invalid number of queued fragments");
+
+	for (size_t i = 0; i < tx_log_cnt; i++) {
+		zassert_equal(tx_log[i].pipe, 1, "Fragment of given up message queued");
+		zassert_equal(tx_log[i].frag_idx, i, "Invalid fragment index");
+	}
+
+	tx_ack(3);
+	zassert_equal(sent_cnt[1], 1, "Message not sent");
+	zassert_equal(sent_err[1], 0, "Unexpected error: %d", sent_err[1]);
+
+	esb_msg_stats_get(&stats);
+	zassert_equal(stats.tx_failed, 1, "Invalid failed message count");
+	zassert_equal(stats.tx_msgs, 1, "Invalid message count");
+	zassert_equal(stats.tx_retransmits, CONFIG_ESB_MSG_TX_RETRY_COUNT + 1,
+		      "Invalid retransmission count");
+}
+
+ZTEST(esb_msg, test_round_robin)
+{
+	uint16_t len = 2 * FRAG_DATA_LEN + 1;
+	int err;
+
+	/* The TX FIFO is busy, the messages wait for free entries */
+	tx_limit = 0;
+
+	for (uint8_t pipe = 0; pipe < CONFIG_ESB_PIPE_COUNT; pipe++) {
+		err = esb_msg_send(pipe, msg_data, len);
+		zassert_equal(err, 0, "Unexpected failure: %d", err);
+	}
+
+	err = esb_msg_send(0, msg_data, len);
+	zassert_equal(err, -EBUSY, "Unexpected result: %d", err);
+
+	tx_limit = CONFIG_ESB_TX_FIFO_SIZE;
+
+	while (tx_log_cnt < 3 * CONFIG_ESB_PIPE_COUNT) {
+		tx_ack(tx_count);
+	}
+
+	tx_ack(tx_count);
+
+	/* Each pipe gets one fragment in turn */
+	for (size_t i = 0; i < tx_log_cnt; i++) {
+		zassert_equal(tx_log[i].pipe, i % CONFIG_ESB_PIPE_COUNT, "Pipe %u out of turn",
+			      tx_log[i].pipe);
+		zassert_equal(tx_log[i].frag_idx, i / CONFIG_ESB_PIPE_COUNT,
+			      "Invalid fragment index");
+	}
+
+	for (uint8_t pipe = 0; pipe < CONFIG_ESB_PIPE_COUNT; pipe++) {
+		zassert_equal(sent_cnt[pipe], 1, "Message on pipe %u not sent", pipe);
+		zassert_equal(sent_err[pipe], 0, "Unexpected error: %d", sent_err[pipe]);
+	}
+}
+
+static void *setup(void)
+{
+	for (size_t i = 0; i < sizeof(msg_data); i++) {
+		msg_data[i] = (uint8_t)i;
+	}
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	max_payload_len = CONFIG_ESB_MAX_PAYLOAD_LENGTH;
+	zassert_equal(esb_msg_init(&callbacks), 0, "Message transport not initialized");
+
+	tx_count = 0;
+	tx_limit = CONFIG_ESB_TX_FIFO_SIZE;
+	tx_reserved = false;
+	flush_cnt = 0;
+	rx_count = 0;
+	rx_pos = 0;
+	tx_log_cnt = 0;
+	rx_msg_len = 0;
+	rx_msg_cnt = 0;
+	memset(sent_cnt, 0, sizeof(sent_cnt));
+	memset(sent_err, 0, sizeof(sent_err));
+}
+
+ZTEST_SUITE(esb_msg, NULL, setup, before, NULL, NULL);
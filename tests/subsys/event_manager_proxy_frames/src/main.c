@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <app_event_manager.h>
+#include <event_manager_proxy.h>
+
+#include "event_manager_proxy_protocol.h"
+#include "test_backend.h"
+
+#define MODULE test_frames
+
+/* Event type identifier used by the remote, never dereferenced. */
+#define REMOTE_TEST_EVENT_ID ((const struct event_type *)0x1000)
+
+#define RX_EVENT_MAX 8
+#define PROCESS_TIMEOUT K_MSEC(50)
+
+/* Event forwarded to the remotes. */
+struct test_event {
+	struct app_event_header header;
+
+	uint32_t seq;
+};
+APP_EVENT_TYPE_DECLARE(test_event);
+APP_EVENT_TYPE_DEFINE(test_event, NULL, NULL, APP_EVENT_FLAGS_CREATE());
+
+/* Event received from the remotes. */
+struct rx_event {
+	struct app_event_header header;
+
+	uint32_t seq;
+};
+APP_EVENT_TYPE_DECLARE(rx_event);
+APP_EVENT_TYPE_DEFINE(rx_event, NULL, NULL, APP_EVENT_FLAGS_CREATE());
+
+static const struct device *const remotes[] = {
+	TEST_IPC_NOCOPY,
+	TEST_IPC_COPY,
+};
+
+static uint32_t rx_seq[RX_EVENT_MAX];
+static size_t rx_cnt;
+
+static size_t test_rec_size(void)
+{
+	return emp_frame_record_size(sizeof(struct test_event));
+}
+
+static size_t events_per_frame(const struct device *remote)
+{
+	size_t frame_size = CONFIG_EVENT_MANAGER_PROXY_FRAME_SIZE;
+
+	if (remote == TEST_IPC_NOCOPY) {
+		frame_size = MIN(frame_size, TEST_BACKEND_BUF_SIZE);
+	}
+
+	return frame_size / test_rec_size();
+}
+
+static void submit_test_events(uint32_t first_seq, size_t cnt)
+{
+	/* Submit all events before the Application Event Manager processes them. */
+	k_sched_lock();
+
+	for (size_t i = 0; i < cnt; i++) {
+		struct test_event *event = new_test_event();
+
+		event->seq = first_seq + i;
+		APP_EVENT_SUBMIT(event);
+	}
+
+	k_sched_unlock();
+
+	k_sleep(PROCESS_TIMEOUT);
+}
+
+/* Verify frames sent to the remote and return the number of events in them. */
+static size_t check_frames(const struct device *remote, uint32_t first_seq)
+{
+	uint32_t seq = first_seq;
+
+	for (size_t i = 0; i < test_backend_msg_count(remote); i++) {
+		const struct test_backend_msg *msg = test_backend_msg_get(remote, i);
+		size_t off = 0;
+
+		zassert_true(msg->len > 0, "Empty frame");
+
+		while (off < msg->len) {
+			struct emp_frame_record rec;
+			struct test_event event;
+
+			zassert_true(off + sizeof(rec) <= msg->len, "Truncated frame");
+			memcpy(&rec, &msg->data[off], sizeof(rec));
+			zassert_equal(rec.len, sizeof(event), "Invalid event size: %u", rec.len);
+			zassert_true(off + emp_frame_record_size(rec.len) <= msg->len,
+				     "Truncated frame");
+
+			memcpy(&event, &msg->data[off + sizeof(rec)], sizeof(event));
+			zassert_equal_ptr(event.header.type_id, REMOTE_TEST_EVENT_ID,
+					  "Event ID not replaced");
+			zassert_equal(event.seq, seq, "Event %u instead of %u", event.seq, seq);
+
+			off += emp_frame_record_size(rec.len);
+			seq++;
+		}
+	}
+
+	return seq - first_seq;
+}
+
+static size_t frame_put_rx_event(uint8_t *frame, size_t off, uint32_t seq)
+{
+	struct emp_frame_record rec = {
+		.len = sizeof(struct rx_event),
+	};
+	struct rx_event event = {
+		.header.type_id = APP_EVENT_ID(rx_event),
+		.seq = seq,
+	};
+
+	memcpy(&frame[off], &rec, sizeof(rec));
+	memcpy(&frame[off + sizeof(rec)], &event, sizeof(event));
+
+	return off + emp_frame_record_size(rec.len);
+}
+
+ZTEST(event_manager_proxy_frames, test_batching)
+{
+	const size_t cnt = 3;
+
+	submit_test_events(0, cnt);
+
+	for (size_t i = 0; i < ARRAY_SIZE(remotes); i++) {
+		struct event_manager_proxy_stats stats;
+
+		/* All events processed at once are sent in a single frame. */
+		zassert_equal(test_backend_msg_count(remotes[i]), 1, "Remote %zu", i);
+		zassert_equal(check_frames(remotes[i], 0), cnt);
+
+		zassert_ok(event_manager_proxy_stats_get(remotes[i], &stats));
+		zassert_equal(stats.tx_frames, 1);
+		zassert_equal(stats.tx_events, cnt);
+		zassert_equal(stats.tx_bytes, cnt * test_rec_size());
+		zassert_equal(stats.tx_dropped, 0);
+	}
+}
+
+ZTEST(event_manager_proxy_frames, test_full_frames)
+{
+	const size_t cnt = 3 * events_per_frame(TEST_IPC_COPY) + 1;
+
+	submit_test_events(100, cnt);
+
+	for (size_t i = 0; i < ARRAY_SIZE(remotes); i++) {
+		size_t per_frame = events_per_frame(remotes[i]);
+
+		zassert_equal(test_backend_msg_count(remotes[i]), DIV_ROUND_UP(cnt, per_frame),
+			      "Remote %zu", i);
+		zassert_equal(check_frames(remotes[i], 100), cnt);
+
+		/* All frames but the last one are full. */
+		for (size_t j = 0; j < test_backend_msg_count(remotes[i]) - 1; j++) {
+			zassert_equal(test_backend_msg_get(remotes[i], j)->len,
+				      per_frame * test_rec_size());
+		}
+	}
+}
+
+ZTEST(event_manager_proxy_frames, test_pending)
+{
+	const size_t pending_cnt = CONFIG_EVENT_MANAGER_PROXY_PENDING_SIZE / test_rec_size();
+	const size_t drop_cnt = 2;
+	struct event_manager_proxy_stats stats;
+
+	/* The remote does not release transmission buffers. */
+	test_backend_tx_buffers_set(TEST_IPC_NOCOPY, 0);
+
+	submit_test_events(200, pending_cnt + drop_cnt);
+
+	zassert_equal(test_backend_msg_count(TEST_IPC_NOCOPY), 0);
+	zassert_ok(event_manager_proxy_stats_get(TEST_IPC_NOCOPY, &stats));
+	zassert_equal(stats.tx_events, 0);
+	zassert_equal(stats.tx_dropped, drop_cnt);
+
+	/* Other remotes are not affected. */
+	zassert_equal(check_frames(TEST_IPC_COPY, 200), pending_cnt + drop_cnt);
+
+	/* Pending events are sent in order once buffers are available. */
+	test_backend_tx_buffers_set(TEST_IPC_NOCOPY, SIZE_MAX);
+	k_sleep(PROCESS_TIMEOUT);
+
+	zassert_equal(check_frames(TEST_IPC_NOCOPY, 200), pending_cnt);
+	zassert_ok(event_manager_proxy_stats_get(TEST_IPC_NOCOPY, &stats));
+	zassert_equal(stats.tx_events, pending_cnt);
+	zassert_equal(stats.tx_dropped, drop_cnt);
+
+	/* New events follow the pending ones. */
+	test_backend_reset(TEST_IPC_NOCOPY);
+	submit_test_events(300, 1);
+	zassert_equal(check_frames(TEST_IPC_NOCOPY, 300), 1);
+}
+
+ZTEST(event_manager_proxy_frames, test_receive)
+{
+	uint32_t frame[CONFIG_EVENT_MANAGER_PROXY_FRAME_SIZE / sizeof(uint32_t)];
+	struct event_manager_proxy_stats stats;
+	size_t len = 0;
+
+	for (uint32_t seq = 0; seq < 3; seq++) {
+		len = frame_put_rx_event((uint8_t *)frame, len, seq);
+	}
+
+	test_backend_receive(TEST_IPC_NOCOPY, frame, len);
+	k_sleep(PROCESS_TIMEOUT);
+
+	zassert_equal(rx_cnt, 3);
+	for (size_t i = 0; i < rx_cnt; i++) {
+		zassert_equal(rx_seq[i], i);
+	}
+
+	zassert_ok(event_manager_proxy_stats_get(TEST_IPC_NOCOPY, &stats));
+	zassert_equal(stats.rx_frames, 1);
+	zassert_equal(stats.rx_events, 3);
+
+	/* Received events are not subscribed by the remote, nothing is sent back. */
+	zassert_equal(test_backend_msg_count(TEST_IPC_NOCOPY), 0);
+}
+
+ZTEST(event_manager_proxy_frames, test_receive_malformed)
+{
+	uint32_t frame[CONFIG_EVENT_MANAGER_PROXY_FRAME_SIZE / sizeof(uint32_t)];
+	struct event_manager_proxy_stats stats;
+	size_t len;
+
+	len = frame_put_rx_event((uint8_t *)frame, 0, 0);
+	len = frame_put_rx_event((uint8_t *)frame, len, 1);
+
+	/* The second event is truncated. */
+	test_backend_receive(TEST_IPC_COPY, frame, len - sizeof(uint32_t));
+	k_sleep(PROCESS_TIMEOUT);
+
+	zassert_equal(rx_cnt, 1);
+	zassert_equal(rx_seq[0], 0);
+
+	zassert_ok(event_manager_proxy_stats_get(TEST_IPC_COPY, &stats));
+	zassert_equal(stats.rx_frames, 1);
+	zassert_equal(stats.rx_events, 1);
+}
+
+ZTEST(event_manager_proxy_frames, test_stats_unknown_remote)
+{
+	struct event_manager_proxy_stats stats;
+
+	zassert_equal(event_manager_proxy_stats_get(NULL, &stats), -ENOENT);
+	zassert_equal(event_manager_proxy_stats_reset(NULL), -ENOENT);
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_rx_event(aeh)) {
+		const struct rx_event *event = cast_rx_event(aeh);
+
+		if (rx_cnt < ARRAY_SIZE(rx_seq)) {
+			rx_seq[rx_cnt++] = event->seq;
+		}
+
+		return false;
+	}
+
+	/* Event unhandled */
+	__ASSERT_NO_MSG(false);
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, rx_event);
+
+static void remote_subscribe(const struct device *remote, const char *name,
+			     const struct event_type *id)
+{
+	uint32_t buf[DIV_ROUND_UP(sizeof(struct emp_cmd_subscribe) + 32, sizeof(uint32_t))];
+	struct emp_cmd_subscribe *cmd = (struct emp_cmd_subscribe *)buf;
+
+	__ASSERT_NO_MSG(strlen(name) < 32);
+
+	cmd->code = EMP_CMD_SUBSCRIBE;
+	cmd->id = id;
+	strcpy(cmd->name, name);
+
+	test_backend_receive(remote, buf, sizeof(buf));
+}
+
+static void remote_start(const struct device *remote)
+{
+	const struct emp_cmd cmd = {.code = EMP_CMD_START};
+
+	test_backend_receive(remote, &cmd, sizeof(cmd));
+}
+
+static void *setup(void)
+{
+	zassert_ok(app_event_manager_init());
+
+	for (size_t i = 0; i < ARRAY_SIZE(remotes); i++) {
+		zassert_ok(event_manager_proxy_add_remote(remotes[i]));
+		zassert_ok(EVENT_MANAGER_PROXY_SUBSCRIBE(remotes[i], rx_event));
+
+		remote_subscribe(remotes[i], "test_event", REMOTE_TEST_EVENT_ID);
+		remote_start(remotes[i]);
+	}
+
+	zassert_ok(event_manager_proxy_start());
+	zassert_ok(event_manager_proxy_wait_for_remotes(K_NO_WAIT));
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (size_t i = 0; i < ARRAY_SIZE(remotes); i++) {
+		test_backend_reset(remotes[i]);
+		zassert_ok(event_manager_proxy_stats_reset(remotes[i]));
+	}
+
+	rx_cnt = 0;
+}
+
+ZTEST_SUITE(event_manager_proxy_frames, NULL, setup, before, NULL, NULL);
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ipc/ipc_service_backend.h>
+#include <zephyr/ztest.h>
+
+#include "test_backend.h"
+
+struct test_backend_data {
+	const struct ipc_ept_cfg *cfg;
+	size_t tx_free;
+	uint32_t tx_buf[TEST_BACKEND_BUF_SIZE / sizeof(uint32_t)];
+	size_t msg_cnt;
+	struct test_backend_msg msgs[TEST_BACKEND_MSG_CNT];
+};
+
+static struct test_backend_data nocopy_data;
+static struct test_backend_data copy_data;
+
+static int backend_register_endpoint(const struct device *instance,
+				     const struct ipc_ept_cfg *cfg, void **token)
+{
+	struct test_backend_data *data = instance->data;
+
+	data->cfg = cfg;
+	*token = data;
+
+	cfg->cb.bound(cfg->priv);
+
+	return 0;
+}
+
+static int backend_send(const struct device *instance, void *token, const void *msg,
+			size_t len)
+{
+	struct test_backend_data *data = token;
+	struct test_backend_msg *dst;
+
+	zassert_true(len <= sizeof(dst->data), "Message too long: %zu", len);
+	zassert_true(data->msg_cnt < ARRAY_SIZE(data->msgs), "Too many messages");
+
+	dst = &data->msgs[data->msg_cnt++];
+	memcpy(dst->data, msg, len);
+	dst->len = len;
+
+	return len;
+}
+
+static int backend_get_tx_buffer(const struct device *instance, void *token, void **buf,
+				 uint32_t *len, k_timeout_t wait)
+{
+	struct test_backend_data *data = token;
+
+	zassert_true(K_TIMEOUT_EQ(wait, K_NO_WAIT), "Proxy must not wait for buffers");
+
+	if (*len > sizeof(data->tx_buf)) {
+		*len = sizeof(data->tx_buf);
+		return -ENOMEM;
+	}
+
+	if (data->tx_free == 0) {
+		return -ENOBUFS;
+	}
+
+	data->tx_free--;
+	*buf = data->tx_buf;
+	*len = sizeof(data->tx_buf);
+
+	return 0;
+}
+
+static int backend_drop_tx_buffer(const struct device *instance, void *token,
+				  const void *buf)
+{
+	struct test_backend_data *data = token;
+
+	zassert_equal_ptr(buf, data->tx_buf);
+	data->tx_free++;
+
+	return 0;
+}
+
+static int backend_send_nocopy(const struct device *instance, void *token, const void *msg,
+			       size_t len)
+{
+	struct test_backend_data *data = token;
+
+	zassert_equal_ptr(msg, data->tx_buf, "Not a transmission buffer");
+	zassert_true(len <= sizeof(data->tx_buf), "Message too long: %zu", len);
+
+	return backend_send(instance, token, msg, len);
+}
+
+static const struct ipc_service_backend nocopy_backend = {
+	.send = backend_send,
+	.register_endpoint = backend_register_endpoint,
+	.get_tx_buffer = backend_get_tx_buffer,
+	.drop_tx_buffer = backend_drop_tx_buffer,
+	.send_nocopy = backend_send_nocopy,
+};
+
+static const struct ipc_service_backend copy_backend = {
+	.send = backend_send,
+	.register_endpoint = backend_register_endpoint,
+};
+
+DEVICE_DEFINE(test_ipc_nocopy, "test_ipc_nocopy", NULL, NULL, &nocopy_data, NULL,
+	      POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &nocopy_backend);
+
+DEVICE_DEFINE(test_ipc_copy, "test_ipc_copy", NULL, NULL, &copy_data, NULL,
+	      POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &copy_backend);
+
+void test_backend_reset(const struct device *instance)
+{
+	struct test_backend_data *data = instance->data;
+
+	data->msg_cnt = 0;
+	data->tx_free = SIZE_MAX;
+}
+
+void test_backend_tx_buffers_set(const struct device *instance, size_t cnt)
+{
+	struct test_backend_data *data = instance->data;
+
+	data->tx_free = cnt;
+}
+
+size_t test_backend_msg_count(const struct device *instance)
+{
+	struct test_backend_data *data = instance->data;
+
+	return data->msg_cnt;
+}
+
+const struct test_backend_msg *test_backend_msg_get(const struct device *instance, size_t idx)
+{
+	struct test_backend_data *data = instance->data;
+
+	zassert_true(idx < data->msg_cnt);
+
+	return &data->msgs[idx];
+}
+
+void test_backend_receive(const struct device *instance, const void *msg, size_t len)
+{
+	struct test_backend_data *data = instance->data;
+
+	zassert_not_null(data->cfg, "Endpoint not registered");
+	data->cfg->cb.received(msg, len, data->cfg->priv);
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _TEST_BACKEND_H_
+#define _TEST_BACKEND_H_
+
+#include <zephyr/device.h>
+
+/* Size of the transmission buffer of the no-copy backend, smaller than the proxy frame. */
+#define TEST_BACKEND_BUF_SIZE 192
+
+/* Maximum number of captured messages. */
+#define TEST_BACKEND_MSG_CNT 32
+
+DEVICE_DECLARE(test_ipc_nocopy);
+DEVICE_DECLARE(test_ipc_copy);
+
+/* Backend supporting no-copy sending. */
+#define TEST_IPC_NOCOPY DEVICE_GET(test_ipc_nocopy)
+/* Backend supporting only sending with copy, like ICMsg. */
+#define TEST_IPC_COPY DEVICE_GET(test_ipc_copy)
+
+/** @brief Message sent through the backend. */
+struct test_backend_msg {
+	uint8_t data[CONFIG_EVENT_MANAGER_PROXY_FRAME_SIZE];
+	size_t len;
+};
+
+/**
+ * @brief Drop captured messages and make transmission buffers available.
+ *
+ * @param instance Backend instance.
+ */
+void test_backend_reset(const struct device *instance);
+
+/**
+ * @brief Set the number of transmission buffers that can be allocated.
+ *
+ * @param instance Backend instance.
+ * @param cnt      Number of buffers.
+ */
+void test_backend_tx_buffers_set(const struct device *instance, size_t cnt);
+
+/**
+ * @brief Get the number of captured messages.
+ *
+ * @param instance Backend instance.
+ *
+ * @return Number of messages.
+ */
+size_t test_backend_msg_count(const struct device *instance);
+
+/**
+ * @brief Get a captured message.
+ *
+ * @param instance Backend instance.
+ * @param idx      Index of the message.
+ *
+ * @return The message.
+ */
+const struct test_backend_msg *test_backend_msg_get(const struct device *instance, size_t idx);
+
+/**
+ * @brief Pass data to the endpoint as if it was sent by the remote.
+ *
+ * @param instance Backend instance.
+ * @param data     Data.
+ * @param len      Length of the data.
+ */
+void test_backend_receive(const struct device *instance, const void *data, size_t len);
+
+#endif /* _TEST_BACKEND_H_ */
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/device.h>
+#include <zephyr/net/ieee802154_radio.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <openthread/ip6.h>
+#include <openthread/message.h>
+#include <openthread/platform/diag.h>
+#include <openthread/platform/radio.h>
+#include <openthread-system.h>
+
+#include "platform-zephyr.h"
+
+#define TEST_CHANNEL 15
+#define RX_BATCH_LEN 8
+#define RX_FRAME_LEN 20
+#define TX_FRAME_LEN 30
+#define SRC_MATCH_SIZE 4
+
+/* Frames reported to OpenThread */
+struct rx_report {
+	const uint8_t *psdu;
+	uint16_t length;
+	uint8_t channel;
+	bool frame_pending;
+};
+
+static struct rx_report rx_reports[RX_BATCH_LEN];
+static size_t rx_report_cnt;
+static int tx_done_cnt;
+static otError tx_done_error;
+
+/* State of the fake radio driver */
+static size_t radio_tx_len;
+static uint16_t src_match_short[SRC_MATCH_SIZE];
+static size_t src_match_cnt;
+
+static K_SEM_DEFINE(event_sem, 0, 1);
+
+void otSysEventSignalPending(void)
+{
+	k_sem_give(&event_sem);
+}
+
+void otPlatRadioReceiveDone(otInstance *aInstance, otRadioFrame *aFrame, otError aError)
+{
+	zassert_equal(aError, OT_ERROR_NONE, "Unexpected error: %d", aError);
+	zassert_true(rx_report_cnt < RX_BATCH_LEN, "Too many frames reported");
+
+	rx_reports[rx_report_cnt++] = (struct rx_report){
+		.psdu = aFrame->mPsdu,
+		.length = aFrame->mLength,
+		.channel = aFrame->mChannel,
+		.frame_pending = aFrame->mInfo.mRxInfo.mAckedWithFramePending,
+	};
+}
+
+void otPlatRadioTxDone(otInstance *aInstance, otRadioFrame *aFrame, otRadioFrame *aAckFrame,
+		       otError aError)
+{
+	tx_done_cnt++;
+	tx_done_error = aError;
+}
+
+void otPlatRadioTxStarted(otInstance *aInstance, otRadioFrame *aFrame)
+{
+}
+
+void otPlatRadioEnergyScanDone(otInstance *aInstance, int8_t aEnergyScanMaxRssi)
+{
+}
+
+bool otPlatDiagModeGet(void)
+{
+	return false;
+}
+
+void otPlatDiagRadioReceiveDone(otInstance *aInstance, otRadioFrame *aFrame, otError aError)
+{
+}
+
+void otPlatDiagRadioTransmitDone(otInstance *aInstance, otRadioFrame *aFrame, otError aError)
+{
+}
+
+otMessage *otIp6NewMessage(otInstance *aInstance, const otMessageSettings *aSettings)
+{
+	return NULL;
+}
+
+otError otIp6Send(otInstance *aInstance, otMessage *aMessage)
+{
+	return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+otError otMessageAppend(otMessage *aMessage, const void *aBuf, uint16_t aLength)
+{
+	return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+void otMessageFree(otMessage *aMessage)
+{
+}
+
+void otMessageSetMulticastLoopEnabled(otMessage *aMessage, bool aEnabled)
+{
+}
+
+static enum ieee802154_hw_caps fake_radio_get_capabilities(const struct device *dev)
+{
+	return IEEE802154_HW_TX_RX_ACK;
+}
+
+static int fake_radio_cca(const struct device *dev)
+{
+	return 0;
+}
+
+static int fake_radio_set_channel(const struct device *dev, uint16_t channel)
+{
+	return 0;
+}
+
+static int fake_radio_set_txpower(const struct device *dev, int16_t dbm)
+{
+	return 0;
+}
+
+static int fake_radio_tx(const struct device *dev, enum ieee802154_tx_mode mode,
+			 struct net_pkt *pkt, struct net_buf *frag)
+{
+	radio_tx_len = frag->len;
+
+	return 0;
+}
+
+static int fake_radio_start(const struct device *dev)
+{
+	return 0;
+}
+
+static int fake_radio_stop(const struct device *dev)
+{
+	return 0;
+}
+
+static void src_match_update(const struct ieee802154_config *config)
+{
+	uint16_t addr;
+
+	if (config->ack_fpb.extended) {
+		return;
+	}
+
+	if (config->ack_fpb.addr == NULL) {
+		src_match_cnt = 0;
+		return;
+	}
+
+	addr = sys_get_le16(config->ack_fpb.addr);
+
+	for (size_t i = 0; i < src_match_cnt; i++) {
+		if (src_match_short[i] == addr) {
+			if (!config->ack_fpb.enabled) {
+				src_match_short[i] = src_match_short[--src_match_cnt];
+			}
+			return;
+		}
+	}
+
+	if (config->ack_fpb.enabled && src_match_cnt < SRC_MATCH_SIZE) {
+		src_match_short[src_match_cnt++] = addr;
+	}
+}
+
+static int fake_radio_configure(const struct device *dev, enum ieee802154_config_type type,
+				const struct ieee802154_config *config)
+{
+	if (type == IEEE802154_CONFIG_ACK_FPB) {
+		src_match_update(config);
+	}
+
+	return 0;
+}
+
+static const struct ieee802154_radio_api fake_radio_api = {
+	.get_capabilities = fake_radio_get_capabilities,
+	.cca = fake_radio_cca,
+	.set_channel = fake_radio_set_channel,
+	.set_txpower = fake_radio_set_txpower,
+	.tx = fake_radio_tx,
+	.start = fake_radio_start,
+	.stop = fake_radio_stop,
+	.configure = fake_radio_configure,
+};
+
+DEVICE_DT_DEFINE(DT_CHOSEN(zephyr_ieee802154), NULL, NULL, NULL, NULL, POST_KERNEL,
+		 CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &fake_radio_api);
+
+/* Queues a frame as the radio driver does, returns the location of its PSDU */
+static const uint8_t *rx_frame_queue(uint8_t seq, bool frame_pending)
+{
+	struct net_pkt *pkt;
+	struct net_buf *buf;
+	uint8_t psdu[RX_FRAME_LEN] = {0x41, 0xd8, seq};
+
+	pkt = net_pkt_rx_alloc(K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate packet");
+
+	buf = net_pkt_get_reserve_rx_data(sizeof(psdu), K_NO_WAIT);
+	zassert_not_null(buf, "Cannot allocate buffer");
+
+	net_pkt_append_buffer(pkt, buf);
+	net_buf_add_mem(buf, psdu, sizeof(psdu));
+	net_pkt_set_ieee802154_ack_fpb(pkt, frame_pending);
+
+	zassert_equal(notify_new_rx_frame(pkt), 0, "Frame not queued");
+
+	return buf->data;
+}
+
+ZTEST(ot_radio, test_rx_batch)
+{
+	const uint8_t *psdu[RX_BATCH_LEN];
+	struct platform_radio_stats stats;
+
+	for (size_t i = 0; i < RX_BATCH_LEN; i++) {
+		psdu[i] = rx_frame_queue(i, i % 2);
+	}
+
+	platformRadioProcess(NULL);
+
+	zassert_equal(rx_report_cnt, RX_BATCH_LEN, "Frames not passed in one wake-up");
+
+	for (size_t i = 0; i < RX_BATCH_LEN; i++) {
+		zassert_equal_ptr(rx_reports[i].psdu, psdu[i], "Frame %zu copied", i);
+		zassert_equal(rx_reports[i].length, RX_FRAME_LEN, "Invalid length");
+		zassert_equal(rx_reports[i].channel, TEST_CHANNEL, "Invalid channel");
+		zassert_equal(rx_reports[i].frame_pending, i % 2, "Invalid frame pending bit");
+	}
+
+	platformRadioStatsGet(&stats);
+	zassert_equal(stats.rx_frames, RX_BATCH_LEN, "Invalid frame count");
+	zassert_equal(stats.rx_batches, 1, "Invalid batch count");
+	zassert_equal(stats.rx_batch_max, RX_BATCH_LEN, "Invalid largest batch");
+
+	/* Nothing left for the next wake-up */
+	platformRadioProcess(NULL);
+	zassert_equal(rx_report_cnt, RX_BATCH_LEN, "Frame reported twice");
+
+	platformRadioStatsGet(&stats);
+	zassert_equal(stats.rx_batches, 1, "Empty batch counted");
+}
+
+ZTEST(ot_radio, test_tx)
+{
+	otRadioFrame *frame = otPlatRadioGetTransmitBuffer(NULL);
+	struct platform_radio_stats stats;
+	otError err;
+
+	memset(frame->mPsdu, 0xaa, TX_FRAME_LEN);
+	frame->mLength = TX_FRAME_LEN;
+	frame->mChannel = TEST_CHANNEL;
+	frame->mInfo.mTxInfo.mCsmaCaEnabled = false;
+
+	err = otPlatRadioTransmit(NULL, frame);
+	zassert_equal(err, OT_ERROR_NONE, "Unexpected failure: %d", err);
+	zassert_equal(otPlatRadioGetState(NULL), OT_RADIO_STATE_TRANSMIT, "Not transmitting");
+
+	/* The frame is passed to the radio from the radio work queue */
+	zassert_ok(k_sem_take(&event_sem, K_SECONDS(1)), "Transmission not completed");
+	zassert_equal(radio_tx_len, TX_FRAME_LEN - 2, "FCS not excluded");
+
+	platformRadioProcess(NULL);
+
+	zassert_equal(tx_done_cnt, 1, "Transmission not reported");
+	zassert_equal(tx_done_error, OT_ERROR_NONE, "Unexpected error: %d", tx_done_error);
+	zassert_equal(otPlatRadioGetState(NULL), OT_RADIO_STATE_RECEIVE, "Not receiving");
+
+	platformRadioStatsGet(&stats);
+	zassert_equal(stats.tx_frames, 1, "Invalid frame count");
+	zassert_true(stats.tx_done_latency_max_us >= stats.tx_start_latency_max_us,
+		     "Invalid latencies");
+}
+
+ZTEST(ot_radio, test_src_match)
+{
+	otError err;
+
+	/* The radio generates ACKs, the frame pending bit is set from its table */
+	err = otPlatRadioAddSrcMatchShortEntry(NULL, 0x1234);
+	zassert_equal(err, OT_ERROR_NONE, "Unexpected failure: %d", err);
+	err = otPlatRadioAddSrcMatchShortEntry(NULL, 0x5678);
+	zassert_equal(err, OT_ERROR_NONE, "Unexpected failure: %d", err);
+
+	zassert_equal(src_match_cnt, 2, "Entries not passed to the radio");
+	zassert_equal(src_match_short[0], 0x1234, "Invalid entry");
+	zassert_equal(src_match_short[1], 0x5678, "Invalid entry");
+
+	err = otPlatRadioClearSrcMatchShortEntry(NULL, 0x1234);
+	zassert_equal(err, OT_ERROR_NONE, "Unexpected failure: %d", err);
+
+	zassert_equal(src_match_cnt, 1, "Entry not removed from the radio");
+	zassert_equal(src_match_short[0], 0x5678, "Invalid entry");
+
+	otPlatRadioClearSrcMatchShortEntries(NULL);
+	zassert_equal(src_match_cnt, 0, "Entries not cleared");
+}
+
+static void *setup(void)
+{
+	platformRadioInit();
+
+	zassert_equal(otPlatRadioEnable(NULL), OT_ERROR_NONE, "Radio not enabled");
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(otPlatRadioReceive(NULL, TEST_CHANNEL), OT_ERROR_NONE,
+		      "Reception not started");
+
+	k_sem_reset(&event_sem);
+	platformRadioStatsReset();
+	rx_report_cnt = 0;
+	tx_done_cnt = 0;
+	radio_tx_len = 0;
+	src_match_cnt = 0;
+}
+
+ZTEST_SUITE(ot_radio, NULL, setup, before, NULL, NULL);
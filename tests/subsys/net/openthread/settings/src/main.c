@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/settings/settings.h>
+
+#include <openthread/platform/settings.h>
+
+#define SINGLE_KEY 0x0001
+#define MULTI_KEY 0x0007
+
+/* Number of child entries stored by a router in the benchmark */
+#define CHILD_COUNT 32
+
+/* Indicates if all the entries of the benchmark fit into the index */
+#if defined(CONFIG_OPENTHREAD_SETTINGS_INDEX)
+#define INDEX_ENABLED (CHILD_COUNT <= CONFIG_OPENTHREAD_SETTINGS_INDEX_SIZE)
+#else
+#define INDEX_ENABLED false
+#endif
+
+struct child_info {
+	uint32_t id;
+	uint8_t ext_addr[8];
+	uint16_t rloc16;
+	uint8_t mode;
+	uint8_t version;
+};
+
+static int load_cnt;
+static int delete_err;
+
+int __real_settings_load_subtree_direct(const char *subtree, settings_load_direct_cb cb,
+					void *param);
+
+int __wrap_settings_load_subtree_direct(const char *subtree, settings_load_direct_cb cb,
+					void *param)
+{
+	load_cnt++;
+
+	return __real_settings_load_subtree_direct(subtree, cb, param);
+}
+
+int __real_settings_delete(const char *name);
+
+int __wrap_settings_delete(const char *name)
+{
+	if (delete_err) {
+		return delete_err;
+	}
+
+	return __real_settings_delete(name);
+}
+
+static void child_add(uint32_t id)
+{
+	struct child_info child = {.id = id, .rloc16 = id};
+	otError err;
+
+	err = otPlatSettingsAdd(NULL, MULTI_KEY, (const uint8_t *)&child, sizeof(child));
+	zassert_equal(err, OT_ERROR_NONE, "Unexpected failure: %d", err);
+}
+
+static otError child_get(int index, uint32_t *id)
+{
+	struct child_info child;
+	uint16_t len = sizeof(child);
+	otError err;
+
+	err = otPlatSettingsGet(NULL, MULTI_KEY, index, (uint8_t *)&child, &len);
+	if (err == OT_ERROR_NONE) {
+		zassert_equal(len, sizeof(child), "Unexpected length");
+		*id = child.id;
+	}
+
+	return err;
+}
+
+/* Reads all children and returns a bitmask of their IDs. */
+static uint64_t children_read(void)
+{
+	uint64_t found = 0;
+	uint32_t id;
+	int index = 0;
+
+	while (child_get(index, &id) == OT_ERROR_NONE) {
+		zassert_false(found & BIT64(id), "Child %u read twice", id);
+		found |= BIT64(id);
+		index++;
+	}
+
+	return found;
+}
+
+static void print_result(const char *op, int count, int64_t start, int loads)
+{
+	int64_t ticks = MAX(k_uptime_ticks() - start, 1);
+
+	TC_PRINT("%-6s %d entries: %u us, %d storage walks\n", op, count,
+		 k_ticks_to_us_floor32(ticks), loads);
+}
+
+ZTEST(ot_settings, test_set_get)
+{
+	uint8_t value[4] = {1, 2, 3, 4};
+	uint8_t read[sizeof(value)] = {0};
+	uint16_t len = sizeof(read);
+	otError err;
+
+	err = otPlatSettingsGet(NULL, SINGLE_KEY, 0, read, &len);
+	zassert_equal(err, OT_ERROR_NOT_FOUND, "Unexpected result: %d", err);
+
+	err = otPlatSettingsSet(NULL, SINGLE_KEY, value, sizeof(value));
+	zassert_equal(err, OT_ERROR_NONE, "Unexpected failure: %d", err);
+
+	value[0] = 5;
+	err = otPlatSettingsSet(NULL, SINGLE_KEY, value, sizeof(value));
+	zassert_equal(err, OT_ERROR_NONE, "Unexpected failure: %d", err);
+
+	err = otPlatSettingsGet(NULL, SINGLE_KEY, 0, read, &len);
+	zassert_equal(err, OT_ERROR_NONE, "Unexpected failure: %d", err);
+	zassert_equal(len, sizeof(value), "Unexpected length");
+	zassert_mem_equal(read, value, sizeof(value), "Unexpected value");
+
+	len = 0;
+	err = otPlatSettingsGet(NULL, SINGLE_KEY, 0, NULL, &len);
+	zassert_equal(err, OT_ERROR_NONE, "Unexpected failure: %d", err);
+	zassert_equal(len, sizeof(value), "Unexpected length");
+
+	err = otPlatSettingsGet(NULL, SINGLE_KEY, 1, read, &len);
+	zassert_equal(err, OT_ERROR_NOT_FOUND, "Unexpected result: %d", err);
+
+	err = otPlatSettingsDelete(NULL, SINGLE_KEY, -1);
+	zassert_equal(err, OT_ERROR_NONE, "Unexpected failure: %d", err);
+
+	err = otPlatSettingsGet(NULL, SINGLE_KEY, 0, read, &len);
+	zassert_equal(err, OT_ERROR_NOT_FOUND, "Unexpected result: %d", err);
+}
+
+ZTEST(ot_settings, test_add_delete)
+{
+	uint32_t id;
+	otError err;
+
+	for (uint32_t i = 0; i < 4; i++) {
+		child_add(i);
+	}
+
+	zassert_equal(children_read(), BIT_MASK(4), "Unexpected children");
+
+	err = child_get(1, &id);
+	zassert_equal(err, OT_ERROR_NONE, "Unexpected failure: %d", err);
+
+	err = otPlatSettingsDelete(NULL, MULTI_KEY, 1);
+	zassert_equal(err, OT_ERROR_NONE, "Unexpected failure: %d", err);
+	zassert_equal(children_read(), BIT_MASK(4) & ~BIT64(id), "Unexpected children");
+
+	err = otPlatSettingsDelete(NULL, MULTI_KEY, 3);
+	zassert_equal(err, OT_ERROR_NOT_FOUND, "Unexpected result: %d", err);
+
+	err = otPlatSettingsDelete(NULL, MULTI_KEY, -1);
+	zassert_equal(err, OT_ERROR_NONE, "Unexpected failure: %d", err);
+	zassert_equal(children_read(), 0, "Children not deleted");
+
+	err = otPlatSettingsDelete(NULL, MULTI_KEY, -1);
+	zassert_equal(err, OT_ERROR_NOT_FOUND, "Unexpected result: %d", err);
+}
+
+ZTEST(ot_settings, test_delete_failure)
+{
+	otError err;
+
+	for (uint32_t i = 0; i < 4; i++) {
+		child_add(i);
+	}
+
+	/* Settings which could not be removed are still found */
+	delete_err = -EIO;
+	err = otPlatSettingsDelete(NULL, MULTI_KEY, 1);
+	zassert_equal(err, OT_ERROR_FAILED, "Unexpected result: %d", err);
+	zassert_equal(children_read(), BIT_MASK(4), "Children lost on failure");
+
+	(void)otPlatSettingsDelete(NULL, MULTI_KEY, -1);
+	zassert_equal(children_read(), BIT_MASK(4), "Children lost on failure");
+
+	delete_err = 0;
+	(void)otPlatSettingsDelete(NULL, MULTI_KEY, -1);
+	zassert_equal(children_read(), 0, "Children not deleted");
+}
+
+ZTEST(ot_settings, test_reinit)
+{
+	uint8_t value = 0xaa;
+	uint8_t read = 0;
+	uint16_t len = sizeof(read);
+	otError err;
+
+	for (uint32_t i = 0; i < 8; i++) {
+		child_add(i);
+	}
+
+	err = otPlatSettingsSet(NULL, SINGLE_KEY, &value, sizeof(value));
+	zassert_equal(err, OT_ERROR_NONE, "Unexpected failure: %d", err);
+
+	/* Settings written before the initialization must be found */
+	otPlatSettingsInit(NULL, NULL, 0);
+
+	zassert_equal(children_read(), BIT_MASK(8), "Unexpected children");
+
+	err = otPlatSettingsGet(NULL, SINGLE_KEY, 0, &read, &len);
+	zassert_equal(err, OT_ERROR_NONE, "Unexpected failure: %d", err);
+	zassert_equal(read, value, "Unexpected value");
+
+	otPlatSettingsWipe(NULL);
+
+	zassert_equal(children_read(), 0, "Children not wiped");
+	err = otPlatSettingsGet(NULL, SINGLE_KEY, 0, &read, &len);
+	zassert_equal(err, OT_ERROR_NOT_FOUND, "Unexpected result: %d", err);
+}
+
+ZTEST(ot_settings, test_benchmark)
+{
+	int64_t start;
+	uint32_t id;
+	otError err;
+
+	/* A router storing the child table */
+	load_cnt = 0;
+	start = k_uptime_ticks();
+
+	for (uint32_t i = 0; i < CHILD_COUNT; i++) {
+		child_add(i);
+	}
+
+	print_result("Add", CHILD_COUNT, start, load_cnt);
+	if (INDEX_ENABLED) {
+		zassert_equal(load_cnt, 0, "Storage walked when adding");
+	}
+
+	/* Restoring the child table */
+	load_cnt = 0;
+	start = k_uptime_ticks();
+
+	zassert_equal(children_read(), BIT64_MASK(CHILD_COUNT), "Unexpected children");
+
+	print_result("Get", CHILD_COUNT, start, load_cnt);
+	if (INDEX_ENABLED) {
+		zassert_equal(load_cnt, CHILD_COUNT, "Storage walked more than once per read");
+	}
+
+	/* Children leaving one by one */
+	load_cnt = 0;
+	start = k_uptime_ticks();
+
+	for (int i = 0; i < CHILD_COUNT; i++) {
+		err = otPlatSettingsDelete(NULL, MULTI_KEY, 0);
+		zassert_equal(err, OT_ERROR_NONE, "Unexpected failure: %d", err);
+	}
+
+	print_result("Delete", CHILD_COUNT, start, load_cnt);
+	if (INDEX_ENABLED) {
+		zassert_equal(load_cnt, 0, "Storage walked when deleting");
+	}
+
+	zassert_equal(child_get(0, &id), OT_ERROR_NOT_FOUND, "Children not deleted");
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	delete_err = 0;
+	otPlatSettingsInit(NULL, NULL, 0);
+	otPlatSettingsWipe(NULL);
+}
+
+ZTEST_SUITE(ot_settings, NULL, NULL, before, NULL, NULL);
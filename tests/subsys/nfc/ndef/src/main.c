@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/byteorder.h>
+#include <nfc/ndef/msg.h>
+#include <nfc/ndef/msg_parser.h>
+#include <nfc/t4t/ndef_file.h>
+
+#define RECORD_CNT 8
+#define PAYLOAD_LEN 64
+#define FILE_BUF_LEN 1024
+#define ITERATIONS 1000
+
+static const uint8_t rec_type[] = {'T'};
+static const uint8_t rec_id[] = {'i', 'd'};
+static uint8_t payloads[RECORD_CNT][PAYLOAD_LEN];
+
+static struct nfc_ndef_bin_payload_desc bin_pay_desc[RECORD_CNT];
+static struct nfc_ndef_record_desc rec_desc[RECORD_CNT];
+
+static uint8_t file_buf[FILE_BUF_LEN];
+static uint8_t ref_buf[FILE_BUF_LEN];
+static uint32_t desc_buf[NFC_NDEF_PARSER_REQUIRED_MEM(RECORD_CNT) / sizeof(uint32_t) + 1];
+
+static uint32_t encode_incremental(uint8_t *buf, uint32_t size)
+{
+	struct nfc_ndef_msg_encoder encoder;
+	uint32_t len;
+
+	nfc_ndef_msg_encoder_init(&encoder, buf, size);
+
+	for (int i = 0; i < RECORD_CNT; i++) {
+		zassert_ok(nfc_ndef_msg_encoder_record_add(&encoder, &rec_desc[i]));
+	}
+
+	zassert_ok(nfc_ndef_msg_encoder_finish(&encoder, &len));
+
+	return len;
+}
+
+static uint32_t encode_desc(uint8_t *buf, uint32_t size)
+{
+	NFC_NDEF_MSG_DEF(msg, RECORD_CNT);
+	uint32_t len = size;
+
+	for (int i = 0; i < RECORD_CNT; i++) {
+		zassert_ok(nfc_ndef_msg_record_add(&NFC_NDEF_MSG(msg), &rec_desc[i]));
+	}
+
+	zassert_ok(nfc_ndef_msg_encode(&NFC_NDEF_MSG(msg), buf, &len));
+
+	return len;
+}
+
+static uint32_t iter_records(const uint8_t *data, uint32_t len)
+{
+	struct nfc_ndef_msg_iter iter;
+	struct nfc_ndef_record_view record;
+	uint32_t cnt = 0;
+	int err;
+
+	nfc_ndef_msg_iter_init(&iter, data, len);
+
+	while ((err = nfc_ndef_msg_iter_next(&iter, &record)) == 0) {
+		cnt++;
+	}
+
+	zassert_equal(err, -ENOENT, "Unexpected failure: %d", err);
+	zassert_equal(iter.offset, len, "Invalid message length: %u", iter.offset);
+
+	return cnt;
+}
+
+ZTEST(nfc_ndef, test_encode_t4t_file)
+{
+	uint8_t *msg = nfc_t4t_ndef_file_msg_get(file_buf);
+	uint32_t len;
+	uint32_t ref_len;
+
+	len = encode_incremental(msg, nfc_t4t_ndef_file_msg_size_get(sizeof(file_buf)));
+	ref_len = encode_desc(ref_buf, sizeof(ref_buf));
+
+	zassert_equal(len, ref_len, "Invalid message length: %u", len);
+	zassert_mem_equal(msg, ref_buf, len, "Message differs from the reference");
+
+	zassert_ok(nfc_t4t_ndef_file_encode(file_buf, &len));
+	zassert_equal(len, ref_len + NFC_NDEF_FILE_NLEN_FIELD_SIZE);
+	zassert_equal(sys_get_be16(file_buf), ref_len, "Invalid NLEN");
+}
+
+ZTEST(nfc_ndef, test_encoder_errors)
+{
+	struct nfc_ndef_msg_encoder encoder;
+	uint32_t len;
+
+	nfc_ndef_msg_encoder_init(&encoder, file_buf, PAYLOAD_LEN);
+
+	zassert_equal(nfc_ndef_msg_encoder_finish(&encoder, &len), -ENODATA);
+	zassert_equal(nfc_ndef_msg_encoder_record_add(&encoder, &rec_desc[0]), -ENOSR);
+	zassert_equal(nfc_ndef_msg_encoder_finish(&encoder, &len), -ENODATA);
+}
+
+ZTEST(nfc_ndef, test_iter_records)
+{
+	struct nfc_ndef_msg_iter iter;
+	struct nfc_ndef_record_view record;
+	uint32_t len;
+
+	len = encode_incremental(file_buf, sizeof(file_buf));
+
+	nfc_ndef_msg_iter_init(&iter, file_buf, len);
+
+	for (int i = 0; i < RECORD_CNT; i++) {
+		zassert_ok(nfc_ndef_msg_iter_next(&iter, &record));
+
+		zassert_equal(record.tnf, TNF_MEDIA_TYPE);
+		zassert_equal(record.type_length, sizeof(rec_type));
+		zassert_mem_equal(record.type, rec_type, sizeof(rec_type));
+		zassert_equal(record.id_length, sizeof(rec_id));
+		zassert_mem_equal(record.id, rec_id, sizeof(rec_id));
+		zassert_equal(record.payload_length, PAYLOAD_LEN);
+		zassert_mem_equal(record.payload, payloads[i], PAYLOAD_LEN);
+
+		/* Fields are not copied */
+		zassert_true(record.payload > file_buf && record.payload < &file_buf[len],
+			     "Payload not in the raw data");
+	}
+
+	zassert_equal(record.location, NDEF_LAST_RECORD);
+	zassert_equal(nfc_ndef_msg_iter_next(&iter, &record), -ENOENT);
+	zassert_equal(iter.offset, len);
+}
+
+ZTEST(nfc_ndef, test_iter_short_record)
+{
+	static const uint8_t data[] = {
+		/* MB, ME, SR, IL, TNF_WELL_KNOWN */
+		0xD9, 0x01, 0x02, 0x01, 'U', 'i', 0x04, 'a',
+	};
+	struct nfc_ndef_msg_iter iter;
+	struct nfc_ndef_record_view record;
+
+	nfc_ndef_msg_iter_init(&iter, data, sizeof(data));
+
+	zassert_ok(nfc_ndef_msg_iter_next(&iter, &record));
+	zassert_equal(record.location, NDEF_LONE_RECORD);
+	zassert_equal(record.tnf, TNF_WELL_KNOWN);
+	zassert_equal(record.type, &data[4]);
+	zassert_equal(record.id, &data[5]);
+	zassert_equal(record.payload, &data[6]);
+	zassert_equal(record.payload_length, 2);
+	zassert_equal(nfc_ndef_msg_iter_next(&iter, &record), -ENOENT);
+}
+
+ZTEST(nfc_ndef, test_iter_malformed)
+{
+	struct nfc_ndef_msg_iter iter;
+	struct nfc_ndef_record_view record;
+	uint32_t len;
+
+	len = encode_incremental(file_buf, sizeof(file_buf));
+
+	/* Truncated record */
+	nfc_ndef_msg_iter_init(&iter, file_buf, len - 1);
+
+	for (int i = 0; i < RECORD_CNT - 1; i++) {
+		zassert_ok(nfc_ndef_msg_iter_next(&iter, &record));
+	}
+
+	zassert_equal(nfc_ndef_msg_iter_next(&iter, &record), -EINVAL);
+
+	/* Message ends without the last record */
+	nfc_ndef_msg_iter_init(&iter, file_buf, iter.offset);
+
+	for (int i = 0; i < RECORD_CNT - 1; i++) {
+		zassert_ok(nfc_ndef_msg_iter_next(&iter, &record));
+	}
+
+	zassert_equal(nfc_ndef_msg_iter_next(&iter, &record), -EFAULT);
+
+	/* First record without the MB flag */
+	file_buf[0] &= ~NDEF_FIRST_RECORD;
+	nfc_ndef_msg_iter_init(&iter, file_buf, len);
+
+	zassert_equal(nfc_ndef_msg_iter_next(&iter, &record), -EFAULT);
+}
+
+ZTEST(nfc_ndef, test_throughput)
+{
+	uint32_t len;
+	uint32_t start;
+	uint32_t cycles;
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < ITERATIONS; i++) {
+		len = encode_desc(file_buf, sizeof(file_buf));
+	}
+	cycles = k_cycle_get_32() - start;
+	TC_PRINT("Descriptor encoding: %u cycles per message\n", cycles / ITERATIONS);
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < ITERATIONS; i++) {
+		len = encode_incremental(file_buf, sizeof(file_buf));
+	}
+	cycles = k_cycle_get_32() - start;
+	TC_PRINT("Incremental encoding: %u cycles per message\n", cycles / ITERATIONS);
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < ITERATIONS; i++) {
+		uint32_t desc_len = sizeof(desc_buf);
+		uint32_t msg_len = len;
+
+		zassert_ok(nfc_ndef_msg_parse((uint8_t *)desc_buf, &desc_len, file_buf, &msg_len));
+	}
+	cycles = k_cycle_get_32() - start;
+	TC_PRINT("Descriptor parsing: %u cycles per message, %u bytes of descriptors\n",
+		 cycles / ITERATIONS, (uint32_t)NFC_NDEF_PARSER_REQUIRED_MEM(RECORD_CNT));
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < ITERATIONS; i++) {
+		zassert_equal(iter_records(file_buf, len), RECORD_CNT);
+	}
+	cycles = k_cycle_get_32() - start;
+	TC_PRINT("Iterator parsing: %u cycles per message, %u bytes of descriptors\n",
+		 cycles / ITERATIONS, (uint32_t)sizeof(struct nfc_ndef_msg_iter));
+}
+
+static void *setup(void)
+{
+	for (int i = 0; i < RECORD_CNT; i++) {
+		for (int j = 0; j < PAYLOAD_LEN; j++) {
+			payloads[i][j] = i + j;
+		}
+
+		bin_pay_desc[i].payload = payloads[i];
+		bin_pay_desc[i].payload_length = PAYLOAD_LEN;
+
+		rec_desc[i] = (struct nfc_ndef_record_desc) {
+			.tnf = TNF_MEDIA_TYPE,
+			.id_length = sizeof(rec_id),
+			.id = rec_id,
+			.type_length = sizeof(rec_type),
+			.type = rec_type,
+			.payload_constructor =
+				(payload_constructor_t)nfc_ndef_bin_payload_memcopy,
+			.payload_descriptor = &bin_pay_desc[i],
+		};
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(nfc_ndef, NULL, setup, NULL, NULL, NULL);
@@ -34,6 +34,65 @@ struct suit_decrypt_filter_tests_fixture {
 
 static uint8_t output_buffer[128] = {0};
 
+#define LARGE_PLAINTEXT_LENGTH 4096
+#define LARGE_CIPHERTEXT_WRITE_SIZE 100
+#define TAG_LENGTH 16
+
+static uint8_t large_plaintext[LARGE_PLAINTEXT_LENGTH];
+static uint8_t large_encrypted[LARGE_PLAINTEXT_LENGTH + TAG_LENGTH];
+static uint8_t large_ciphertext[TAG_LENGTH + LARGE_PLAINTEXT_LENGTH];
+static uint8_t large_output_buffer[LARGE_PLAINTEXT_LENGTH];
+
+/* Sink storing the decrypted data and counting the write operations done by the decrypt filter. */
+struct counting_sink_ctx {
+	uint8_t *buf;
+	size_t size;
+	size_t offset;
+	size_t write_cnt;
+	size_t unaligned_write_cnt;
+};
+
+static suit_plat_err_t counting_sink_write(void *ctx, const uint8_t *buf, size_t size)
+{
+	struct counting_sink_ctx *counting_ctx = (struct counting_sink_ctx *)ctx;
+
+	if (size > (counting_ctx->size - counting_ctx->offset)) {
+		return SUIT_PLAT_ERR_NOMEM;
+	}
+
+	memcpy(&counting_ctx->buf[counting_ctx->offset], buf, size);
+	counting_ctx->offset += size;
+
+	counting_ctx->write_cnt++;
+	if ((size % CONFIG_SUIT_STREAM_FILTER_DECRYPT_OUTPUT_BUF_SIZE) != 0) {
+		counting_ctx->unaligned_write_cnt++;
+	}
+
+	return SUIT_PLAT_SUCCESS;
+}
+
+static suit_plat_err_t counting_sink_used_storage(void *ctx, size_t *size)
+{
+	struct counting_sink_ctx *counting_ctx = (struct counting_sink_ctx *)ctx;
+
+	*size = counting_ctx->offset;
+
+	return SUIT_PLAT_SUCCESS;
+}
+
+static void counting_sink_get(struct stream_sink *sink, struct counting_sink_ctx *ctx,
+			      uint8_t *buf, size_t size)
+{
+	memset(ctx, 0, sizeof(*ctx));
+	ctx->buf = buf;
+	ctx->size = size;
+
+	memset(sink, 0, sizeof(*sink));
+	sink->write = counting_sink_write;
+	sink->used_storage = counting_sink_used_storage;
+	sink->ctx = ctx;
+}
+
 static void *test_suite_setup(void)
 {
 	static struct suit_decrypt_filter_tests_fixture fixture = {0};
@@ -241,3 +300,166 @@ ZTEST_F(suit_decrypt_filter_tests, test_key_id_validation_fail)
 	zassert_equal(suit_mci_fw_encryption_key_id_validate_fake.arg1_val, cek_key_id,
 			   "Invalid key ID passed to suit_mci_fw_encryption_key_id_validate");
 }
+
+ZTEST_F(suit_decrypt_filter_tests, test_filter_multiple_instances)
+{
+	struct stream_sink dec_sinks[2];
+	struct stream_sink out_sinks[2];
+	struct counting_sink_ctx out_ctx[2];
+	static uint8_t out_bufs[2][DECRYPT_TEST_PLAINTEXT_LENGTH];
+	struct stream_sink busy_sink;
+	size_t first_part = sizeof(decrypt_test_ciphertext_direct) / 2;
+	uint8_t cek_key_id_cbor[] = {
+		0x1A, 0x00, 0x00, 0x00, 0x00,
+	};
+	psa_key_id_t cek_key_id;
+	suit_plat_err_t err;
+
+	psa_status_t const status =
+		decrypt_test_init_encryption_key(decrypt_test_key_data,
+				sizeof(decrypt_test_key_data), &cek_key_id,
+				PSA_ALG_GCM, cek_key_id_cbor);
+
+	zassert_equal(status, PSA_SUCCESS, "Failed to import key");
+
+	struct suit_encryption_info enc_info =
+			DECRYPT_TEST_ENC_INFO_DEFAULT_INIT(cek_key_id_cbor);
+
+	suit_mci_fw_encryption_key_id_validate_fake.return_val = SUIT_PLAT_SUCCESS;
+
+	for (size_t i = 0; i < ARRAY_SIZE(dec_sinks); i++) {
+		counting_sink_get(&out_sinks[i], &out_ctx[i], out_bufs[i], sizeof(out_bufs[i]));
+
+		err = suit_decrypt_filter_get(&dec_sinks[i], &enc_info,
+					&decrypt_test_sample_class_id, &out_sinks[i]);
+		zassert_equal(err, SUIT_PLAT_SUCCESS, "Failed to create decrypt filter %zu", i);
+	}
+
+	err = suit_decrypt_filter_get(&busy_sink, &enc_info, &decrypt_test_sample_class_id,
+				      &out_sinks[0]);
+	zassert_equal(err, SUIT_PLAT_ERR_BUSY, "Too many decrypt filters created");
+
+	/* Interleave the writes, so that both decryption operations are in progress. */
+	for (size_t i = 0; i < ARRAY_SIZE(dec_sinks); i++) {
+		err = dec_sinks[i].write(dec_sinks[i].ctx, decrypt_test_ciphertext_direct,
+					 first_part);
+		zassert_equal(err, SUIT_PLAT_SUCCESS, "Failed to decrypt ciphertext");
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(dec_sinks); i++) {
+		err = dec_sinks[i].write(dec_sinks[i].ctx,
+					 &decrypt_test_ciphertext_direct[first_part],
+					 sizeof(decrypt_test_ciphertext_direct) - first_part);
+		zassert_equal(err, SUIT_PLAT_SUCCESS, "Failed to decrypt ciphertext");
+
+		err = dec_sinks[i].flush(dec_sinks[i].ctx);
+		zassert_equal(err, SUIT_PLAT_SUCCESS, "Failed to flush decrypt filter");
+
+		err = dec_sinks[i].release(dec_sinks[i].ctx);
+		zassert_equal(err, SUIT_PLAT_SUCCESS, "Failed to release decrypt filter");
+
+		zassert_equal(out_ctx[i].offset, DECRYPT_TEST_PLAINTEXT_LENGTH,
+			      "Invalid decrypted data length");
+		zassert_equal(memcmp(out_bufs[i], decrypt_test_plaintext,
+				     DECRYPT_TEST_PLAINTEXT_LENGTH), 0,
+			      "Decrypted plaintext does not match");
+	}
+
+	psa_destroy_key(cek_key_id);
+}
+
+ZTEST_F(suit_decrypt_filter_tests, test_filter_output_coalescing)
+{
+	struct stream_sink dec_sink;
+	struct stream_sink out_sink;
+	struct counting_sink_ctx out_ctx;
+	uint8_t cek_key_id_cbor[] = {
+		0x1A, 0x00, 0x00, 0x00, 0x00,
+	};
+	psa_key_id_t cek_key_id;
+	size_t ciphertext_len = 0;
+	suit_plat_err_t err = SUIT_PLAT_SUCCESS;
+	size_t written = 0;
+	size_t used = 0;
+	uint32_t start;
+	uint32_t cycles;
+
+	psa_status_t status =
+		decrypt_test_init_encryption_key(decrypt_test_key_data,
+				sizeof(decrypt_test_key_data), &cek_key_id,
+				PSA_ALG_GCM, cek_key_id_cbor);
+
+	zassert_equal(status, PSA_SUCCESS, "Failed to import key");
+
+	struct suit_encryption_info enc_info =
+			DECRYPT_TEST_ENC_INFO_DEFAULT_INIT(cek_key_id_cbor);
+
+	for (size_t i = 0; i < sizeof(large_plaintext); i++) {
+		large_plaintext[i] = (uint8_t)i;
+	}
+
+	status = psa_aead_encrypt(cek_key_id, PSA_ALG_GCM, decrypt_test_iv_direct,
+				  sizeof(decrypt_test_iv_direct), decrypt_test_aad,
+				  strlen(decrypt_test_aad), large_plaintext,
+				  sizeof(large_plaintext), large_encrypted,
+				  sizeof(large_encrypted), &ciphertext_len);
+	zassert_equal(status, PSA_SUCCESS, "Failed to encrypt plaintext");
+	zassert_equal(ciphertext_len, sizeof(large_encrypted), "Invalid ciphertext length");
+
+	/* PSA places the tag after the ciphertext, while the filter expects it at the beginning. */
+	memcpy(large_ciphertext, &large_encrypted[LARGE_PLAINTEXT_LENGTH], TAG_LENGTH);
+	memcpy(&large_ciphertext[TAG_LENGTH], large_encrypted, LARGE_PLAINTEXT_LENGTH);
+
+	suit_mci_fw_encryption_key_id_validate_fake.return_val = SUIT_PLAT_SUCCESS;
+	counting_sink_get(&out_sink, &out_ctx, large_output_buffer, sizeof(large_output_buffer));
+
+	err = suit_decrypt_filter_get(&dec_sink, &enc_info, &decrypt_test_sample_class_id,
+				      &out_sink);
+	zassert_equal(err, SUIT_PLAT_SUCCESS, "Failed to create decrypt filter");
+
+	start = k_cycle_get_32();
+
+	/* Feed the filter in chunks, not aligned to the output buffer size. */
+	for (size_t offset = 0; offset < sizeof(large_ciphertext);
+	     offset += LARGE_CIPHERTEXT_WRITE_SIZE) {
+		size_t len = MIN(LARGE_CIPHERTEXT_WRITE_SIZE, sizeof(large_ciphertext) - offset);
+
+		err = dec_sink.write(dec_sink.ctx, &large_ciphertext[offset], len);
+		zassert_equal(err, SUIT_PLAT_SUCCESS, "Failed to decrypt ciphertext");
+
+		/* Data kept in the output buffer is reported as used, only a partial cipher
+		 * block may still be held by the decryption operation.
+		 */
+		written += len;
+		err = dec_sink.used_storage(dec_sink.ctx, &used);
+		zassert_equal(err, SUIT_PLAT_SUCCESS, "Failed to get used storage");
+		zassert_true(used <= written - TAG_LENGTH, "Invalid used storage");
+		zassert_true(used + PSA_BLOCK_CIPHER_BLOCK_MAX_SIZE > written - TAG_LENGTH,
+			     "Buffered data not reported as used storage");
+	}
+
+	err = dec_sink.flush(dec_sink.ctx);
+	zassert_equal(err, SUIT_PLAT_SUCCESS, "Failed to flush decrypt filter");
+
+	cycles = k_cycle_get_32() - start;
+
+	err = dec_sink.release(dec_sink.ctx);
+	zassert_equal(err, SUIT_PLAT_SUCCESS, "Failed to release decrypt filter");
+
+	zassert_equal(out_ctx.offset, LARGE_PLAINTEXT_LENGTH, "Invalid decrypted data length");
+	zassert_equal(memcmp(large_output_buffer, large_plaintext, LARGE_PLAINTEXT_LENGTH), 0,
+		      "Decrypted plaintext does not match");
+	zassert_equal(out_ctx.write_cnt,
+		      DIV_ROUND_UP(LARGE_PLAINTEXT_LENGTH,
+				   CONFIG_SUIT_STREAM_FILTER_DECRYPT_OUTPUT_BUF_SIZE),
+		      "Invalid number of output sink writes");
+	zassert_equal(out_ctx.unaligned_write_cnt,
+		      (LARGE_PLAINTEXT_LENGTH % CONFIG_SUIT_STREAM_FILTER_DECRYPT_OUTPUT_BUF_SIZE) ?
+		      1 : 0,
+		      "Unaligned writes passed to the output sink");
+
+	TC_PRINT("Decrypted %u bytes in %u us, %zu output sink writes\n",
+		 LARGE_PLAINTEXT_LENGTH, k_cyc_to_us_floor32(cycles), out_ctx.write_cnt);
+
+	psa_destroy_key(cek_key_id);
+}
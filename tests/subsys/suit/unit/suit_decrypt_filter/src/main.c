@@ -346,6 +346,28 @@ ZTEST_F(suit_decrypt_filter_tests, test_filter_get_success_path)
 			"Invalid fixture->in_sink.ctx value");
 }
 
+ZTEST_F(suit_decrypt_filter_tests, test_filter_get_busy)
+{
+	struct suit_encryption_info enc_info = ENC_INFO_DEFAULT_INIT;
+	struct stream_sink busy_sink = {0};
+
+	suit_plat_decode_key_id_fake.custom_fake = custom_suit_plat_decode_key_id;
+
+	suit_plat_err_t err = suit_decrypt_filter_get(&fixture->in_sink, &enc_info,
+							&sample_class_id, &fixture->out_sink);
+
+	zassert_equal(err, SUIT_PLAT_SUCCESS,
+			"Incorrect error code when getting decrypt filter");
+
+	/* Only a single decrypt filter context is configured for this test. */
+	err = suit_decrypt_filter_get(&busy_sink, &enc_info, &sample_class_id,
+				      &fixture->out_sink);
+
+	zassert_equal(err, SUIT_PLAT_ERR_BUSY,
+			"Incorrect error code when getting decrypt filter");
+	zassert_equal_ptr(busy_sink.ctx, NULL, "Invalid busy_sink.ctx value");
+}
+
 ZTEST_F(suit_decrypt_filter_tests, test_write_filter_not_initialized)
 {
 	struct suit_encryption_info enc_info = ENC_INFO_DEFAULT_INIT;